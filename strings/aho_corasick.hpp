@@ -0,0 +1,234 @@
+#pragma once
+
+#include "simd.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace strings {
+
+// match_kind selects among the matches that start at the same leftmost
+// position
+enum class match_kind {
+    leftmost_longest, // the longest pattern
+    leftmost_first,   // the pattern that was specified first
+};
+
+// aho_corasick is a multi-pattern matching automaton over codeunits
+//
+// - patterns are not owned, only their lengths are retained
+// - empty patterns never match
+// - for single byte codeunits the automaton is compiled into a dense
+//   transition table (256 entries per state), and scanning skips ahead to the
+//   first bytes of the patterns with block scans while in the root state
+// - wider codeunits use sorted sparse transitions with failure links
+//
+template <typename U> class aho_corasick {
+public:
+    using string_view_type = std::basic_string_view<U>;
+    using state_type = detail::scan_state;
+
+    struct match {
+        std::size_t pos;     // position of the matched pattern in the input
+        std::size_t size;    // size of the matched pattern
+        std::size_t pattern; // index of the matched pattern
+    };
+
+    aho_corasick(std::initializer_list<string_view_type> patterns)
+        : aho_corasick{std::ranges::subrange(patterns.begin(), patterns.end())}
+    {
+    }
+
+    template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, string_view_type>
+    explicit aho_corasick(R const& patterns)
+    {
+        nodes_.emplace_back();
+        for (auto&& p : patterns)
+            insert(string_view_type(p));
+        build();
+    }
+
+    auto pattern_count() const -> std::size_t { return lengths_.size(); }
+    auto pattern_size(std::size_t pattern) const -> std::size_t { return lengths_[pattern]; }
+
+    // find_earliest returns the match that ends first at or after from; among
+    // the matches that end at the same position, the longest one is returned
+    auto find_earliest(string_view_type sv, std::size_t from) const -> std::optional<match>
+    {
+        auto st = state_type{};
+        return find_earliest(sv, from, st);
+    }
+
+    // find_earliest overload that keeps the block scan state between calls
+    // on the same input
+    auto find_earliest(string_view_type sv, std::size_t from, state_type& st) const -> std::optional<match>
+    {
+        auto state = std::uint32_t{0};
+        auto const n = sv.size();
+        for (auto i = from; i < n;) {
+            if constexpr (sizeof(U) == 1) {
+                if (state == 0) {
+                    auto const data = reinterpret_cast<char const*>(sv.data());
+                    i = detail::scan_blocks(n, i, st,
+                        [&](std::size_t base, std::size_t count) { return first_.mask(data, n, base, count); });
+                    if (i == std::size_t(-1))
+                        return {};
+                }
+                state = delta_[std::size_t(state) << 8 | static_cast<std::uint8_t>(sv[i])];
+            }
+            else
+                state = next_state(state, sv[i]);
+            ++i;
+            if (auto const& nd = nodes_[state]; nd.out) {
+                auto const len = lengths_[nd.out - 1];
+                return match{i - len, len, nd.out - 1};
+            }
+        }
+        return {};
+    }
+
+    // find_leftmost returns the match that starts first at or after from, the
+    // ties are resolved according to kind
+    auto find_leftmost(string_view_type sv, std::size_t from, match_kind kind = match_kind::leftmost_longest) const
+        -> std::optional<match>
+    {
+        auto st = state_type{};
+        return find_leftmost(sv, from, st, kind);
+    }
+
+    // find_leftmost overload that keeps the block scan state between calls
+    // on the same input
+    auto find_leftmost(string_view_type sv, std::size_t from, state_type& st,
+        match_kind kind = match_kind::leftmost_longest) const -> std::optional<match>
+    {
+        auto best = std::optional<match>{};
+        auto state = std::uint32_t{0};
+        auto const n = sv.size();
+        for (auto i = from; i < n;) {
+            if constexpr (sizeof(U) == 1) {
+                if (state == 0) {
+                    if (best)
+                        return best;
+                    auto const data = reinterpret_cast<char const*>(sv.data());
+                    i = detail::scan_blocks(n, i, st,
+                        [&](std::size_t base, std::size_t count) { return first_.mask(data, n, base, count); });
+                    if (i == std::size_t(-1))
+                        return {};
+                }
+                state = delta_[std::size_t(state) << 8 | static_cast<std::uint8_t>(sv[i])];
+            }
+            else
+                state = next_state(state, sv[i]);
+            ++i;
+
+            auto const& nd = nodes_[state];
+            if (nd.out) {
+                // the longest output starts first, shorter ones cannot improve
+                // on it
+                auto const len = lengths_[nd.out - 1];
+                auto const m = match{i - len, len, nd.out - 1};
+                if (!best || m.pos < best->pos)
+                    best = m;
+                else if (m.pos == best->pos &&
+                         (kind == match_kind::leftmost_longest ? m.size > best->size : m.pattern < best->pattern))
+                    best = m;
+            }
+            // the matches that are still in progress start at i - depth or later
+            if (best && i - nd.depth > best->pos)
+                return best;
+        }
+        return best;
+    }
+
+private:
+    struct node {
+        std::vector<std::pair<U, std::uint32_t>> edges; // sorted by codeunit
+        std::uint32_t fail = 0;
+        std::uint32_t depth = 0; // length of the prefix this node represents
+        std::uint32_t own = 0; // 1 + index of the pattern ending here, 0 if none
+        std::uint32_t out = 0; // 1 + index of the longest pattern that is a suffix, 0 if none
+    };
+
+    auto edge(std::uint32_t s, U c) const -> std::uint32_t
+    {
+        auto const& e = nodes_[s].edges;
+        auto it = std::lower_bound(e.begin(), e.end(), c, [](auto const& a, U b) { return a.first < b; });
+        return it != e.end() && it->first == c ? it->second : 0;
+    }
+
+    auto next_state(std::uint32_t s, U c) const -> std::uint32_t
+    {
+        while (true) {
+            if (auto t = edge(s, c))
+                return t;
+            if (!s)
+                return 0;
+            s = nodes_[s].fail;
+        }
+    }
+
+    void insert(string_view_type p)
+    {
+        lengths_.push_back(p.size());
+        if (p.empty())
+            return;
+        auto s = std::uint32_t{0};
+        for (auto c : p) {
+            auto t = edge(s, c);
+            if (!t) {
+                t = std::uint32_t(nodes_.size());
+                nodes_.emplace_back();
+                nodes_[t].depth = nodes_[s].depth + 1;
+                auto& e = nodes_[s].edges;
+                auto it = std::lower_bound(e.begin(), e.end(), c, [](auto const& a, U b) { return a.first < b; });
+                e.insert(it, {c, t});
+                if constexpr (sizeof(U) == 1)
+                    if (s == 0)
+                        first_.add(static_cast<std::uint8_t>(c));
+            }
+            s = t;
+        }
+        if (!nodes_[s].own)
+            nodes_[s].own = std::uint32_t(lengths_.size());
+    }
+
+    void build()
+    {
+        // breadth-first, so that failure targets are complete before use
+        auto order = std::vector<std::uint32_t>{0};
+        for (auto k = std::size_t{0}; k < order.size(); ++k) {
+            auto const s = order[k];
+            for (auto [c, t] : nodes_[s].edges) {
+                nodes_[t].fail = s ? next_state(nodes_[s].fail, c) : 0;
+                order.push_back(t);
+            }
+            auto& nd = nodes_[s];
+            nd.out = nd.own ? nd.own : (s ? nodes_[nd.fail].out : 0);
+        }
+
+        if constexpr (sizeof(U) == 1) {
+            delta_.assign(nodes_.size() << 8, 0);
+            for (auto s : order) {
+                auto const row = std::size_t(s) << 8;
+                if (s)
+                    std::copy_n(delta_.begin() + (std::size_t(nodes_[s].fail) << 8), 256, delta_.begin() + row);
+                for (auto [c, t] : nodes_[s].edges)
+                    delta_[row | static_cast<std::uint8_t>(c)] = t;
+            }
+        }
+    }
+
+    std::vector<node> nodes_;
+    std::vector<std::size_t> lengths_;
+    std::vector<std::uint32_t> delta_; // dense transitions, single byte codeunits only
+    detail::byte_class first_; // first codeunits of the patterns
+};
+
+} // namespace strings
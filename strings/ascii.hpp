@@ -1,5 +1,13 @@
 #pragma once
 
+#include "simd.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
 namespace strings::ascii {
 
 // is_alpha(c) := c in ['A'..'Z', 'a'..'z']
@@ -26,8 +34,8 @@ constexpr auto decimal(unsigned c) -> unsigned {
     return c < 10u ? c : unsigned(-1);
 }
 
-// decimal returns 0..15 for c in ['0'..'9', 'A'..'F', 'a'..'f']
-// for all other values, returns a value >= 10
+// hex returns 0..15 for c in ['0'..'9', 'A'..'F', 'a'..'f']
+// for all other values, returns a value >= 16
 constexpr auto hex(unsigned c) -> unsigned
 {
     c -= unsigned('0');
@@ -40,4 +48,165 @@ constexpr auto hex(unsigned c) -> unsigned
     return c < 6u ? c + 10u : unsigned(-1);
 };
 
-} // namespace strings::ascii
\ No newline at end of file
+// char_class selects the codeunits accepted by the bulk classification
+// functions below
+enum class char_class {
+    ascii,        // [0..127]
+    alpha,        // is_alpha
+    upper_alpha,  // is_upper_alpha
+    lower_alpha,  // is_lower_alpha
+    decimal,      // is_decimal
+    hex,          // hex(c) < 16
+    alphanumeric, // is_alpha || is_decimal
+};
+
+constexpr auto is_class(unsigned c, char_class cc) -> bool
+{
+    switch (cc) {
+    case char_class::ascii: return c < 128u;
+    case char_class::alpha: return is_alpha(c);
+    case char_class::upper_alpha: return is_upper_alpha(c);
+    case char_class::lower_alpha: return is_lower_alpha(c);
+    case char_class::decimal: return is_decimal(c);
+    case char_class::hex: return hex(c) < 16u;
+    case char_class::alphanumeric: return is_alpha(c) || is_decimal(c);
+    }
+    return false;
+}
+
+namespace detail {
+
+// the kernels below process whole vectors starting at i, and return the
+// position where the scalar code continues
+
+#ifdef STRINGS_SSE2
+
+// in_range returns the lanes where lo <= v <= hi
+template <typename V> auto in_range(typename V::vec v, char lo, char hi) -> typename V::vec
+{
+    return V::le(V::sub(v, V::set1(lo)), V::set1(char(hi - lo)));
+}
+
+template <typename V, char_class C> auto class_lanes(typename V::vec v) -> typename V::vec
+{
+    auto const folded = V::or_(v, V::set1(0x20));
+    if constexpr (C == char_class::ascii)
+        return V::le(v, V::set1(0x7f));
+    else if constexpr (C == char_class::alpha)
+        return in_range<V>(folded, 'a', 'z');
+    else if constexpr (C == char_class::upper_alpha)
+        return in_range<V>(v, 'A', 'Z');
+    else if constexpr (C == char_class::lower_alpha)
+        return in_range<V>(v, 'a', 'z');
+    else if constexpr (C == char_class::decimal)
+        return in_range<V>(v, '0', '9');
+    else if constexpr (C == char_class::hex)
+        return V::or_(in_range<V>(v, '0', '9'), in_range<V>(folded, 'a', 'f'));
+    else
+        return V::or_(in_range<V>(v, '0', '9'), in_range<V>(folded, 'a', 'z'));
+}
+
+// find_not_of_class stops at the first vector that contains a codeunit
+// outside of the class, returning its position
+template <typename V, char_class C> auto find_not_of_class(char const* p, std::size_t n, std::size_t i) -> std::size_t
+{
+    for (; n - i >= V::width; i += V::width)
+        if (auto const m = V::bits(class_lanes<V, C>(V::load(p + i))); m != V::all)
+            return i + std::size_t(std::countr_one(m));
+    return i;
+}
+
+// to_case flips the case bit of the letters in [lo..hi]
+template <typename V> auto to_case(char* p, std::size_t n, std::size_t i, char lo, char hi) -> std::size_t
+{
+    auto const bit = V::set1(0x20);
+    for (; n - i >= V::width; i += V::width) {
+        auto const v = V::load(p + i);
+        V::store(p + i, V::xor_(v, V::and_(in_range<V>(v, lo, hi), bit)));
+    }
+    return i;
+}
+
+#endif
+
+template <char_class C> auto find_first_not_of_class(std::string_view s, std::size_t i) -> std::size_t
+{
+#ifdef STRINGS_AVX2
+    i = find_not_of_class<strings::detail::avx2_ops, C>(s.data(), s.size(), i);
+#endif
+#ifdef STRINGS_SSE2
+    i = find_not_of_class<strings::detail::sse2_ops, C>(s.data(), s.size(), i);
+#endif
+    for (; i < s.size(); ++i)
+        if (!is_class(static_cast<unsigned char>(s[i]), C))
+            return i;
+    return std::string_view::npos;
+}
+
+inline void to_case(std::span<char> s, char lo, char hi)
+{
+    auto i = std::size_t{0};
+#ifdef STRINGS_AVX2
+    i = to_case<strings::detail::avx2_ops>(s.data(), s.size(), i, lo, hi);
+#endif
+#ifdef STRINGS_SSE2
+    i = to_case<strings::detail::sse2_ops>(s.data(), s.size(), i, lo, hi);
+#endif
+    for (; i < s.size(); ++i)
+        if (unsigned(s[i]) - unsigned(lo) <= unsigned(hi - lo))
+            s[i] ^= 0x20;
+}
+
+} // namespace detail
+
+// find_first_not_of_class returns the position of the first codeunit at or
+// after pos that does not belong to the class, or npos
+//
+// the input is classified 16 (SSE2) or 32 (AVX2) codeunits at a time
+//
+inline auto find_first_not_of_class(std::string_view s, char_class cc, std::size_t pos = 0) -> std::size_t
+{
+    if (pos >= s.size())
+        return std::string_view::npos;
+    switch (cc) {
+    case char_class::ascii: return detail::find_first_not_of_class<char_class::ascii>(s, pos);
+    case char_class::alpha: return detail::find_first_not_of_class<char_class::alpha>(s, pos);
+    case char_class::upper_alpha: return detail::find_first_not_of_class<char_class::upper_alpha>(s, pos);
+    case char_class::lower_alpha: return detail::find_first_not_of_class<char_class::lower_alpha>(s, pos);
+    case char_class::decimal: return detail::find_first_not_of_class<char_class::decimal>(s, pos);
+    case char_class::hex: return detail::find_first_not_of_class<char_class::hex>(s, pos);
+    case char_class::alphanumeric: return detail::find_first_not_of_class<char_class::alphanumeric>(s, pos);
+    }
+    return pos;
+}
+
+// all_of_class returns true if all of the codeunits belong to the class,
+// including for an empty input
+inline auto all_of_class(std::string_view s, char_class cc) -> bool
+{
+    return find_first_not_of_class(s, cc) == std::string_view::npos;
+}
+
+// to_lower_inplace converts 'A'..'Z' to 'a'..'z', other codeunits (including
+// utf8 sequences) are left unchanged
+inline void to_lower_inplace(std::span<char> s) { detail::to_case(s, 'A', 'Z'); }
+
+// to_upper_inplace converts 'a'..'z' to 'A'..'Z', other codeunits (including
+// utf8 sequences) are left unchanged
+inline void to_upper_inplace(std::span<char> s) { detail::to_case(s, 'a', 'z'); }
+
+inline auto to_lower(std::string_view s) -> std::string
+{
+    auto ret = std::string{s};
+    to_lower_inplace(ret);
+    return ret;
+}
+
+inline auto to_upper(std::string_view s) -> std::string
+{
+    auto ret = std::string{s};
+    to_upper_inplace(ret);
+    return ret;
+}
+
+} // namespace strings::ascii
@@ -4,11 +4,15 @@
 #include "format_locale.hpp"
 #include "format_spec.hpp"
 #include "marshal_traits.hpp"
+#include <algorithm>
 #include <array>
 #include <charconv>
 #include <cmath>
 #include <concepts>
+#include <cstring>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -20,29 +24,40 @@ namespace strings {
 // writer writes stuff between [first and last)
 struct writer {
     writer() noexcept
-        : fp_decimal_{user_decimal}
+        : locale_{current_numeric_locale()}
     {
     }
     writer(char* first, char* last) noexcept
         : first_{first}
         , cursor_{first}
         , last_{last}
-        , fp_decimal_{user_decimal}
+        , locale_{current_numeric_locale()}
     {
     }
 
     constexpr writer(char fp_decimal) noexcept
-        : fp_decimal_{fp_decimal}
+        : locale_{fp_decimal}
     {
     }
     constexpr writer(char* first, char* last, char fp_decimal) noexcept
         : first_{first}
         , cursor_{first}
         , last_{last}
-        , fp_decimal_{fp_decimal}
+        , locale_{fp_decimal}
     {
     }
 
+    // numeric conventions used by the formatting functions, defaults to the
+    // current_numeric_locale() of the constructing thread
+    constexpr auto locale() const noexcept -> numeric_locale const&
+    {
+        return locale_;
+    }
+    constexpr void set_locale(numeric_locale const& loc) noexcept
+    {
+        locale_ = loc;
+    }
+
     constexpr auto empty() const noexcept
     {
         return cursor_ == first_;
@@ -95,14 +110,42 @@ struct writer {
     constexpr auto format(std::string_view spec, Ts&&... values) -> std::errc;
 
 protected:
+    // grow_fn is installed by growable storage backends, it must make room
+    // for at least n more codeunits (updating first_, cursor_, and last_)
+    //
+    // backends that flush content out of the buffer must keep the codeunits
+    // at and after the pinned_ offset, and adjust pinned_ accordingly
+    using grow_fn = bool (*)(writer&, std::size_t n);
+
+    static constexpr auto unpinned = std::size_t(-1);
+
     char* cursor_ = nullptr;
     char* first_ = nullptr;
     char* last_ = nullptr;
-    char fp_decimal_ = '.';
+    numeric_locale locale_;
+    grow_fn grow_ = nullptr;
+    std::size_t pinned_ = unpinned;
 
     template <detail::supported_format_arg T>
     constexpr auto vfmt(T const& v, fmt::arg const&) -> std::errc;
 
+    template <detail::supported_format_arg T>
+    constexpr auto vfmt_value(T const& v, fmt::arg const&) -> std::errc;
+
+    // pad applies fill around the content written since the pinned_ offset,
+    // the content is shifted in place when fill is required before it
+    template <typename T> constexpr auto pad(fmt::arg const& a) -> std::errc;
+
+    // group inserts the thousands separators of the locale into the number
+    // written since the pinned_ offset
+    constexpr auto group() -> std::errc;
+
+    // grow returns true if at least n codeunits are available at cursor_
+    constexpr auto grow(std::size_t n) -> bool
+    {
+        return remaining() >= n || (grow_ && grow_(*this, n));
+    }
+
 private:
     constexpr auto check(std::to_chars_result const& cr) -> std::errc
     {
@@ -112,6 +155,29 @@ private:
         }
         return cr.ec;
     }
+
+    // put_chars calls f(cursor_, last_) with a to_chars-like signature,
+    // retrying with a larger buffer while the writer is able to grow
+    template <typename F> constexpr auto put_chars(F&& f) -> std::errc
+    {
+        auto r = f(cursor_, last_);
+        while (r.ec == std::errc::value_too_large && grow(remaining() + 1))
+            r = f(cursor_, last_);
+        return check(r);
+    }
+
+    // put_printf calls f(cursor_, nmax) with a snprintf-like signature,
+    // retrying once with the exact required capacity if the writer can grow
+    template <typename F> constexpr auto put_printf(F&& f) -> int
+    {
+        auto nmax = last_ - cursor_;
+        auto n = f(cursor_, nmax);
+        if (n > 0 && n >= nmax && grow(std::size_t(n) + 1)) {
+            nmax = last_ - cursor_;
+            n = f(cursor_, nmax);
+        }
+        return (n <= 0 || n >= nmax) ? -1 : n;
+    }
 };
 
 // zwriter extends writer with automatic zero termination.
@@ -194,6 +260,165 @@ private:
     storage_type buf_;
 };
 
+// growable_builder is a builder that never runs out of capacity
+//
+// - starts with InlineCapacity codeunits of stack-allocated storage
+// - spills to the heap with geometric growth when more room is needed,
+//   so the appends are amortized O(1)
+// - heap storage is obtained from Allocator (see pmr::growable_builder for
+//   the arena-backed variant)
+//
+template <std::size_t InlineCapacity = 0, typename Allocator = std::allocator<char>>
+struct growable_builder : public zwriter {
+
+    using allocator_type = Allocator;
+
+    growable_builder() noexcept
+        : zwriter{inline_, inline_ + InlineCapacity + 1}
+    {
+        grow_ = &grow_storage;
+    }
+
+    growable_builder(char fp_decimal) noexcept
+        : zwriter{inline_, inline_ + InlineCapacity + 1, fp_decimal}
+    {
+        grow_ = &grow_storage;
+    }
+
+    explicit growable_builder(allocator_type const& alloc) noexcept
+        : zwriter{inline_, inline_ + InlineCapacity + 1}
+        , heap_(alloc)
+    {
+        grow_ = &grow_storage;
+    }
+
+    growable_builder(char fp_decimal, allocator_type const& alloc) noexcept
+        : zwriter{inline_, inline_ + InlineCapacity + 1, fp_decimal}
+        , heap_(alloc)
+    {
+        grow_ = &grow_storage;
+    }
+
+    growable_builder(growable_builder const&) = delete;
+    auto operator=(growable_builder const&) -> growable_builder& = delete;
+
+    // reserve makes sure the builder can hold at least capacity codeunits
+    // (excluding the zero terminator) without reallocating
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > this->capacity())
+            grow_storage(*this, capacity - size());
+    }
+
+    auto get_allocator() const noexcept -> allocator_type
+    {
+        return heap_.get_allocator();
+    }
+
+private:
+    char inline_[InlineCapacity + 1];
+    std::vector<char, allocator_type> heap_;
+
+    static auto grow_storage(writer& w, std::size_t n) -> bool
+    {
+        auto& self = static_cast<growable_builder&>(w);
+        auto const used = self.size();
+        auto const capacity = std::max(self.capacity() * 2, used + n);
+        auto storage = std::vector<char, allocator_type>(capacity + 1, self.heap_.get_allocator());
+        if (used)
+            std::memcpy(storage.data(), self.first_, used);
+        self.heap_ = std::move(storage);
+        self.first_ = self.heap_.data();
+        self.cursor_ = self.first_ + used;
+        self.last_ = self.first_ + capacity;
+        return true;
+    }
+};
+
+namespace pmr {
+
+// pmr::growable_builder draws its heap storage from a memory resource,
+// e.g. a std::pmr::monotonic_buffer_resource that is released in one shot
+template <std::size_t InlineCapacity = 0>
+using growable_builder = strings::growable_builder<InlineCapacity, std::pmr::polymorphic_allocator<char>>;
+
+} // namespace pmr
+
+// sink_writer formats into a fixed-size chunk buffer and passes the content
+// to Sink in chunks
+//
+// - Sink is invoked with std::string_view for each flushed chunk
+// - values that do not fit into a chunk are formatted into a temporary heap
+//   buffer, so there is no limit on the size of a single value
+// - call flush() when done, remaining content is not flushed automatically
+//
+template <typename Sink, std::size_t ChunkSize = 1024>
+    requires std::invocable<Sink&, std::string_view>
+struct sink_writer : public writer {
+
+    sink_writer(Sink sink)
+        : writer{chunk_, chunk_ + ChunkSize}
+        , sink_{std::forward<Sink>(sink)}
+    {
+        grow_ = &flush_storage;
+    }
+
+    sink_writer(Sink sink, char fp_decimal)
+        : writer{chunk_, chunk_ + ChunkSize, fp_decimal}
+        , sink_{std::forward<Sink>(sink)}
+    {
+        grow_ = &flush_storage;
+    }
+
+    sink_writer(sink_writer const&) = delete;
+    auto operator=(sink_writer const&) -> sink_writer& = delete;
+
+    // flush passes all of the buffered content to the sink
+    void flush()
+    {
+        if (!empty())
+            sink_(string_view());
+        first_ = cursor_ = chunk_;
+        last_ = chunk_ + ChunkSize;
+        heap_.clear();
+    }
+
+private:
+    char chunk_[ChunkSize];
+    std::vector<char> heap_;
+    Sink sink_;
+
+    static auto flush_storage(writer& w, std::size_t n) -> bool
+    {
+        auto& self = static_cast<sink_writer&>(w);
+        auto const used = self.size();
+        auto const keep = self.pinned_ < used ? self.pinned_ : used;
+        if (keep)
+            self.sink_(std::string_view{self.first_, keep});
+
+        // move the pinned tail (if any) to the front of the storage
+        auto const tail = used - keep;
+        if (tail + n <= ChunkSize) {
+            std::copy(self.first_ + keep, self.cursor_, self.chunk_);
+            self.heap_.clear();
+            self.first_ = self.chunk_;
+            self.last_ = self.chunk_ + ChunkSize;
+        }
+        else {
+            auto const capacity = std::max(self.capacity() * 2, tail + n);
+            auto storage = std::vector<char>(capacity);
+            std::copy(self.first_ + keep, self.cursor_, storage.data());
+            self.heap_ = std::move(storage);
+            self.first_ = self.heap_.data();
+            self.last_ = self.first_ + capacity;
+        }
+        self.cursor_ = self.first_ + tail;
+        if (self.pinned_ != unpinned)
+            self.pinned_ -= keep;
+        return true;
+    }
+};
+
 constexpr auto writer::clear() -> writer&
 {
     cursor_ = first_;
@@ -202,7 +427,7 @@ constexpr auto writer::clear() -> writer&
 
 constexpr auto writer::write_codeunit(char codeunit) -> std::errc
 {
-    if (cursor_ == last_)
+    if (cursor_ == last_ && !grow(1))
         return std::errc::value_too_large;
     *cursor_++ = codeunit;
     return std::errc{};
@@ -212,9 +437,8 @@ constexpr auto writer::write(std::string_view sv) -> std::errc
 {
     if (sv.empty())
         return std::errc{};
-    else if (cursor_ + sv.size() <= last_) {
-        for (auto cp : sv)
-            *cursor_++ = cp;
+    else if (grow(sv.size())) {
+        cursor_ = std::copy(sv.begin(), sv.end(), cursor_);
         return std::errc{};
     }
     else {
@@ -240,15 +464,15 @@ constexpr auto writer::write(T const& v, Args&&... args) -> std::errc
 
     if constexpr (std::is_floating_point_v<T> && (nargs == 0)) {
         auto const spec = sizeof(T) >= 8 ? "%.16g" : "%.7g";
-        auto const n = std::snprintf(cursor_, last_ - cursor_, spec, v);
+        auto const n = put_printf([&](char* buf, std::ptrdiff_t nmax) { return std::snprintf(buf, nmax, spec, v); });
 
         if (n <= 0)
             return std::errc::value_too_large;
 
-        if (fp_decimal_ != '.')
+        if (locale_.decimal != '.')
             for (auto i = 0; i < n; ++i)
                 if (cursor_[i] == '.') {
-                    cursor_[i] = fp_decimal_;
+                    cursor_[i] = locale_.decimal;
                     break;
                 }
 
@@ -257,7 +481,7 @@ constexpr auto writer::write(T const& v, Args&&... args) -> std::errc
     }
     else {
         // integral, and other types that support std::to_chars
-        return check(std::to_chars(cursor_, last_, v, static_cast<Args&&>(args)...));
+        return put_chars([&](char* first, char* last) { return std::to_chars(first, last, v, args...); });
     }
 }
 
@@ -267,7 +491,7 @@ constexpr auto writer::write(T const& value, Args&&... args) -> std::errc
 {
     if constexpr (chars_marshalable<T, Args...>) {
         auto m = chars_marshaler<T>{};
-        return check(m(cursor_, last_, value, std::forward<Args...>(args)...));
+        return put_chars([&](char* first, char* last) { return m(first, last, value, args...); });
     }
     else if constexpr (string_marshalable<T, Args...>) {
         auto m = string_marshaler<T>{};
@@ -277,15 +501,67 @@ constexpr auto writer::write(T const& value, Args&&... args) -> std::errc
         return std::errc::not_supported;
 }
 
+template <typename T> constexpr auto writer::pad(fmt::arg const& a) -> std::errc
+{
+    auto const p = fmt::get_padding<T>(a, fmt::codepoint_count(first_ + pinned_, cursor_));
+    if (!p.before && !p.after)
+        return std::errc{};
+
+    auto const zero_fill = fmt::zero_fill<T>(a);
+    auto const fill = zero_fill ? std::string_view{"0"} : a.fill;
+    auto const before = p.before * fill.size();
+    auto const after = p.after * fill.size();
+    if (!grow(before + after))
+        return std::errc::value_too_large;
+
+    // growing may have moved the content, pinned_ tracks where it starts now
+    auto content = first_ + pinned_;
+    if (zero_fill)
+        content += fmt::number_prefix_size(content, cursor_);
+    if (before) {
+        std::copy_backward(content, cursor_, cursor_ + before);
+        for (auto i = std::size_t{0}; i < p.before; ++i)
+            content = std::copy(fill.begin(), fill.end(), content);
+    }
+    cursor_ += before;
+    for (auto i = std::size_t{0}; i < p.after; ++i)
+        cursor_ = std::copy(fill.begin(), fill.end(), cursor_);
+    return std::errc{};
+}
+
+constexpr auto writer::group() -> std::errc
+{
+    auto const& sep = locale_.thousands_sep;
+    auto const& grouping = locale_.grouping;
+    auto const extra = fmt::grouping_size(first_ + pinned_, cursor_, sep, grouping);
+    if (!extra)
+        return std::errc{};
+    if (!grow(extra))
+        return std::errc::value_too_large;
+    cursor_ = fmt::group_digits(first_ + pinned_, cursor_, sep, grouping);
+    return std::errc{};
+}
+
 template <detail::supported_format_arg T>
 constexpr auto writer::vfmt(T const& v, fmt::arg const& a) -> std::errc
+{
+    // keep the content in the buffer until it is grouped and padded
+    pinned_ = size();
+    auto ec = std::errc{};
+    if (!fmt::engine_padding<T>(a))
+        ec = vfmt_value(v, a);
+    else if (ec = vfmt_value(v, fmt::content_arg<T>(a)); ec == std::errc{})
+        ec = pad<T>(a);
+    pinned_ = unpinned;
+    return ec;
+}
+
+template <detail::supported_format_arg T>
+constexpr auto writer::vfmt_value(T const& v, fmt::arg const& a) -> std::errc
 {
     if constexpr (formattable<T>) {
         auto f = formatter<T>{};
-        auto [ptr, ec] = f(cursor_, last_, v, a);
-        if (ec != std::errc{})
-            return ec;
-        cursor_ = ptr;
+        return put_chars([&](char* first, char* last) { return f(first, last, v, a); });
     }
     else if constexpr (marshalable<T>) {
         return write(v);
@@ -300,12 +576,11 @@ constexpr auto writer::vfmt(T const& v, fmt::arg const& a) -> std::errc
         char pfspec[16];
         if (!fmt::convert_printf_spec<T>(a, pfspec))
             return std::errc::invalid_argument;
-        auto const nmax = last_ - cursor_;
-        auto n = std::snprintf(cursor_, nmax, pfspec, v);
-        if (n <= 0 || n >= nmax)
+        auto n = put_printf([&](char* buf, std::ptrdiff_t nmax) { return std::snprintf(buf, nmax, pfspec, v); });
+        if (n <= 0)
             return std::errc::value_too_large;
         cursor_ += n;
-        return std::errc{};
+        return fmt::group_digits_applies<T>(a) ? group() : std::errc{};
     }
     else if constexpr (std::is_floating_point_v<T>) {
         if (auto fpc = std::fpclassify(v); fpc == FP_ZERO) {
@@ -315,20 +590,19 @@ constexpr auto writer::vfmt(T const& v, fmt::arg const& a) -> std::errc
         char pfspec[16];
         if (!fmt::convert_printf_spec<T>(a, pfspec))
             return std::errc::invalid_argument;
-        auto const nmax = last_ - cursor_;
-        auto n = std::snprintf(cursor_, nmax, pfspec, v);
-        if (n <= 0 || n >= nmax)
+        auto n = put_printf([&](char* buf, std::ptrdiff_t nmax) { return std::snprintf(buf, nmax, pfspec, v); });
+        if (n <= 0)
             return std::errc::value_too_large;
 
-        if (fp_decimal_ != '.')
+        if (locale_.decimal != '.')
             for (auto i = 0; i < n; ++i)
                 if (cursor_[i] == '.') {
-                    cursor_[i] = fp_decimal_;
+                    cursor_[i] = locale_.decimal;
                     break;
                 }
 
         cursor_ += n;
-        return std::errc{};
+        return fmt::group_digits_applies<T>(a) ? group() : std::errc{};
     }
     return std::errc::not_supported;
 }
@@ -337,7 +611,6 @@ template <detail::supported_format_arg... Ts>
 constexpr auto writer::format(std::string_view spec, Ts&&... args) -> std::errc
 {
     auto curr_index = 0;
-    constexpr auto arg_count = sizeof...(args);
     auto t = std::forward_as_tuple(args...);
 
     return fmt::parse_spec(
@@ -351,71 +624,9 @@ constexpr auto writer::format(std::string_view spec, Ts&&... args) -> std::errc
             if (arg_index >= 0)
                 curr_index = arg_index;
 
-            switch (curr_index) {
-            case 0:
-                if constexpr (arg_count < 1)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<0>(t), arg_fmt);
-                break;
-            case 1:
-                if constexpr (arg_count < 2)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<1>(t), arg_fmt);
-                break;
-            case 2:
-                if constexpr (arg_count < 3)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<2>(t), arg_fmt);
-                break;
-            case 3:
-                if constexpr (arg_count < 4)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<3>(t), arg_fmt);
-                break;
-            case 4:
-                if constexpr (arg_count < 5)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<4>(t), arg_fmt);
-                break;
-            case 5:
-                if constexpr (arg_count < 6)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<5>(t), arg_fmt);
-                break;
-            case 6:
-                if constexpr (arg_count < 7)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<6>(t), arg_fmt);
-                break;
-            case 7:
-                if constexpr (arg_count < 8)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<7>(t), arg_fmt);
-                break;
-            case 8:
-                if constexpr (arg_count < 9)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<8>(t), arg_fmt);
-                break;
-            case 9:
-                if constexpr (arg_count < 10)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<9>(t), arg_fmt);
-                break;
-
-            default:
-                return std::errc::invalid_argument;
-            }
+            auto ec = fmt::visit_arg(curr_index, t, [&](auto const& v) { return vfmt(v, arg_fmt); });
+            if (ec != std::errc{})
+                return ec;
             ++curr_index;
 
             return std::errc{};
@@ -10,7 +10,10 @@
 #endif
 
 #if defined(STRINGS_USE_TOCHARS_FLOAT_STUB)
+#include <cerrno>
 #include <cstdio>
+#include <cstdlib>
+#include <string>
 #endif
 
 namespace std {
@@ -75,6 +78,27 @@ inline to_chars_result to_chars(char* first, char* last, T const& value, std::ch
     else
         return {first + n, std::errc{}};
 }
+template <typename T>
+requires std::is_floating_point_v<T>
+inline from_chars_result from_chars(char const* first, char const* last, T& value)
+{
+    auto const s = std::string(first, last); // strto* requires a terminator
+    auto end = (char*)nullptr;
+    errno = 0;
+    auto v = T{};
+    if constexpr (std::is_same_v<T, float>)
+        v = std::strtof(s.c_str(), &end);
+    else if constexpr (std::is_same_v<T, double>)
+        v = std::strtod(s.c_str(), &end);
+    else
+        v = std::strtold(s.c_str(), &end);
+    if (end == s.c_str())
+        return {first, std::errc::invalid_argument};
+    if (errno == ERANGE)
+        return {first + (end - s.c_str()), std::errc::result_out_of_range};
+    value = v;
+    return {first + (end - s.c_str()), std::errc{}};
+}
 #endif
 
 } // namespace std
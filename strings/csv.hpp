@@ -0,0 +1,229 @@
+#pragma once
+
+#include "simd.hpp"
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace strings {
+
+struct csv_dialect {
+    char delimiter = ',';
+    char quote = '"';
+};
+
+constexpr auto csv_format = csv_dialect{',', '"'};
+constexpr auto tsv_format = csv_dialect{'\t', '"'};
+
+// csv_tokenizer splits RFC 4180 style CSV/TSV input into fields
+//
+// - fields are reported as on_field(value, end_of_record)
+// - values are subviews of the fed chunk whenever possible; fields with
+//   doubled quotes, or fields that span chunks, are assembled in a reusable
+//   scratch buffer, so values are only valid during the callback
+// - records end with "\n" or "\r\n"
+// - quoted fields may contain delimiters, quotes (doubled), and line breaks;
+//   characters after a closing quote are kept literally
+// - input can be fed in arbitrary chunks, e.g. from a stream or from an mmap
+//   window, finish() reports the last record if the input does not end with a
+//   line break
+//
+class csv_tokenizer {
+public:
+    explicit csv_tokenizer(csv_dialect dialect = csv_format)
+        : dialect_{dialect}
+    {
+        unquoted_.add(static_cast<unsigned char>(dialect.delimiter));
+        unquoted_.add('\n');
+    }
+
+    void feed(std::string_view chunk, std::invocable<std::string_view, bool> auto&& on_field)
+    {
+        auto const data = chunk.data();
+        auto const n = chunk.size();
+        auto su = detail::scan_state{};
+        auto sq = detail::scan_state{};
+        auto i = std::size_t{0};
+        seg_ = cend_ = 0;
+
+        auto emit = [&](std::size_t end, bool eor) {
+            auto v = std::string_view{};
+            if (in_scratch_) {
+                scratch_.append(data + seg_, end - seg_);
+                v = scratch_;
+            }
+            else
+                v = {data + seg_, end - seg_};
+            if (eor && state_ == state::unquoted && !v.empty() && v.back() == '\r')
+                v.remove_suffix(1);
+            on_field(v, eor);
+            scratch_.clear();
+            in_scratch_ = false;
+            record_open_ = !eor;
+            state_ = state::field_start;
+        };
+
+        while (i < n) {
+            auto const c = data[i];
+            switch (state_) {
+            case state::field_start:
+                record_open_ = true;
+                if (c == dialect_.quote) {
+                    state_ = state::quoted;
+                    seg_ = ++i;
+                    break;
+                }
+                // fast path: consecutive unquoted fields within the chunk
+                while (true) {
+                    auto const p = detail::scan_blocks(n, i, su, [&](std::size_t base, std::size_t count) {
+                        return unquoted_.mask(data, n, base, count);
+                    });
+                    if (p == std::size_t(-1)) {
+                        state_ = state::unquoted;
+                        seg_ = i;
+                        i = n;
+                        break;
+                    }
+                    auto v = std::string_view{data + i, p - i};
+                    auto const eor = data[p] == '\n';
+                    if (eor && !v.empty() && v.back() == '\r')
+                        v.remove_suffix(1);
+                    on_field(v, eor);
+                    i = p + 1;
+                    if (i == n || data[i] == dialect_.quote) {
+                        record_open_ = !eor;
+                        break;
+                    }
+                }
+                break;
+
+            case state::unquoted: {
+                auto const p = detail::scan_blocks(n, i, su, [&](std::size_t base, std::size_t count) {
+                    return unquoted_.mask(data, n, base, count);
+                });
+                if (p == std::size_t(-1)) {
+                    i = n;
+                    break;
+                }
+                emit(p, data[p] == '\n');
+                i = p + 1;
+                break;
+            }
+
+            case state::quoted: {
+                auto const q = dialect_.quote;
+                auto const p = detail::scan_blocks(n, i, sq, [&](std::size_t base, std::size_t count) {
+                    return detail::eq_mask(data, n, base, count, q);
+                });
+                if (p == std::size_t(-1)) {
+                    i = n;
+                    break;
+                }
+                state_ = state::quote;
+                cend_ = p;
+                i = p + 1;
+                break;
+            }
+
+            case state::quote:
+                if (c == dialect_.quote) {
+                    // doubled quote, keep one
+                    scratch_.append(data + seg_, cend_ - seg_);
+                    scratch_ += c;
+                    in_scratch_ = true;
+                    state_ = state::quoted;
+                    seg_ = ++i;
+                }
+                else
+                    state_ = state::closed;
+                break;
+
+            case state::closed:
+                if (c == dialect_.delimiter || c == '\n') {
+                    emit(cend_, c == '\n');
+                    ++i;
+                }
+                else if (c == '\r')
+                    ++i;
+                else {
+                    scratch_.append(data + seg_, cend_ - seg_);
+                    scratch_ += c;
+                    in_scratch_ = true;
+                    seg_ = cend_ = ++i;
+                }
+                break;
+            }
+        }
+
+        // carry the pending content of an incomplete field over to the next chunk
+        switch (state_) {
+        case state::unquoted:
+        case state::quoted:
+            scratch_.append(data + seg_, n - seg_);
+            in_scratch_ = true;
+            break;
+        case state::quote:
+        case state::closed:
+            scratch_.append(data + seg_, cend_ - seg_);
+            in_scratch_ = true;
+            break;
+        default:;
+        }
+    }
+
+    // finish reports the last record if it is not terminated by a line break,
+    // and resets the tokenizer; returns std::errc::invalid_argument if the
+    // input ends inside a quoted field
+    auto finish(std::invocable<std::string_view, bool> auto&& on_field) -> std::errc
+    {
+        auto const ec = state_ == state::quoted ? std::errc::invalid_argument : std::errc{};
+        if (record_open_) {
+            auto v = std::string_view{scratch_};
+            if (state_ == state::unquoted && !v.empty() && v.back() == '\r')
+                v.remove_suffix(1);
+            on_field(v, true);
+        }
+        reset();
+        return ec;
+    }
+
+    void reset()
+    {
+        state_ = state::field_start;
+        scratch_.clear();
+        in_scratch_ = false;
+        record_open_ = false;
+    }
+
+private:
+    enum class state {
+        field_start,
+        unquoted,
+        quoted,
+        quote,  // a quote inside a quoted field, either doubled or closing
+        closed, // after the closing quote
+    };
+
+    csv_dialect dialect_;
+    detail::byte_class unquoted_; // delimiter and line feed
+    state state_ = state::field_start;
+    std::string scratch_;
+    bool in_scratch_ = false;
+    bool record_open_ = false;
+    std::size_t seg_ = 0;  // start of the pending field content in the current chunk
+    std::size_t cend_ = 0; // end of the pending content in the quote and closed states
+};
+
+// csv_for_each tokenizes a complete CSV/TSV buffer, calling
+// on_field(value, end_of_record) for each field
+inline auto csv_for_each(std::string_view input, csv_dialect dialect,
+    std::invocable<std::string_view, bool> auto&& on_field) -> std::errc
+{
+    auto t = csv_tokenizer{dialect};
+    t.feed(input, on_field);
+    return t.finish(on_field);
+}
+
+} // namespace strings
@@ -1,18 +1,29 @@
 #pragma once
 
+#include "ascii.hpp"
+#include "codec.hpp"
 #include "codepoint.hpp"
 #include "fold_simple.hpp"
 #include <concepts>
+#include <optional>
+#include <string>
+#include <string_view>
 
 namespace strings {
 
 namespace fold {
 
-constexpr auto ascii(codepoint cp) -> codepoint
-{
-    // from ascii upper 'A-Z' make ascii lower 'a-z'
-    return (cp.value - unsigned('A') < 26u) ? codepoint{cp.value + unsigned('a' - 'A')} : cp;
-}
+// ascii_folding is the type of fold::ascii, a distinct type lets the
+// pipelines below fold contiguous ascii input in bulk
+struct ascii_folding {
+    constexpr auto operator()(codepoint cp) const -> codepoint
+    {
+        // from ascii upper 'A-Z' make ascii lower 'a-z'
+        return (cp.value - unsigned('A') < 26u) ? codepoint{cp.value + unsigned('a' - 'A')} : cp;
+    }
+};
+
+inline constexpr auto ascii = ascii_folding{};
 
 constexpr auto none(codepoint cp) -> codepoint
 {
@@ -37,6 +48,48 @@ constexpr auto none(codepoint cp) -> codepoint
     return utf::make_decoder(s) >> f;
 }
 
+// ascii_folded_source is the codepoint_source produced by folding contiguous
+// utf8 input with fold::ascii
+//
+// it decodes and folds like the generic pipeline, and in addition lets
+// operator>> into a string copy the remaining input and lowercase it in bulk
+// when the input is pure ascii
+//
+template <codeunit U> class ascii_folded_source {
+public:
+    explicit ascii_folded_source(std::basic_string_view<U> input)
+        : rest_{input}
+    {
+    }
+
+    auto operator()() -> std::optional<codepoint>
+    {
+        if (rest_.empty())
+            return {};
+        auto cp = codepoint{};
+        auto const next = to_codepoint<encoding::utf8>(rest_.begin(), rest_.end(), cp, unexpected_policy::consume_all);
+        rest_.remove_prefix(std::size_t(next - rest_.begin()));
+        auto const have_err = cp.value & errcp::error_bit.value;
+        return fold::ascii((!have_err && unicode::is_valid(cp)) ? cp : unicode::replacement_character);
+    }
+
+    // rest returns the input that has not been decoded yet
+    auto rest() const -> std::basic_string_view<U> { return rest_; }
+
+    void consume() { rest_ = {}; }
+
+private:
+    std::basic_string_view<U> rest_;
+};
+
+template <convertible_to_string_view_input S>
+requires(sizeof(codeunit_type_of<S>) == 1)
+[[nodiscard]] inline auto operator>>(S&& s, fold::ascii_folding)
+{
+    using sv_type = string_view_type_of<S>;
+    return ascii_folded_source<typename sv_type::value_type>{sv_type(s)};
+}
+
 inline void operator>>(codepoint_source auto&& src, codepoint_sink auto&& dst)
 {
     auto c = src();
@@ -52,4 +105,23 @@ template <codeunit U> auto operator>>(codepoint_source auto&& src, std::basic_st
     return dst;
 }
 
+// ascii input folded into a utf8 string is copied and lowercased in bulk
+template <codeunit U, codeunit V>
+auto operator>>(ascii_folded_source<V>&& src, std::basic_string<U>&& dst) -> std::basic_string<U>
+{
+    if constexpr (sizeof(U) == 1) {
+        auto const rest = src.rest();
+        auto const bytes = std::string_view{reinterpret_cast<char const*>(rest.data()), rest.size()};
+        if (ascii::all_of_class(bytes, ascii::char_class::ascii)) {
+            auto const offset = dst.size();
+            dst.append(rest.begin(), rest.end());
+            ascii::to_lower_inplace({reinterpret_cast<char*>(dst.data()) + offset, rest.size()});
+            src.consume();
+            return dst;
+        }
+    }
+    src >> utf::make_encoder(dst);
+    return dst;
+}
+
 } // namespace strings
@@ -1,53 +1,62 @@
 #pragma once
 
+#include "builder.hpp"
 #include "format_locale.hpp"
+#include "formatted_size.hpp"
 #include "marshal_traits.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <utility>
-#include <cassert>
 
 namespace strings {
 
-template <detail::supported_format_arg... Ts>
-auto format_ex(char fp_decimal, std::string_view spec, Ts&&... args) -> std::string
+namespace detail {
+
+// format_append formats the arguments according to spec and appends the
+// result to ret, which can be any std::basic_string<char, ...>
+template <typename String, detail::supported_format_arg... Ts>
+auto format_append(String& ret, numeric_locale const& loc, std::string_view spec, Ts&&... args) -> std::errc
 {
+    auto const fp_decimal = loc.decimal;
     auto curr_index = 0;
 
-    auto ret = std::string{};
-    ret.reserve(spec.size());
-
-    constexpr auto arg_count = sizeof...(args);
     auto t = std::forward_as_tuple(args...);
 
-    constexpr std::size_t buffer_size = 256;
-
-    auto vfmt = [&ret, fp_decimal](auto const& v, fmt::arg const& arg_fmt) {
-        using vtype = std::remove_cvref_t<decltype(v)>;
-
-        if constexpr (formattable<vtype>) {
-            char buf[buffer_size];
-            auto r = formatter<vtype>{}(buf, buf + buffer_size, v, arg_fmt);
+    // put_chars runs a to_chars-like conversion directly into the tail of
+    // ret, doubling the room for it until the conversion fits
+    auto put_chars = [&ret](auto&& conv) -> std::errc {
+        auto const start = ret.size();
+        auto room = std::max(ret.capacity() - start, std::size_t{32});
+        while (true) {
+            ret.resize(start + room);
+            auto r = conv(ret.data() + start, ret.data() + ret.size());
             if (r.ec == std::errc{}) {
-                ret.append(buf, r.ptr);
+                ret.resize(std::size_t(r.ptr - ret.data()));
                 return std::errc{};
             }
-            else
+            ret.resize(start);
+            if (r.ec != std::errc::value_too_large)
                 return r.ec;
+            room *= 2;
+        }
+    };
+
+    auto vfmt_value = [&ret, &put_chars, &loc, fp_decimal](auto const& v, fmt::arg const& arg_fmt) {
+        using vtype = std::remove_cvref_t<decltype(v)>;
+
+        if constexpr (formattable<vtype>) {
+            return put_chars([&](char* first, char* last) { return formatter<vtype>{}(first, last, v, arg_fmt); });
         }
         else if constexpr (string_marshalable<vtype>) {
             ret += string_marshaler<vtype>{}(v);
             return std::errc{};
         }
         else if constexpr (chars_marshalable<vtype>) {
-            char buf[buffer_size];
-            auto r = chars_marshaler<vtype>{}(buf, buf + buffer_size, v);
-            if (r.ec == std::errc{}) {
-                ret.append(buf, r.ptr);
-                return std::errc{};
-            }
-            else
-                return r.ec;
+            return put_chars([&](char* first, char* last) { return chars_marshaler<vtype>{}(first, last, v); });
         }
         else if constexpr (convertible_to_<vtype, std::string_view>) {
             ret += v;
@@ -57,37 +66,68 @@ auto format_ex(char fp_decimal, std::string_view spec, Ts&&... args) -> std::str
             char pfspec[16];
             if (!fmt::convert_printf_spec<vtype>(arg_fmt, pfspec))
                 return std::errc::invalid_argument;
-            char buf[128];
-            auto n = std::snprintf(buf, 128, pfspec, v);
-            assert(n > 0 && n < 128);
+
+            auto const start = ret.size();
+            auto ec = put_chars([&](char* first, char* last) -> std::to_chars_result {
+                auto const nmax = last - first;
+                auto const n = std::snprintf(first, nmax, pfspec, v);
+                if (n < 0)
+                    return {first, std::errc::invalid_argument};
+                if (n >= nmax)
+                    return {last, std::errc::value_too_large};
+                return {first + n, std::errc{}};
+            });
+            if (ec != std::errc{})
+                return ec;
 
             if constexpr (std::is_floating_point_v<vtype>) {
                 if (fp_decimal != '.')
-                    for (auto i = 0; i < n; ++i)
-                        if (buf[i] == '.') {
-                            buf[i] = fp_decimal;
-                            break;
-                        }
+                    if (auto p = ret.find('.', start); p != String::npos)
+                        ret[p] = fp_decimal;
             }
 
-            ret.append(buf, buf + n);
+            if (fmt::group_digits_applies<vtype>(arg_fmt)) {
+                auto const end = ret.size();
+                auto const extra = fmt::grouping_size(ret.data() + start, ret.data() + end, loc.thousands_sep, loc.grouping);
+                if (extra) {
+                    ret.resize(end + extra);
+                    fmt::group_digits(ret.data() + start, ret.data() + end, loc.thousands_sep, loc.grouping);
+                }
+            }
             return std::errc{};
         }
         else if constexpr (to_chars_convertible<vtype>) {
             // custom types that declare std::to_chars
-            char buf[buffer_size];
-            auto r = std::to_chars(buf, buf + buffer_size, v);
-            if (r.ec == std::errc{}) {
-                ret.append(buf, r.ptr);
-                return std::errc{};
-            }
-            else
-                return r.ec;
+            return put_chars([&](char* first, char* last) { return std::to_chars(first, last, v); });
         }
         return std::errc::not_supported;
     };
 
-    auto ec = fmt::parse_spec(
+    auto vfmt = [&ret, &vfmt_value](auto const& v, fmt::arg const& arg_fmt) {
+        using vtype = std::remove_cvref_t<decltype(v)>;
+
+        if (!fmt::engine_padding<vtype>(arg_fmt))
+            return vfmt_value(v, arg_fmt);
+
+        auto const start = ret.size();
+        if (auto ec = vfmt_value(v, fmt::content_arg<vtype>(arg_fmt)); ec != std::errc{})
+            return ec;
+
+        auto const p = fmt::get_padding<vtype>(arg_fmt, fmt::codepoint_count(ret.data() + start, ret.data() + ret.size()));
+        auto const zero_fill = fmt::zero_fill<vtype>(arg_fmt);
+        auto const fill = zero_fill ? std::string_view{"0"} : arg_fmt.fill;
+        if (p.before) {
+            auto const pos = start + (zero_fill ? fmt::number_prefix_size(ret.data() + start, ret.data() + ret.size()) : 0);
+            ret.insert(pos, p.before * fill.size(), ' ');
+            for (auto i = std::size_t{0}; i < p.before; ++i)
+                std::copy(fill.begin(), fill.end(), ret.begin() + pos + i * fill.size());
+        }
+        for (auto i = std::size_t{0}; i < p.after; ++i)
+            ret.append(fill);
+        return std::errc{};
+    };
+
+    return fmt::parse_spec(
         spec.data(), spec.data() + spec.size(), //
         [&](char const* first, char const* last) {
             // handle string segment between arguments
@@ -99,86 +139,111 @@ auto format_ex(char fp_decimal, std::string_view spec, Ts&&... args) -> std::str
             if (arg_index >= 0)
                 curr_index = arg_index;
 
-            switch (curr_index) {
-            case 0:
-                if constexpr (arg_count < 1)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<0>(t), arg_fmt);
-                break;
-            case 1:
-                if constexpr (arg_count < 2)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<1>(t), arg_fmt);
-                break;
-            case 2:
-                if constexpr (arg_count < 3)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<2>(t), arg_fmt);
-                break;
-            case 3:
-                if constexpr (arg_count < 4)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<3>(t), arg_fmt);
-                break;
-            case 4:
-                if constexpr (arg_count < 5)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<4>(t), arg_fmt);
-                break;
-            case 5:
-                if constexpr (arg_count < 6)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<5>(t), arg_fmt);
-                break;
-            case 6:
-                if constexpr (arg_count < 7)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<6>(t), arg_fmt);
-                break;
-            case 7:
-                if constexpr (arg_count < 8)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<7>(t), arg_fmt);
-                break;
-            case 8:
-                if constexpr (arg_count < 9)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<8>(t), arg_fmt);
-                break;
-            case 9:
-                if constexpr (arg_count < 10)
-                    return std::errc::invalid_argument;
-                else
-                    vfmt(std::get<9>(t), arg_fmt);
-                break;
-
-            default:
-                return std::errc::invalid_argument;
-            }
+            auto ec = fmt::visit_arg(curr_index, t, [&](auto const& v) { return vfmt(v, arg_fmt); });
+            if (ec != std::errc{})
+                return ec;
             ++curr_index;
 
             return std::errc{};
         });
+}
+
+} // namespace detail
+
+// format_ex formats using explicitly specified numeric conventions
+template <detail::supported_format_arg... Ts>
+auto format_ex(numeric_locale const& loc, std::string_view spec, Ts&&... args) -> std::string
+{
+    auto ret = std::string{};
+    ret.reserve(detail::reserved_size(loc, spec, args...));
 
-    if (ec == std::errc{})
+    if (detail::format_append(ret, loc, spec, std::forward<Ts>(args)...) == std::errc{})
         return ret;
-    
+
     return "#ERRFMT";
 }
 
+template <detail::supported_format_arg... Ts>
+auto format_ex(char fp_decimal, std::string_view spec, Ts&&... args) -> std::string
+{
+    return format_ex(numeric_locale{fp_decimal}, spec, std::forward<Ts>(args)...);
+}
+
+// format_ex overload that allocates the result from the memory resource mr
+template <detail::supported_format_arg... Ts>
+auto format_ex(std::pmr::memory_resource* mr, numeric_locale const& loc, std::string_view spec, Ts&&... args)
+    -> std::pmr::string
+{
+    auto ret = std::pmr::string{mr};
+    ret.reserve(detail::reserved_size(loc, spec, args...));
+
+    if (detail::format_append(ret, loc, spec, std::forward<Ts>(args)...) == std::errc{})
+        return ret;
+
+    ret.assign("#ERRFMT");
+    return ret;
+}
+
+template <detail::supported_format_arg... Ts>
+auto format_ex(std::pmr::memory_resource* mr, char fp_decimal, std::string_view spec, Ts&&... args)
+    -> std::pmr::string
+{
+    return format_ex(mr, numeric_locale{fp_decimal}, spec, std::forward<Ts>(args)...);
+}
+
+// format uses the current_numeric_locale() of the calling thread
 template <detail::supported_format_arg... Ts>
 auto format(std::string_view spec, Ts&&... args) -> std::string
 {
-    return format_ex(user_decimal, spec, std::forward<Ts>(args)...);
+    return format_ex(current_numeric_locale(), spec, std::forward<Ts>(args)...);
+}
+
+// format_to formats into a string that draws its storage from mr, e.g. a
+// per-request std::pmr::monotonic_buffer_resource
+template <detail::supported_format_arg... Ts>
+auto format_to(std::pmr::memory_resource* mr, std::string_view spec, Ts&&... args) -> std::pmr::string
+{
+    return format_ex(mr, current_numeric_locale(), spec, std::forward<Ts>(args)...);
+}
+
+// format_to streams the formatted content to sink in chunks
+//
+// - sink is invoked with std::string_view for each chunk
+// - returns the first error encountered, content produced up to that point
+//   has already been passed to the sink
+//
+template <typename Sink, detail::supported_format_arg... Ts>
+    requires std::invocable<Sink&, std::string_view>
+auto format_to(Sink&& sink, std::string_view spec, Ts&&... args) -> std::errc
+{
+    auto w = sink_writer<Sink&>{sink};
+    auto ec = w.format(spec, std::forward<Ts>(args)...);
+    w.flush();
+    return ec;
+}
+
+// format_to overload that writes the formatted content to a C stream
+template <detail::supported_format_arg... Ts>
+auto format_to(std::FILE* stream, std::string_view spec, Ts&&... args) -> std::errc
+{
+    auto ec = std::errc{};
+    auto sink = [stream, &ec](std::string_view chunk) {
+        if (std::fwrite(chunk.data(), 1, chunk.size(), stream) != chunk.size() && ec == std::errc{})
+            ec = std::errc::io_error;
+    };
+    auto r = format_to(sink, spec, std::forward<Ts>(args)...);
+    return r != std::errc{} ? r : ec;
+}
+
+// format_to overload that copies the formatted content to an output iterator,
+// e.g. std::back_inserter(str), returns the iterator past the last codeunit
+template <std::output_iterator<char> OutputIt, detail::supported_format_arg... Ts>
+    requires(!std::invocable<OutputIt&, std::string_view>)
+auto format_to(OutputIt out, std::string_view spec, Ts&&... args) -> OutputIt
+{
+    auto sink = [&out](std::string_view chunk) { out = std::copy(chunk.begin(), chunk.end(), out); };
+    format_to(sink, spec, std::forward<Ts>(args)...);
+    return out;
 }
 
-} // namespace strings
\ No newline at end of file
+} // namespace strings
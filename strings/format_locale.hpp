@@ -1,20 +1,82 @@
 #pragma once
 
-#include <clocale>
+#include <locale>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 
 namespace strings {
 
-inline auto get_user_decimal() -> char
+// numeric_locale describes how numbers are presented
+//
+// - string views are not owned, they must outlive the numeric_locale
+// - grouping follows the std::lconv::grouping convention, e.g. "\3" for
+//   thousands, "\3\2" for the indian system, empty for no grouping
+//
+struct numeric_locale {
+    char decimal = '.';
+    std::string_view thousands_sep = ",";
+    std::string_view grouping = "";
+};
+
+namespace detail {
+
+// user_numeric_storage queries the environment locale through std::locale(""),
+// leaving the process-global C locale untouched
+struct user_numeric_storage {
+    numeric_locale loc;
+    std::string thousands_sep = ",";
+    std::string grouping;
+
+    user_numeric_storage()
+    {
+        try {
+            auto const& np = std::use_facet<std::numpunct<char>>(std::locale(""));
+            if (np.decimal_point() == ',')
+                loc.decimal = ',';
+            if (auto sep = np.thousands_sep(); sep != '\0')
+                thousands_sep.assign(1, sep);
+            grouping = np.grouping();
+        }
+        catch (std::runtime_error const&) {
+            // unknown or unsupported environment locale, keep the defaults
+        }
+        loc.thousands_sep = thousands_sep;
+        loc.grouping = grouping;
+    }
+
+    user_numeric_storage(user_numeric_storage const&) = delete;
+    auto operator=(user_numeric_storage const&) -> user_numeric_storage& = delete;
+};
+
+inline thread_local std::optional<numeric_locale> thread_numeric_locale;
+
+} // namespace detail
+
+// user_numeric_locale returns the numeric conventions of the user environment
+// (queried once, on first use)
+inline auto user_numeric_locale() -> numeric_locale const&
+{
+    static auto const storage = detail::user_numeric_storage{};
+    return storage.loc;
+}
+
+// current_numeric_locale returns the numeric locale of the calling thread,
+// which is the user_numeric_locale() unless overridden for the thread
+inline auto current_numeric_locale() -> numeric_locale const&
 {
-    auto ret = char('.');
-    auto prev = std::setlocale(LC_NUMERIC, "");
-    auto ld = std::localeconv();
-    if (ld && ld->decimal_point && ld->decimal_point[0] == ',')
-        ret = ',';
-    std::setlocale(LC_NUMERIC, prev);
-    return ret;
+    if (auto const& loc = detail::thread_numeric_locale)
+        return *loc;
+    return user_numeric_locale();
 }
 
-inline char const user_decimal = get_user_decimal();
+// set_thread_numeric_locale overrides the numeric locale for the calling thread
+inline void set_thread_numeric_locale(numeric_locale const& loc) { detail::thread_numeric_locale = loc; }
+
+// reset_thread_numeric_locale reverts the calling thread to user_numeric_locale()
+inline void reset_thread_numeric_locale() { detail::thread_numeric_locale.reset(); }
+
+inline auto get_user_decimal() -> char { return user_numeric_locale().decimal; }
 
-}
\ No newline at end of file
+} // namespace strings
@@ -1,14 +1,19 @@
 #pragma once
 
+#include <algorithm>
 #include <charconv>
+#include <cstddef>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
 #include <limits>
+#include <utility>
 
 namespace strings::fmt {
 
 struct arg {
-    char align = ' ';          // (ignored) "<" | ">" | "^" (" " if unspecified)
+    std::string_view fill = " "; // single codepoint, points into the format spec
+    char align = ' ';          // "<" | ">" | "^" (" " if unspecified)
     char sign = '-';           // "+" | "-" | " "
     bool zero_padding = false; // "0"
     int width = 0;
@@ -65,7 +70,17 @@ constexpr auto parse_arg(char const* first, char const* last, int& idx, bool& df
         if (first == last)
             return {first, std::errc::invalid_argument};
 
-        if (*first == '<' || *first == '>' || *first == '^') {
+        auto is_align = [](char c) { return c == '<' || c == '>' || c == '^'; };
+
+        // [[fill]align], fill is any utf-8 encoded codepoint except '{' and '}'
+        auto const lead = static_cast<unsigned char>(*first);
+        auto const fill_size = lead < 0xC0u ? 1 : lead < 0xE0u ? 2 : lead < 0xF0u ? 3 : 4;
+        if (last - first > fill_size && is_align(first[fill_size]) && *first != '{' && *first != '}') {
+            arg.fill = std::string_view{first, std::size_t(fill_size)};
+            first += fill_size;
+        }
+
+        if (is_align(*first)) {
             arg.align = *first++;
             if (first == last)
                 return {first, std::errc::invalid_argument};
@@ -179,6 +194,188 @@ constexpr auto parse_spec(char const* first, char const* last, PutStr&& putstr,
     return std::errc{};
 }
 
+// codepoint_count returns the number of utf-8 encoded codepoints in [first, last)
+constexpr auto codepoint_count(char const* first, char const* last) -> std::size_t
+{
+    auto n = std::size_t{0};
+    for (; first != last; ++first)
+        n += (static_cast<unsigned char>(*first) & 0xC0u) != 0x80u;
+    return n;
+}
+
+// engine_padding returns true if width, alignment, and fill are applied by
+// the format engine rather than by the value conversion itself
+//
+// - always the case for strings and custom types
+// - arithmetic values are padded by printf unless an alignment is specified
+//   or digit grouping is requested
+//
+template <typename T> constexpr auto engine_padding(fmt::arg const& a) -> bool
+{
+    if (a.width <= 0)
+        return false;
+    if constexpr (std::is_arithmetic_v<T>)
+        return a.align != ' ' || a.use_locale;
+    else
+        return true;
+}
+
+// zero_fill returns true if the engine padding consists of zeroes inserted
+// after the sign and base prefix of a number ("0" without explicit alignment)
+template <typename T> constexpr auto zero_fill(fmt::arg const& a) -> bool
+{
+    return std::is_arithmetic_v<T> && a.zero_padding && a.align == ' ';
+}
+
+// number_prefix_size returns the number of sign and base prefix codeunits at
+// the start of a number produced by printf
+constexpr auto number_prefix_size(char const* first, char const* last) -> std::size_t
+{
+    auto p = first;
+    if (p != last && (*p == '-' || *p == '+' || *p == ' '))
+        ++p;
+    if (last - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        p += 2;
+    return std::size_t(p - first);
+}
+
+// group_digits_applies returns true if the value is subject to digit grouping
+template <typename T> constexpr auto group_digits_applies(fmt::arg const& a) -> bool
+{
+    return std::is_arithmetic_v<T> && a.use_locale && a.type != 'x' && a.type != 'X';
+}
+
+// separator_count returns the number of separators to insert between n integral
+// digits, grouping follows the std::lconv::grouping convention
+constexpr auto separator_count(std::size_t n, std::string_view grouping) -> std::size_t
+{
+    auto count = std::size_t{0};
+    auto g = std::size_t{0};
+    for (auto i = std::size_t{0};; ++i) {
+        if (i < grouping.size())
+            g = static_cast<unsigned char>(grouping[i]);
+        if (g == 0 || g >= 127 || n <= g) // CHAR_MAX terminates the grouping
+            break;
+        n -= g;
+        ++count;
+    }
+    return count;
+}
+
+// integral_digits locates the first run of decimal digits in [first, last)
+constexpr auto integral_digits(char const* first, char const* last) -> std::pair<std::size_t, std::size_t>
+{
+    auto b = first;
+    while (b != last && unsigned(*b) - unsigned('0') >= 10u)
+        ++b;
+    auto e = b;
+    while (e != last && unsigned(*e) - unsigned('0') < 10u)
+        ++e;
+    return {std::size_t(b - first), std::size_t(e - first)};
+}
+
+// grouping_size returns the number of codeunits group_digits adds to the
+// number in [first, last)
+constexpr auto grouping_size(char const* first, char const* last, std::string_view sep, std::string_view grouping)
+    -> std::size_t
+{
+    auto [b, e] = integral_digits(first, last);
+    return separator_count(e - b, grouping) * sep.size();
+}
+
+// group_digits inserts separators into the integral digits of the number in
+// [first, last) in place, the buffer must have room for grouping_size()
+// more codeunits; returns the new end of the number
+constexpr auto group_digits(char* first, char* last, std::string_view sep, std::string_view grouping) -> char*
+{
+    auto [b, e] = integral_digits(first, last);
+    auto k = separator_count(e - b, grouping);
+    if (!k || sep.empty())
+        return last;
+
+    auto const extra = k * sep.size();
+    std::copy_backward(first + e, last, last + extra);
+
+    // move the digits towards the end group by group, the leading group
+    // ends up in place
+    auto src = first + e;
+    auto dst = src + extra;
+    auto g = std::size_t{0};
+    for (auto i = std::size_t{0}; k; ++i, --k) {
+        if (i < grouping.size())
+            g = static_cast<unsigned char>(grouping[i]);
+        for (auto j = std::size_t{0}; j < g; ++j)
+            *--dst = *--src;
+        dst -= sep.size();
+        std::copy(sep.begin(), sep.end(), dst);
+    }
+    return last + extra;
+}
+
+// content_arg returns the arg to use for converting the value when the
+// padding is applied by the format engine
+template <typename T> constexpr auto content_arg(fmt::arg a) -> fmt::arg
+{
+    if constexpr (std::is_arithmetic_v<T>) {
+        a.width = 0;
+        a.zero_padding = false;
+    }
+    return a;
+}
+
+struct padding {
+    std::size_t before = 0; // number of fill codepoints before the content
+    std::size_t after = 0;  // number of fill codepoints after the content
+};
+
+// get_padding computes the fill required around content that occupies n
+// codepoints, numbers are right-aligned by default, everything else is
+// left-aligned
+template <typename T> constexpr auto get_padding(fmt::arg const& a, std::size_t n) -> padding
+{
+    if (a.width <= 0 || n >= std::size_t(a.width))
+        return {};
+    auto const total = std::size_t(a.width) - n;
+    auto align = a.align;
+    if (align == ' ')
+        align = std::is_arithmetic_v<T> ? '>' : '<';
+    switch (align) {
+    case '>':
+        return {total, 0};
+    case '^':
+        return {total / 2, total - total / 2};
+    default:
+        return {0, total};
+    }
+}
+
+namespace detail {
+template <typename Tuple, typename F, std::size_t... Is>
+constexpr auto visit_arg(std::size_t index, Tuple& args, F& f, std::index_sequence<Is...>) -> std::errc
+{
+    auto ec = std::errc::invalid_argument;
+    ((index == Is && (ec = f(std::get<Is>(args)), true)) || ...);
+    return ec;
+}
+} // namespace detail
+
+// visit_arg calls f with the argument at the specified index
+//
+// - dispatches through a fold over the argument indices, so there is no limit
+//   on the number of arguments and f is inlined for each of them
+// - returns std::errc::invalid_argument if index is out of range
+//
+template <typename F, typename... Ts>
+constexpr auto visit_arg(std::size_t index, std::tuple<Ts...>& args, F&& f) -> std::errc
+{
+    if constexpr (sizeof...(Ts) == 0)
+        return std::errc::invalid_argument;
+    else if (index >= sizeof...(Ts))
+        return std::errc::invalid_argument;
+    else
+        return detail::visit_arg(index, args, f, std::index_sequence_for<Ts...>{});
+}
+
 template <typename T> constexpr auto convert_printf_spec(fmt::arg const& a, char* pfspec) -> bool
 {
     *pfspec++ = '%';
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "format_locale.hpp"
+#include "format_spec.hpp"
+#include "marshal_traits.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace strings {
+
+namespace detail {
+
+constexpr auto count_digits(unsigned long long u, unsigned base) -> std::size_t
+{
+    auto n = std::size_t{1};
+    while (u >= base) {
+        u /= base;
+        ++n;
+    }
+    return n;
+}
+
+constexpr auto apply_width(std::size_t n, fmt::arg const& a) -> std::size_t
+{
+    // mirrors fmt::convert_printf_spec which only supports widths below 100
+    if (a.width > 0 && a.width < 100 && n < std::size_t(a.width))
+        return std::size_t(a.width);
+    return n;
+}
+
+// integer_formatted_size returns the exact number of codeunits produced for
+// an integral value formatted with the printf spec built by
+// fmt::convert_printf_spec, including the digit grouping separators
+template <typename T>
+constexpr auto integer_formatted_size(T v, fmt::arg const& a, numeric_locale const& loc = {}) -> std::size_t
+{
+    using U = std::make_unsigned_t<std::conditional_t<std::is_same_v<T, bool>, unsigned char, T>>;
+
+    auto const hex = a.type == 'x' || a.type == 'X';
+    auto neg = false;
+    auto u = U(v);
+    if constexpr (std::is_signed_v<T>)
+        if (!hex && v < 0) {
+            neg = true;
+            u = U(U(0) - u);
+        }
+
+    auto n = count_digits(u, hex ? 16 : 10);
+    if (a.precision >= 0 && a.precision < 100) {
+        if (a.precision == 0 && u == 0)
+            n = 0;
+        else if (n < std::size_t(a.precision))
+            n = std::size_t(a.precision);
+    }
+    if (fmt::group_digits_applies<T>(a))
+        n += fmt::separator_count(n, loc.grouping) * loc.thousands_sep.size();
+
+    if (hex) {
+        if (a.alternate_form && u != 0)
+            n += 2; // "0x"
+    }
+    else if (neg)
+        ++n;
+    else if constexpr (std::is_signed_v<T>)
+        if (a.sign != '-')
+            ++n; // '+' or ' '
+
+    return apply_width(n, a);
+}
+
+// float_formatted_size returns an upper bound for the number of codeunits
+// produced for a floating point value formatted with the printf spec built by
+// fmt::convert_printf_spec
+template <typename T>
+inline auto float_formatted_size(T v, fmt::arg const& a, numeric_locale const& loc = {}) -> std::size_t
+{
+    auto t = a.type;
+    auto p = a.precision;
+    if (t == ' ') {
+        t = 'g';
+        if (p < 0)
+            p = std::numeric_limits<T>::max_digits10 - 3;
+    }
+    if (p < 0 || p >= 100)
+        p = 6; // printf default
+
+    constexpr auto exp_digits = std::size_t(std::is_same_v<std::remove_cv_t<T>, long double> ? 4 : 3);
+    auto const pn = std::size_t(p);
+
+    auto n = std::size_t{1}; // sign
+    if (!std::isfinite(v))
+        return apply_width(n + 3, a);
+
+    auto separators = [&](std::size_t digits) -> std::size_t {
+        if (!fmt::group_digits_applies<T>(a))
+            return 0;
+        return fmt::separator_count(digits, loc.grouping) * loc.thousands_sep.size();
+    };
+
+    switch (t | 32) {
+    case 'f': {
+        auto const u = std::abs(v);
+        // one extra digit for rounding up, e.g. 9.99 -> "10.0"
+        auto const int_digits = u < T(1) ? std::size_t{2} : std::size_t(std::log10(u)) + 2;
+        n += int_digits + separators(int_digits) + 1 + pn;
+        break;
+    }
+    case 'e':
+        n += 1 + 1 + pn + 2 + exp_digits; // d.ddde+xxx
+        break;
+    default: {
+        // 'g' uses at most p significant digits, either as 0.000ddd or d.ddde+xxx
+        auto const sig = pn ? pn : 1;
+        n += std::max(sig + 5, sig + 3 + exp_digits) + separators(sig);
+    }
+    }
+    return apply_width(n, a);
+}
+
+// formatted_value_size follows the same value conversion rules as format_ex,
+// it also reports the number of codepoints that are subject to padding
+template <supported_format_arg T>
+auto formatted_value_size(T const& v, fmt::arg const& a, numeric_locale const& loc, std::size_t& codepoints)
+    -> std::size_t
+{
+    constexpr std::size_t buffer_size = 256;
+
+    // measure runs a to_chars-like conversion into a stack buffer, values that
+    // do not fit are converted into a heap buffer doubled until they do, as
+    // format_append does; returns 0 only if the conversion fails
+    auto measure = [&codepoints](auto&& conv) -> std::size_t {
+        auto count = [&codepoints](char const* first, char const* last) {
+            codepoints = fmt::codepoint_count(first, last);
+            return std::size_t(last - first);
+        };
+        char buf[buffer_size];
+        auto r = conv(buf, buf + buffer_size);
+        if (r.ec == std::errc{})
+            return count(buf, r.ptr);
+        auto heap = std::string{};
+        for (auto room = 2 * buffer_size; r.ec == std::errc::value_too_large; room *= 2) {
+            heap.resize(room);
+            r = conv(heap.data(), heap.data() + heap.size());
+            if (r.ec == std::errc{})
+                return count(heap.data(), r.ptr);
+        }
+        return 0;
+    };
+
+    auto measure_sv = [&codepoints](std::string_view sv) -> std::size_t {
+        codepoints = fmt::codepoint_count(sv.data(), sv.data() + sv.size());
+        return sv.size();
+    };
+
+    if constexpr (formattable<T>) {
+        return measure([&](char* first, char* last) { return formatter<T>{}(first, last, v, a); });
+    }
+    else if constexpr (string_marshalable<T>) {
+        return measure_sv(string_marshaler<T>{}(v));
+    }
+    else if constexpr (chars_marshalable<T>) {
+        return measure([&](char* first, char* last) { return chars_marshaler<T>{}(first, last, v); });
+    }
+    else if constexpr (convertible_to_<T, std::string_view>) {
+        return measure_sv(std::string_view(v));
+    }
+    else if constexpr (std::is_integral_v<T>) {
+        auto const n = integer_formatted_size(v, a, loc);
+        auto const ungrouped = integer_formatted_size(v, a);
+        auto const& sep = loc.thousands_sep;
+        auto const sep_codepoints = fmt::codepoint_count(sep.data(), sep.data() + sep.size());
+        codepoints = sep.empty() ? n : ungrouped + (n - ungrouped) / sep.size() * sep_codepoints;
+        return n;
+    }
+    else if constexpr (std::is_floating_point_v<T>) {
+        // the content length is only an upper bound here, assume the widest
+        // padding when the fill is wider than the content codeunits
+        auto const n = float_formatted_size(v, a, loc);
+        codepoints = a.fill.size() == 1 ? n : 0;
+        return n;
+    }
+    else if constexpr (to_chars_convertible<T>) {
+        return measure([&](char* first, char* last) { return std::to_chars(first, last, v); });
+    }
+    return 0;
+}
+
+// formatted_arg_size includes the padding applied by the format engine
+template <supported_format_arg T>
+auto formatted_arg_size(T const& v, fmt::arg const& a, numeric_locale const& loc) -> std::size_t
+{
+    auto codepoints = std::size_t{0};
+    if (!fmt::engine_padding<T>(a))
+        return formatted_value_size(v, a, loc, codepoints);
+
+    auto const n = formatted_value_size(v, fmt::content_arg<T>(a), loc, codepoints);
+    auto const p = fmt::get_padding<T>(a, codepoints);
+    auto const fill_size = fmt::zero_fill<T>(a) ? std::size_t{1} : a.fill.size();
+    return n + (p.before + p.after) * fill_size;
+}
+
+// cheap_to_measure is true for the argument types that are measured without
+// converting them: strings, integers, and floating point values
+template <typename T>
+constexpr bool cheap_to_measure = !formattable<T> && !string_marshalable<T> && !chars_marshalable<T> &&
+                                  (convertible_to_<T, std::string_view> || std::is_arithmetic_v<T>);
+
+// spec_size sums the literal text and the argument sizes of spec, with
+// CheapOnly the other arguments are counted as empty instead of converted
+template <bool CheapOnly, supported_format_arg... Ts>
+auto spec_size(numeric_locale const& loc, std::string_view spec, Ts const&... args) -> std::size_t
+{
+    auto curr_index = 0;
+    auto total = std::size_t{0};
+    auto t = std::forward_as_tuple(args...);
+
+    auto ec = fmt::parse_spec(
+        spec.data(), spec.data() + spec.size(), //
+        [&](char const* first, char const* last) {
+            total += std::size_t(last - first);
+            return std::errc{};
+        },
+        [&](int arg_index, bool, fmt::arg const& arg_fmt) {
+            if (arg_index >= 0)
+                curr_index = arg_index;
+
+            auto visit_ec = fmt::visit_arg(curr_index, t, [&](auto const& v) {
+                if constexpr (!CheapOnly || cheap_to_measure<std::remove_cvref_t<decltype(v)>>)
+                    total += formatted_arg_size(v, arg_fmt, loc);
+                return std::errc{};
+            });
+            if (visit_ec != std::errc{})
+                return visit_ec;
+            ++curr_index;
+            return std::errc{};
+        });
+
+    return ec == std::errc{} ? total : 0;
+}
+
+// reserved_size is the capacity format_ex reserves up front: the exact or
+// upper bound size of the cheap to measure parts, user-defined conversions
+// are not run twice and the output grows for them instead
+template <supported_format_arg... Ts>
+auto reserved_size(numeric_locale const& loc, std::string_view spec, Ts const&... args) -> std::size_t
+{
+    return spec_size<true>(loc, spec, args...);
+}
+
+} // namespace detail
+
+// formatted_size computes the length of the format/format_ex output without
+// producing it
+//
+// - exact for strings, integers, and marshalable/formattable types
+// - a tight upper bound for floating point values
+// - returns 0 if spec is malformed or refers to missing arguments
+//
+template <detail::supported_format_arg... Ts>
+auto formatted_size(numeric_locale const& loc, std::string_view spec, Ts const&... args) -> std::size_t
+{
+    return detail::spec_size<false>(loc, spec, args...);
+}
+
+// formatted_size overload that uses the current_numeric_locale()
+template <detail::supported_format_arg... Ts>
+auto formatted_size(std::string_view spec, Ts const&... args) -> std::size_t
+{
+    return formatted_size(current_numeric_locale(), spec, args...);
+}
+
+} // namespace strings
@@ -2,11 +2,14 @@
 
 #include "ascii.hpp"
 #include "format_locale.hpp"
+#include "format_spec.hpp"
 #include <algorithm>
 #include <charconv>
 #include <clocale>
 #include <cmath>
 #include <concepts>
+#include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -19,6 +22,8 @@ namespace appearance {
 
 struct separators {
     char decimal = '.'; // we only support single-byte decimal separators here
+    std::string_view thousands = ","; // digit group separator
+    std::string_view grouping = "";   // std::lconv::grouping convention, empty for no grouping
 };
 
 struct sign {
@@ -49,16 +54,18 @@ struct locale : public appearance::separators,
 
     constexpr locale() noexcept = default;
 
+    // ascii and unicode presets use the decimal separator of the
+    // current_numeric_locale() of the calling thread
     static auto ascii()
     {
         auto ret = locale{};
-        ret.decimal = user_decimal;
+        ret.decimal = current_numeric_locale().decimal;
         return ret;
     }
     static auto unicode()
     {
         auto ret = locale{};
-        ret.decimal = user_decimal;
+        ret.decimal = current_numeric_locale().decimal;
         ret.plus = "";      // no prefix for positive numbers
         ret.minus = "−";    // U+2212 - use unicode mathematical minus instead of ascii dash
         ret.infinity = "∞"; // U+221E
@@ -88,6 +95,24 @@ struct locale : public appearance::separators,
         return ret;
     }
 
+    // ascii and unicode presets with the separators and digit grouping of a
+    // numeric_locale
+    static constexpr auto ascii(numeric_locale const& nl)
+    {
+        auto ret = ascii(nl.decimal);
+        ret.thousands = nl.thousands_sep;
+        ret.grouping = nl.grouping;
+        return ret;
+    }
+
+    static constexpr auto unicode(numeric_locale const& nl)
+    {
+        auto ret = unicode(nl.decimal);
+        ret.thousands = nl.thousands_sep;
+        ret.grouping = nl.grouping;
+        return ret;
+    }
+
     friend constexpr auto operator|(locale const& l, appearance::modifier auto const& a) -> locale
     {
         using modifier_type = std::remove_cvref_t<decltype(a)>;
@@ -171,6 +196,10 @@ constexpr auto sci_exp_value(char const* first, char const* last) -> std::option
     return v * sign;
 }
 
+constexpr std::string_view superscript_digits[10] = {"⁰", "¹", "²", "³", "⁴", "⁵", "⁶", "⁷", "⁸", "⁹"};
+constexpr std::string_view superscript_minus = "⁻";
+constexpr std::string_view superscript_plus = "⁺";
+
 constexpr auto exp_to_chars(char* first, char* last, std::string_view prefix, int exp, std::string_view plus,
     std::string_view minus, bool use_superscript) -> std::to_chars_result
 {
@@ -186,7 +215,7 @@ constexpr auto exp_to_chars(char* first, char* last, std::string_view prefix, in
 
     auto n = prefix.size() + sign.size();
 
-    constexpr std::string_view ss[10] = {"⁰", "¹", "²", "³", "⁴", "⁵", "⁶", "⁷", "⁸", "⁹"};
+    constexpr auto& ss = superscript_digits;
 
     if (!use_superscript)
         n += d1 ? 2 : 1;
@@ -321,6 +350,9 @@ inline auto to_chars(char* first, char* last, T const v, settings const& setting
     else
         first = r.ptr;
 
+    if (fpc == FP_INFINITE)
+        return detail::to_chars(first, last, locale.infinity);
+
     std::size_t trim_pos, exp_pos;
     auto r = detail::for_trimming_(first, last, u, settings, trim_pos, exp_pos);
     if (r.ec != std::errc{})
@@ -330,6 +362,14 @@ inline auto to_chars(char* first, char* last, T const v, settings const& setting
         if (auto p = std::string_view{first, std::size_t(r.ptr - first)}.find('.'); p != std::string_view::npos)
             first[p] = locale.decimal;
 
+    if (auto extra = fmt::grouping_size(first, r.ptr, locale.thousands, locale.grouping); extra) {
+        if (std::size_t(last - r.ptr) < extra)
+            return {last, std::errc::value_too_large};
+        r.ptr = fmt::group_digits(first, r.ptr, locale.thousands, locale.grouping);
+        trim_pos += extra;
+        exp_pos += extra;
+    }
+
     if (first + exp_pos == r.ptr) {
         if (first + trim_pos != r.ptr)
             r.ptr = first + trim_pos;
@@ -347,7 +387,7 @@ inline auto to_chars(char* first, char* last, T const v, settings const& setting
     auto l_minus = std::string_view{locale.minus};
     if (locale.exp_super) {
         l_plus = {};
-        l_minus = "⁻";
+        l_minus = detail::superscript_minus;
     }
 
     return detail::exp_to_chars(r.ptr, last, locale.exp_prefix, *exp, l_plus, l_minus, locale.exp_super);
@@ -381,4 +421,236 @@ inline auto to_string(T const v, settings const& settings, locale const& locale)
     return badval;
 }
 
-} // namespace strings::fp
\ No newline at end of file
+namespace detail {
+
+constexpr auto starts_with(char const* first, char const* last, std::string_view s) -> bool
+{
+    return !s.empty() && std::size_t(last - first) >= s.size() && std::string_view{first, s.size()} == s;
+}
+
+constexpr auto starts_with_nocase(char const* first, char const* last, std::string_view lower_s) -> bool
+{
+    if (std::size_t(last - first) < lower_s.size())
+        return false;
+    for (auto c : lower_s)
+        if (char(ascii::lower(unsigned(*first++))) != c)
+            return false;
+    return true;
+}
+
+// superscript_digit returns 0..9 if [first, last) starts with a superscript
+// digit, and advances first past it; returns -1 otherwise
+constexpr auto superscript_digit(char const*& first, char const* last) -> int
+{
+    for (auto d = 0; d < 10; ++d)
+        if (starts_with(first, last, superscript_digits[d])) {
+            first += superscript_digits[d].size();
+            return d;
+        }
+    return -1;
+}
+
+// parse_exponent reads an exponent value at first, either with ascii or
+// superscript digits, returns nullptr if there are no digits
+constexpr auto parse_exponent(char const* first, char const* last, bool super, std::string_view plus,
+    std::string_view minus, int& exp) -> char const*
+{
+    auto neg = false;
+    if (super && starts_with(first, last, superscript_minus)) {
+        neg = true;
+        first += superscript_minus.size();
+    }
+    else if (super && starts_with(first, last, superscript_plus))
+        first += superscript_plus.size();
+    else if (starts_with(first, last, minus)) {
+        neg = true;
+        first += minus.size();
+    }
+    else if (starts_with(first, last, plus))
+        first += plus.size();
+    else if (first != last && (*first == '-' || *first == '+'))
+        neg = *first++ == '-';
+
+    auto v = 0;
+    auto digits = 0;
+    while (first != last) {
+        auto d = super ? superscript_digit(first, last) : digit_val(*first);
+        if (d < 0)
+            break;
+        if (!super)
+            ++first;
+        if (v < 100000)
+            v = v * 10 + d;
+        ++digits;
+    }
+    if (!digits)
+        return nullptr;
+    exp = neg ? -v : v;
+    return first;
+}
+
+template <std::floating_point T> struct fast_path_limits;
+template <> struct fast_path_limits<float> {
+    static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 24;
+    static constexpr int max_exp10 = 10;
+};
+template <> struct fast_path_limits<double> {
+    static constexpr std::uint64_t max_mantissa = std::uint64_t(1) << 53;
+    static constexpr int max_exp10 = 22;
+};
+template <> struct fast_path_limits<long double> {
+    // the width of long double varies between platforms, always use the
+    // exact fallback
+    static constexpr std::uint64_t max_mantissa = 0;
+    static constexpr int max_exp10 = -1;
+};
+
+constexpr double exact_powers_of_ten[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+} // namespace detail
+
+// from_chars parses all the forms produced by fp::to_chars with the
+// specified locale
+//
+// - signs: locale.minus/locale.plus as well as ascii '-' and '+'
+// - specials: locale.infinity, locale.notanumber, and ascii inf/infinity/nan
+// - locale.decimal, and locale.thousands between integral digits when
+//   locale.grouping is set
+// - exponents: 'e'/'E' with ascii digits, or locale.exp_prefix followed by
+//   superscript (locale.exp_super) or ascii digits
+//
+// Values with up to 19 significant digits and small exponents are converted
+// exactly with a pair of floating point operations (Clinger's fast path);
+// the rest is normalized into ascii and handed to std::from_chars, which
+// provides the correctly rounded Eisel-Lemire conversion.
+//
+template <std::floating_point T>
+inline auto from_chars(char const* first, char const* last, T& value, locale const& locale = {})
+    -> std::from_chars_result
+{
+    auto const start = first;
+    auto neg = false;
+
+    if (detail::starts_with(first, last, locale.minus)) {
+        neg = true;
+        first += locale.minus.size();
+    }
+    else if (detail::starts_with(first, last, locale.plus))
+        first += locale.plus.size();
+    else if (first != last && (*first == '-' || *first == '+'))
+        neg = *first++ == '-';
+
+    // specials
+    auto special = [&](T v, char const* end) -> std::from_chars_result {
+        value = neg ? -v : v;
+        return {end, std::errc{}};
+    };
+    if (detail::starts_with(first, last, locale.infinity))
+        return special(std::numeric_limits<T>::infinity(), first + locale.infinity.size());
+    if (detail::starts_with(first, last, locale.notanumber))
+        return special(std::numeric_limits<T>::quiet_NaN(), first + locale.notanumber.size());
+    if (detail::starts_with_nocase(first, last, "infinity"))
+        return special(std::numeric_limits<T>::infinity(), first + 8);
+    if (detail::starts_with_nocase(first, last, "inf"))
+        return special(std::numeric_limits<T>::infinity(), first + 3);
+    if (detail::starts_with_nocase(first, last, "nan"))
+        return special(std::numeric_limits<T>::quiet_NaN(), first + 3);
+
+    // mantissa: accumulate up to 19 significant digits
+    auto const mantissa_first = first;
+    auto const grouped = !locale.grouping.empty() && !locale.thousands.empty();
+    auto w = std::uint64_t{0};
+    auto exp10 = 0;
+    auto digits = 0;
+    auto significant = 0;
+    auto truncated = false;
+
+    auto put_digit = [&](int d, bool fraction) {
+        ++digits;
+        if (significant < 19) {
+            if (w || d) {
+                w = w * 10 + unsigned(d);
+                ++significant;
+            }
+            if (fraction)
+                --exp10;
+        }
+        else {
+            truncated |= d != 0;
+            if (!fraction)
+                ++exp10;
+        }
+    };
+
+    while (first != last) {
+        if (auto d = detail::digit_val(*first); d >= 0) {
+            put_digit(d, false);
+            ++first;
+        }
+        else if (grouped && digits && *first != locale.decimal &&
+                 detail::starts_with(first, last, locale.thousands) && first + locale.thousands.size() != last &&
+                 detail::is_digit(first[locale.thousands.size()]))
+            first += locale.thousands.size();
+        else
+            break;
+    }
+    if (first != last && *first == locale.decimal) {
+        auto p = first + 1;
+        auto const int_digits = digits;
+        for (; p != last && detail::is_digit(*p); ++p)
+            put_digit(detail::digit_val(*p), true);
+        if (digits != int_digits || int_digits)
+            first = p;
+    }
+    auto const mantissa_last = first;
+    if (!digits)
+        return {start, std::errc::invalid_argument};
+
+    // exponent
+    auto exp = 0;
+    if (first != last && (*first == 'e' || *first == 'E')) {
+        if (auto p = detail::parse_exponent(first + 1, last, false, locale.plus, locale.minus, exp))
+            first = p;
+    }
+    else if (detail::starts_with(first, last, locale.exp_prefix)) {
+        auto const p = first + locale.exp_prefix.size();
+        if (auto q = detail::parse_exponent(p, last, locale.exp_super, locale.plus, locale.minus, exp))
+            first = q;
+    }
+
+    using limits = detail::fast_path_limits<T>;
+    auto const e = exp10 + exp;
+    if (!truncated && w <= limits::max_mantissa && e >= -limits::max_exp10 && e <= limits::max_exp10) {
+        auto v = T(w);
+        if (e < 0)
+            v /= T(detail::exact_powers_of_ten[-e]);
+        else
+            v *= T(detail::exact_powers_of_ten[e]);
+        value = neg ? -v : v;
+        return {first, std::errc{}};
+    }
+
+    // exact fallback: normalize to "-ddd.ddde[-]xxx" and let std::from_chars round
+    auto buf = std::string{};
+    buf.reserve(std::size_t(mantissa_last - mantissa_first) + 16);
+    if (neg)
+        buf += '-';
+    for (auto p = mantissa_first; p != mantissa_last; ++p)
+        if (detail::is_digit(*p))
+            buf += *p;
+        else if (*p == locale.decimal)
+            buf += '.';
+    if (exp) {
+        char ebuf[16];
+        auto r = std::to_chars(ebuf, ebuf + sizeof(ebuf), exp);
+        buf += 'e';
+        buf.append(ebuf, r.ptr);
+    }
+    auto r = std::from_chars(buf.data(), buf.data() + buf.size(), value);
+    if (r.ec == std::errc::invalid_argument)
+        return {start, r.ec};
+    return {first, r.ec};
+}
+
+} // namespace strings::fp
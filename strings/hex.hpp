@@ -0,0 +1,180 @@
+#pragma once
+
+#include "ascii.hpp"
+#include "simd.hpp"
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace strings {
+
+enum class hex_case {
+    lower,
+    upper,
+};
+
+namespace detail {
+
+constexpr char hex_digits_lower[] = "0123456789abcdef";
+constexpr char hex_digits_upper[] = "0123456789ABCDEF";
+
+// hex_values maps each codeunit to its ascii::hex value, or 0xff
+constexpr auto hex_values = [] {
+    auto t = std::array<std::uint8_t, 256>{};
+    for (auto c = 0u; c < 256u; ++c) {
+        auto const v = ascii::hex(c);
+        t[c] = v < 16u ? std::uint8_t(v) : std::uint8_t(0xff);
+    }
+    return t;
+}();
+
+inline void hex_encode_scalar(std::byte const* src, std::size_t n, char* dst, hex_case hc)
+{
+    auto const digits = hc == hex_case::upper ? hex_digits_upper : hex_digits_lower;
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto const b = unsigned(src[i]);
+        *dst++ = digits[b >> 4];
+        *dst++ = digits[b & 15];
+    }
+}
+
+// hex_decode_scalar returns the number of decoded bytes, stopping at the first
+// pair that contains a non-hex character
+inline auto hex_decode_scalar(char const* src, std::size_t n, std::byte* dst) -> std::size_t
+{
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto const hi = hex_values[std::uint8_t(src[2 * i])];
+        auto const lo = hex_values[std::uint8_t(src[2 * i + 1])];
+        if ((hi | lo) & 0xf0)
+            return i;
+        dst[i] = std::byte(hi << 4 | lo);
+    }
+    return n;
+}
+
+#ifdef STRINGS_SSE2
+
+// hex_encode_sse2 converts 16 bytes per step, returns the number of bytes
+// converted
+inline auto hex_encode_sse2(std::byte const* src, std::size_t n, char* dst, hex_case hc) -> std::size_t
+{
+    auto const mask = _mm_set1_epi8(0x0f);
+    auto const nine = _mm_set1_epi8(9);
+    auto const zero = _mm_set1_epi8('0');
+    auto const alpha = _mm_set1_epi8(char(hc == hex_case::upper ? 'A' - '9' - 1 : 'a' - '9' - 1));
+
+    auto to_ascii = [&](__m128i v) {
+        return _mm_add_epi8(_mm_add_epi8(v, zero), _mm_and_si128(_mm_cmpgt_epi8(v, nine), alpha));
+    };
+
+    auto i = std::size_t{0};
+    for (; i + 16 <= n; i += 16) {
+        auto const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(src + i));
+        auto const hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+        auto const lo = _mm_and_si128(v, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * i), to_ascii(_mm_unpacklo_epi8(hi, lo)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * i + 16), to_ascii(_mm_unpackhi_epi8(hi, lo)));
+    }
+    return i;
+}
+
+// hex_decode_sse2 converts 32 characters into 16 bytes per step, returns the
+// number of bytes converted, stopping before a block with non-hex characters
+inline auto hex_decode_sse2(char const* src, std::size_t n, std::byte* dst) -> std::size_t
+{
+    auto const lower_bit = _mm_set1_epi8(0x20);
+    auto const byte_mask = _mm_set1_epi16(0x00ff);
+
+    // nibbles returns the values of 16 hex characters, and sets ok to false
+    // if any of them is not a hex digit
+    auto nibbles = [&](__m128i c, bool& ok) {
+        auto const is_dec = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), //
+            _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+        auto const cl = _mm_or_si128(c, lower_bit);
+        auto const is_alpha = _mm_and_si128(_mm_cmpgt_epi8(cl, _mm_set1_epi8('a' - 1)), //
+            _mm_cmplt_epi8(cl, _mm_set1_epi8('f' + 1)));
+        ok = ok && _mm_movemask_epi8(_mm_or_si128(is_dec, is_alpha)) == 0xffff;
+        return _mm_or_si128(_mm_and_si128(is_dec, _mm_sub_epi8(c, _mm_set1_epi8('0'))),
+            _mm_and_si128(is_alpha, _mm_sub_epi8(cl, _mm_set1_epi8('a' - 10))));
+    };
+
+    // pack combines nibble pairs [hi, lo] into bytes, one per 16-bit lane
+    auto pack = [&](__m128i v) {
+        return _mm_or_si128(_mm_and_si128(_mm_slli_epi16(v, 4), byte_mask), _mm_srli_epi16(v, 8));
+    };
+
+    auto i = std::size_t{0};
+    for (; i + 16 <= n; i += 16) {
+        auto ok = true;
+        auto const a = nibbles(_mm_loadu_si128(reinterpret_cast<__m128i const*>(src + 2 * i)), ok);
+        auto const b = nibbles(_mm_loadu_si128(reinterpret_cast<__m128i const*>(src + 2 * i + 16)), ok);
+        if (!ok)
+            break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(pack(a), pack(b)));
+    }
+    return i;
+}
+
+#endif
+
+} // namespace detail
+
+// hex_encoded_size returns the number of characters hex_encode produces
+constexpr auto hex_encoded_size(std::size_t bytes) -> std::size_t { return bytes * 2; }
+
+// hex_encode writes two hex digits per input byte into [first, last)
+inline auto hex_encode(std::span<std::byte const> in, char* first, char* last, hex_case hc = hex_case::lower)
+    -> std::to_chars_result
+{
+    if (std::size_t(last - first) < hex_encoded_size(in.size()))
+        return {last, std::errc::value_too_large};
+
+    auto i = std::size_t{0};
+#ifdef STRINGS_SSE2
+    i = detail::hex_encode_sse2(in.data(), in.size(), first, hc);
+#endif
+    detail::hex_encode_scalar(in.data() + i, in.size() - i, first + 2 * i, hc);
+    return {first + hex_encoded_size(in.size()), std::errc{}};
+}
+
+inline auto hex_encode(std::span<std::byte const> in, hex_case hc = hex_case::lower) -> std::string
+{
+    auto s = std::string(hex_encoded_size(in.size()), '\0');
+    hex_encode(in, s.data(), s.data() + s.size(), hc);
+    return s;
+}
+
+// hex_decode converts pairs of hex digits (in either case) into bytes
+//
+// - returns ptr past the consumed input and the decoded bytes in out
+// - std::errc::invalid_argument: ptr refers to the first non-hex character,
+//   or to the last character of an odd-sized input
+// - std::errc::value_too_large: out is smaller than in.size() / 2, nothing is
+//   decoded
+//
+inline auto hex_decode(std::string_view in, std::span<std::byte> out) -> std::from_chars_result
+{
+    auto const n = in.size() / 2;
+    if (out.size() < n)
+        return {in.data(), std::errc::value_too_large};
+
+    auto i = std::size_t{0};
+#ifdef STRINGS_SSE2
+    i = detail::hex_decode_sse2(in.data(), n, out.data());
+#endif
+    i += detail::hex_decode_scalar(in.data() + 2 * i, n - i, out.data() + i);
+    if (i != n) {
+        auto const p = in.data() + 2 * i;
+        return {detail::hex_values[std::uint8_t(p[0])] < 16 ? p + 1 : p, std::errc::invalid_argument};
+    }
+    if (in.size() % 2)
+        return {in.data() + in.size() - 1, std::errc::invalid_argument};
+    return {in.data() + in.size(), std::errc{}};
+}
+
+} // namespace strings
@@ -1,9 +1,15 @@
 #pragma once
 
+#include "builder.hpp"
+#include "codepoint.hpp"
+#include <algorithm>
 #include <concepts>
 #include <cstring>
 #include <cwchar>
+#include <ranges>
 #include <string>
+#include <string_view>
+#include <system_error>
 
 namespace strings {
 
@@ -23,7 +29,25 @@ inline auto length(std::basic_string<CharT, Traits> const& str)
 inline auto length(char const* str) { return std::strlen(str); }
 inline auto length(wchar_t const* str) { return std::wcslen(str); }
 
-template <typename CharT, std::size_t N> inline auto length(CharT (&)[N]) { return N; }
+// arrays hold zero terminated strings, e.g. string literals
+template <typename CharT, std::size_t N> inline auto length(CharT (&str)[N])
+{
+    return std::size_t(std::find(str, str + N, CharT{}) - str);
+}
+
+// joined_size returns the size of the strings in the range joined with a
+// separator of sep_size codeunits
+template <typename U, typename R> auto joined_size(R&& strs, std::size_t sep_size) -> std::size_t
+{
+    auto n = std::size_t{0};
+    auto count = std::size_t{0};
+    for (auto&& s : strs) {
+        n += std::basic_string_view<U>(s).size();
+        ++count;
+    }
+    return count ? n + (count - 1) * sep_size : 0;
+}
+
 } // namespace detail
 
 template <typename CharT, typename Traits,
@@ -61,4 +85,72 @@ auto join(CharT const* sep, Strs&&... strs)
     return join(std::basic_string_view<CharT>(sep), std::forward<Strs>(strs)...);
 }
 
+// joined_size returns the size of the output of join(strs, sep)
+template <std::ranges::forward_range R, typename U = codeunit_type_of<std::ranges::range_value_t<R>>>
+requires std::convertible_to<std::ranges::range_reference_t<R>, std::basic_string_view<U>>
+auto joined_size(R&& strs, std::type_identity_t<std::basic_string_view<U>> sep) -> std::size_t
+{
+    return detail::joined_size<U>(strs, sep.size());
+}
+
+// join - concatenates the strings of a range, inserting sep between them
+//
+// - the output size is computed in a pre-pass, so the result is allocated once
+//   and each string is copied once
+// - accepts any forward range of string-like values, e.g. a vector of
+//   string_views or a split_view
+//
+//   auto csv = join(fields, ",");
+//
+template <std::ranges::forward_range R, typename U = codeunit_type_of<std::ranges::range_value_t<R>>>
+requires std::convertible_to<std::ranges::range_reference_t<R>, std::basic_string_view<U>>
+auto join(R&& strs, std::type_identity_t<std::basic_string_view<U>> sep) -> std::basic_string<U>
+{
+    auto ret = std::basic_string<U>(detail::joined_size<U>(strs, sep.size()), U{});
+    auto p = ret.data();
+    auto first = true;
+    for (auto&& s : strs) {
+        if (!first)
+            p = std::copy(sep.begin(), sep.end(), p);
+        auto const sv = std::basic_string_view<U>(s);
+        p = std::copy(sv.begin(), sv.end(), p);
+        first = false;
+    }
+    return ret;
+}
+
+// join_to - writes the strings of a range, separated with sep, to a writer
+//
+// builders that can reserve storage are grown once to the joined size
+//
+template <std::derived_from<writer> W, std::ranges::forward_range R>
+requires std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>
+auto join_to(W& w, R&& strs, std::string_view sep) -> std::errc
+{
+    if constexpr (requires { w.reserve(std::size_t{}); })
+        w.reserve(w.size() + detail::joined_size<char>(strs, sep.size()));
+    auto first = true;
+    for (auto&& s : strs) {
+        if (!first)
+            if (auto ec = w.write(sep); ec != std::errc{})
+                return ec;
+        if (auto ec = w.write(std::string_view(s)); ec != std::errc{})
+            return ec;
+        first = false;
+    }
+    return std::errc{};
+}
+
+// join_to overload for a variadic list of strings
+//
+//   join_to(w, ", ", first_name, last_name);
+//
+template <std::derived_from<writer> W, std::convertible_to<std::string_view>... Strs>
+requires(sizeof...(Strs) > 0)
+auto join_to(W& w, std::string_view sep, Strs const&... strs) -> std::errc
+{
+    std::string_view const list[] = {std::string_view(strs)...};
+    return join_to(w, list, sep);
+}
+
 } // namespace strings
@@ -44,9 +44,13 @@ concept to_chars_convertible = requires(char* buf, T const& v, Args&&... args) {
 
 namespace detail {
 template <typename T>
-concept supported_format_arg = convertible_to_<T, std::string_view> ||
+concept supported_format_value = convertible_to_<T, std::string_view> ||
     std::is_integral_v<T> || std::is_floating_point_v<T> || to_chars_convertible<T> ||
     string_marshalable<T> || chars_marshalable<T> || formattable<T> ;
+
+// format arguments are forwarded, so lvalues arrive here as references
+template <typename T>
+concept supported_format_arg = supported_format_value<std::remove_cvref_t<T>>;
 }
 
 }
\ No newline at end of file
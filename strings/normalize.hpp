@@ -0,0 +1,320 @@
+#pragma once
+
+#include "codec.hpp"
+#include "codepoint.hpp"
+#include "fold.hpp"
+#include "normalize_data.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace strings {
+
+enum class normalization_form {
+    nfc,  // canonical decomposition, then canonical composition
+    nfd,  // canonical decomposition
+    nfkc, // compatibility decomposition, then canonical composition
+    nfkd, // compatibility decomposition
+};
+
+namespace detail::normalization {
+
+constexpr char32_t hangul_s_base = 0xAC00;
+constexpr char32_t hangul_l_base = 0x1100;
+constexpr char32_t hangul_v_base = 0x1161;
+constexpr char32_t hangul_t_base = 0x11A7;
+constexpr char32_t hangul_l_count = 19;
+constexpr char32_t hangul_v_count = 21;
+constexpr char32_t hangul_t_count = 28;
+constexpr char32_t hangul_s_count = hangul_l_count * hangul_v_count * hangul_t_count;
+
+// codepoints below U+00A0 are normalized in all forms, and never combine
+// with the codepoints around them
+constexpr char32_t stable_last = 0x9F;
+
+constexpr auto is_compatibility(normalization_form nf) -> bool
+{
+    return nf == normalization_form::nfkc || nf == normalization_form::nfkd;
+}
+
+constexpr auto is_composing(normalization_form nf) -> bool
+{
+    return nf == normalization_form::nfc || nf == normalization_form::nfkc;
+}
+
+// quick_check_no returns the record flags of the codepoints that cannot
+// occur in the form, quick_check_maybe the ones that may combine with the
+// preceding codepoint
+constexpr auto quick_check_no(normalization_form nf) -> std::uint8_t
+{
+    switch (nf) {
+    case normalization_form::nfc: return nfc_no;
+    case normalization_form::nfd: return nfd_no;
+    case normalization_form::nfkc: return nfkc_no;
+    case normalization_form::nfkd: return nfkd_no;
+    }
+    return 0;
+}
+
+constexpr auto quick_check_maybe(normalization_form nf) -> std::uint8_t
+{
+    switch (nf) {
+    case normalization_form::nfc: return nfc_maybe;
+    case normalization_form::nfkc: return nfkc_maybe;
+    default: return 0;
+    }
+}
+
+constexpr auto ccc(char32_t c) -> std::uint8_t { return c <= stable_last ? 0 : lookup(c).ccc; }
+
+// starts_segment returns true if c is a starter that is normalized in the
+// form and cannot interact with the preceding codepoints, i.e. the
+// codepoints before c can be normalized independently of what follows
+constexpr auto starts_segment(char32_t c, std::uint8_t mask) -> bool
+{
+    if (c <= stable_last)
+        return true;
+    auto const r = lookup(c);
+    return r.ccc == 0 && !(r.flags & mask);
+}
+
+// decompose appends the full canonical or compatibility decomposition of c
+inline void decompose(char32_t c, bool compat, std::vector<char32_t>& out)
+{
+    if (c - hangul_s_base < hangul_s_count) {
+        auto const s = c - hangul_s_base;
+        out.push_back(hangul_l_base + s / (hangul_v_count * hangul_t_count));
+        out.push_back(hangul_v_base + s % (hangul_v_count * hangul_t_count) / hangul_t_count);
+        if (s % hangul_t_count)
+            out.push_back(hangul_t_base + s % hangul_t_count);
+        return;
+    }
+    if (c <= stable_last || !(lookup(c).flags & (compat ? nfkd_no : nfd_no))) {
+        out.push_back(c);
+        return;
+    }
+    auto const it = std::lower_bound(std::begin(decompositions), std::end(decompositions), c,
+        [](decomposition const& d, char32_t cp) { return d.cp < cp; });
+    if (it == std::end(decompositions) || it->cp != c || (it->compat && !compat)) {
+        out.push_back(c);
+        return;
+    }
+    for (auto k = std::size_t{0}; k < it->size; ++k)
+        decompose(decomposition_data[it->offset + k], compat, out);
+}
+
+// canonical_order sorts the runs of non-starters by combining class, keeping
+// the order of the codepoints with the same class
+inline void canonical_order(std::vector<char32_t>& s)
+{
+    for (auto i = std::size_t{1}; i < s.size(); ++i) {
+        auto const c = s[i];
+        auto const cc = ccc(c);
+        if (!cc)
+            continue;
+        auto j = i;
+        while (j && ccc(s[j - 1]) > cc) {
+            s[j] = s[j - 1];
+            --j;
+        }
+        s[j] = c;
+    }
+}
+
+// compose_pair returns the primary composite of a and b, or 0
+inline auto compose_pair(char32_t a, char32_t b) -> char32_t
+{
+    if (a - hangul_l_base < hangul_l_count && b - hangul_v_base < hangul_v_count)
+        return hangul_s_base + ((a - hangul_l_base) * hangul_v_count + (b - hangul_v_base)) * hangul_t_count;
+    if (a - hangul_s_base < hangul_s_count && (a - hangul_s_base) % hangul_t_count == 0 &&
+        b - hangul_t_base - 1 < hangul_t_count - 1)
+        return a + (b - hangul_t_base);
+
+    auto const it = std::lower_bound(std::begin(compositions), std::end(compositions), std::pair{a, b},
+        [](composition const& p, std::pair<char32_t, char32_t> const& v) {
+            return p.first < v.first || (p.first == v.first && p.second < v.second);
+        });
+    return it != std::end(compositions) && it->first == a && it->second == b ? it->composite : 0;
+}
+
+// compose applies the canonical composition algorithm to a decomposed and
+// canonically ordered sequence
+inline void compose(std::vector<char32_t>& s)
+{
+    constexpr auto none = std::size_t(-1);
+    auto starter = none;
+    auto last_ccc = std::uint8_t{0}; // of the last codepoint kept after the starter
+    auto w = std::size_t{0};
+    for (auto i = std::size_t{0}; i < s.size(); ++i) {
+        auto const c = s[i];
+        auto const cc = ccc(c);
+        // c is blocked from the starter by a codepoint of a class that is 0
+        // or not lower than its own
+        if (starter != none && (last_ccc < cc || last_ccc == 0))
+            if (auto const composite = compose_pair(s[starter], c)) {
+                s[starter] = composite;
+                continue;
+            }
+        if (!cc)
+            starter = w;
+        last_ccc = cc;
+        s[w++] = c;
+    }
+    s.resize(w);
+}
+
+} // namespace detail::normalization
+
+// normalizer is a codepoint_source that produces the codepoints of its
+// source in a normalization form
+//
+// - codepoints that start a segment (starters that are normalized in the form
+//   and cannot combine with the preceding codepoints, quick-check Yes) are
+//   passed through with a single table lookup and a one codepoint lookahead,
+//   so already normalized input is not buffered
+// - otherwise the segment up to the next such codepoint is decomposed,
+//   canonically ordered, and composed for nfc and nfkc, in an internal buffer
+//
+// normalizers compose with operator>>, e.g. to compare NFD file names with
+// precomposed input:
+//
+//   compare(a >> normalization_form::nfc, b >> normalization_form::nfc, fold::unicode_simple)
+//
+template <codepoint_source Source> class normalizer {
+public:
+    normalizer(Source src, normalization_form nf)
+        : src_{std::move(src)}
+        , nf_{nf}
+        , mask_{std::uint8_t(detail::normalization::quick_check_no(nf) | detail::normalization::quick_check_maybe(nf))}
+    {
+    }
+
+    auto operator()() -> std::optional<codepoint>
+    {
+        if (pos_ != buffer_.size())
+            return codepoint{buffer_[pos_++]};
+
+        auto const cur = have_ahead_ ? ahead_ : src_();
+        auto const cur_starts = have_ahead_ ? ahead_starts_ : starts_segment(cur);
+        if (!cur)
+            return {};
+        read_ahead();
+        if (cur_starts && ahead_starts_)
+            return cur;
+        return normalize_segment(*cur);
+    }
+
+private:
+    // starts_segment - the end of input starts a segment
+    auto starts_segment(std::optional<codepoint> c) const -> bool
+    {
+        return !c || detail::normalization::starts_segment(c->value, mask_);
+    }
+
+    void read_ahead()
+    {
+        ahead_ = src_();
+        ahead_starts_ = starts_segment(ahead_);
+        have_ahead_ = true;
+    }
+
+    // normalize_segment normalizes the segment that starts with cur into the
+    // buffer, and returns its first codepoint
+    auto normalize_segment(codepoint cur) -> codepoint
+    {
+        namespace dn = detail::normalization;
+
+        buffer_.clear();
+        pos_ = 0;
+        auto const compat = dn::is_compatibility(nf_);
+        dn::decompose(cur.value, compat, buffer_);
+        while (ahead_ && !ahead_starts_) {
+            dn::decompose(ahead_->value, compat, buffer_);
+            read_ahead();
+        }
+        dn::canonical_order(buffer_);
+        if (dn::is_composing(nf_))
+            dn::compose(buffer_);
+        return codepoint{buffer_[pos_++]};
+    }
+
+    Source src_;
+    normalization_form nf_;
+    std::uint8_t mask_;
+    std::optional<codepoint> ahead_;
+    bool have_ahead_ = false;
+    bool ahead_starts_ = false;
+    std::vector<char32_t> buffer_; // normalized segment
+    std::size_t pos_ = 0;          // next codepoint of the segment to produce
+};
+
+[[nodiscard]] inline auto operator>>(codepoint_source auto&& src, normalization_form nf)
+{
+    return normalizer<std::remove_cvref_t<decltype(src)>>{std::forward<decltype(src)>(src), nf};
+}
+
+[[nodiscard]] inline auto operator>>(string_like_input auto&& s, normalization_form nf)
+{
+    return utf::make_decoder(s) >> nf;
+}
+
+// is_normalized - returns true if the input is in the normalization form
+//
+// the quick-check properties decide without decoding twice unless the input
+// contains codepoints that may combine with the preceding ones (quick-check
+// Maybe), then the input is compared with its normalized form
+//
+template <string_like_input S> auto is_normalized(S const& s, normalization_form nf) -> bool
+{
+    namespace dn = detail::normalization;
+
+    auto const no = dn::quick_check_no(nf);
+    auto const maybe = dn::quick_check_maybe(nf);
+    auto last_ccc = std::uint8_t{0};
+    auto have_maybe = false;
+    auto src = utf::make_decoder(s);
+    for (auto c = src(); c; c = src()) {
+        if (c->value <= dn::stable_last) {
+            last_ccc = 0;
+            continue;
+        }
+        auto const r = dn::lookup(c->value);
+        if ((r.ccc && last_ccc > r.ccc) || (r.flags & no))
+            return false;
+        have_maybe = have_maybe || (r.flags & maybe);
+        last_ccc = r.ccc;
+    }
+    if (!have_maybe)
+        return true;
+
+    auto a = utf::make_decoder(s);
+    auto b = utf::make_decoder(s) >> nf;
+    while (true) {
+        auto const x = a();
+        auto const y = b();
+        if (x != y)
+            return false;
+        if (!x)
+            return true;
+    }
+}
+
+// normalize - returns the input in the normalization form, in the same
+// encoding
+template <string_like_input S> auto normalize(S const& s, normalization_form nf) -> std::basic_string<codeunit_type_of<S>>
+{
+    using string_type = std::basic_string<codeunit_type_of<S>>;
+    if constexpr (convertible_to_string_view_input<S>)
+        if (is_normalized(s, nf))
+            return string_type(string_view_type_of<S>(s));
+    auto ret = string_type{};
+    utf::make_decoder(s) >> nf >> utf::make_encoder(ret);
+    return ret;
+}
+
+} // namespace strings
@@ -0,0 +1,2202 @@
+#pragma once
+
+// DO NOT EDIT: Generated file
+// clang-format off
+
+#include <cstdint>
+
+namespace strings::detail::normalization {
+
+// canonical combining classes, quick-check properties, decompositions, and
+// canonical compositions
+// generated from: unicode.org/Public/14.0.0/ucd/UnicodeData.txt, DerivedNormalizationProps.txt, CompositionExclusions.txt
+// total: 69 records, 5795 decompositions, 941 compositions, 103490 bytes
+//
+// codepoint bits [20..9] index stage1, which selects a row of stage2
+// codepoint bits [8..4] index the row, which selects a block of stage3
+// codepoint bits [3..0] index the block, which selects a record
+//
+constexpr unsigned stage2_shift = 9;
+constexpr unsigned stage3_shift = 4;
+
+// record flags, the quick-check values are Yes unless flagged
+constexpr std::uint8_t nfd_no = 0x01;
+constexpr std::uint8_t nfkd_no = 0x02;
+constexpr std::uint8_t nfc_no = 0x04;
+constexpr std::uint8_t nfc_maybe = 0x08;
+constexpr std::uint8_t nfkc_no = 0x10;
+constexpr std::uint8_t nfkc_maybe = 0x20;
+
+struct record {
+	std::uint8_t ccc; // canonical combining class
+	std::uint8_t flags;
+};
+
+constexpr record records[69] = {
+	{0,0},{0,nfkd_no|nfkc_no},{0,nfd_no|nfkd_no},{230,nfc_maybe|nfkc_maybe},{230,0},{232,0},{220,0},{216,nfc_maybe|nfkc_maybe},
+	{202,0},{220,nfc_maybe|nfkc_maybe},{202,nfc_maybe|nfkc_maybe},{1,0},{1,nfc_maybe|nfkc_maybe},{230,nfd_no|nfkd_no|nfc_no|nfkc_no},{240,nfc_maybe|nfkc_maybe},{233,0},
+	{234,0},{0,nfd_no|nfkd_no|nfc_no|nfkc_no},{0,nfd_no|nfkd_no|nfkc_no},{222,0},{228,0},{10,0},{11,0},{12,0},
+	{13,0},{14,0},{15,0},{16,0},{17,0},{18,0},{19,0},{20,0},
+	{21,0},{22,0},{23,0},{24,0},{25,0},{30,0},{31,0},{32,0},
+	{27,0},{28,0},{29,0},{33,0},{34,0},{35,0},{36,0},{7,nfc_maybe|nfkc_maybe},
+	{9,0},{7,0},{0,nfc_maybe|nfkc_maybe},{84,0},{91,nfc_maybe|nfkc_maybe},{9,nfc_maybe|nfkc_maybe},{103,0},{107,0},
+	{118,0},{122,0},{216,0},{129,0},{130,0},{132,0},{214,0},{218,0},
+	{224,0},{8,nfc_maybe|nfkc_maybe},{26,0},{6,0},{226,0},
+};
+
+constexpr std::uint8_t stage1[2176] = {
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,10,10,19,20,21,22,23,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,24,25,26,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,28,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,29,30,31,32,
+	33,34,10,35,10,36,37,38,39,40,41,42,43,44,45,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,46,10,47,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,48,10,
+	10,10,10,10,10,10,10,10,49,50,51,52,10,10,10,10,53,54,10,10,55,10,10,56,57,58,10,10,10,59,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,60,61,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+	10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+};
+
+constexpr std::uint16_t stage2[62][32] = {
+	{0,0,0,0,0,0,0,0,0,0,1,2,3,4,3,5,6,7,8,9,10,11,8,12,0,0,13,14,15,16,17,18},
+	{6,19,20,21,0,0,0,0,0,0,0,22,0,23,24,0,25,26,27,28,29,30,31,32,33,14,34,14,35,36,0,37},
+	{38,39,0,39,0,38,0,40,41,0,0,0,42,43,44,45,0,0,0,0,0,0,0,0,46,47,48,49,50,0,0,0},
+	{0,51,52,0,53,54,0,55,0,0,0,0,56,57,58,0,0,59,0,60,61,0,0,0,0,0,0,0,0,0,62,63},
+	{0,64,65,0,0,66,0,0,0,67,0,0,68,69,70,71,0,0,39,72,73,74,0,0,0,0,0,75,76,77,0,78},
+	{0,0,0,79,73,80,0,0,0,0,0,81,73,0,0,0,0,0,0,75,82,83,0,0,0,84,0,85,86,87,0,0},
+	{0,0,0,81,88,89,0,0,0,0,0,81,90,91,0,0,0,0,0,92,86,87,0,0,0,0,0,0,93,94,0,0},
+	{0,0,0,95,96,0,0,0,0,0,0,97,98,99,0,0,100,101,0,102,103,104,105,106,107,103,104,105,108,0,0,0},
+	{0,0,109,110,0,0,0,0,111,0,0,0,0,0,0,100,0,0,0,0,0,0,112,113,0,0,114,115,116,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,119,0,0,0,0,0,0,0,0,0,120,0,0},
+	{0,0,0,0,0,0,0,0,0,0,121,0,0,0,0,0,0,0,0,122,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,123,0,0,0,0,124,125,0,0,0,126,127,0,0,0,128,129,0,130,131,0,132,133,0,0,134,0,0,0,135,136},
+	{0,0,0,137,0,0,0,0,0,0,0,0,0,138,139,140,0,0,141,142,143,144,145,146,0,147,144,144,148,149,150,151},
+	{6,6,6,6,6,6,6,6,6,152,6,6,6,6,6,153,6,154,6,6,154,155,6,156,6,6,6,157,158,159,160,161},
+	{162,163,164,165,166,167,0,168,169,170,146,0,0,171,172,173,174,175,176,177,178,144,144,144,179,180,181,0,182,0,0,0},
+	{183,0,184,185,186,0,187,188,188,0,189,0,0,0,190,0,0,0,191,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,144,144,144,144,144,144,144,144,145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{100,0,0,0,0,0,0,192,0,0,0,0,0,193,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,99,0,0,0,0,0,0,194,195,0,0,0,0,0,0,196,197,0,0,0,0,0,0,150,150},
+	{0,0,0,0,0,0,0,0,0,196,0,0,0,0,0,198,144,144,144,144,144,144,144,144,144,144,144,144,144,199,0,0},
+	{185,0,200,201,202,203,204,205,0,206,202,203,204,205,0,207,0,0,0,208,144,144,144,144,169,209,0,0,0,0,0,0},
+	{144,169,144,144,210,144,144,169,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144},
+	{0,0,0,0,0,0,194,211,0,212,0,0,0,0,0,195,0,0,0,0,0,0,0,185,0,0,0,0,0,0,0,213},
+	{214,0,215,0,0,0,0,0,0,0,0,0,119,0,150,195,0,0,216,0,0,217,0,0,0,0,0,218,124,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,219,220,0,0,214,0,0,0,0,0,221,179,0,0,0,0,0,0,0,73,0},
+	{6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6},
+	{6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,21,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222},
+	{223,224,225,222,222,222,223,222,222,222,222,222,222,226,0,0,227,228,229,230,231,144,144,144,144,144,144,232,0,233,144,144},
+	{144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,234,0,144,144,144,144,209,144,144,210,0,0,170},
+	{0,235,236,144,237,238,239,240,144,144,144,144,144,144,144,170,208,144,144,144,144,144,144,144,144,144,144,169,241,242,243,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,244,0,0,0,0,0,0,0,0,245,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,246,144,144,247,0,0,0,0},
+	{248,0,0,249,0,0,0,0,0,0,0,0,0,0,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,251,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,252,0,0,0,0,0,0,0,0,0,253,244,0,0,254,0,0,0,0,0,0,0},
+	{0,0,0,0,214,0,0,255,0,256,257,258,0,0,0,0,259,0,260,261,0,0,0,218,0,0,0,0,262,0,0,0},
+	{0,0,0,263,0,0,0,0,0,0,0,0,0,0,264,0,0,0,0,265,76,87,266,267,0,0,0,0,0,0,0,0},
+	{0,0,0,0,268,78,0,0,0,0,0,269,270,0,0,0,0,0,0,0,0,0,0,0,0,0,271,272,273,0,0,0},
+	{0,0,0,197,0,0,0,0,0,0,0,274,0,0,0,0,0,0,275,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,276,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,277,218,0,0,0,0,0,0,0,0,0,124,0},
+	{0,0,0,119,278,0,0,0,0,279,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,197,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,280,0,0,0,0,278,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,281,0,0,0,282,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,283},
+	{0,0,0,0,0,0,0,0,0,284,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,285,286,287,288,0,289,290,291,0,0,0},
+	{0,0,0,0,292,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{144,144,144,144,144,293,144,144,144,294,295,296,297,144,144,144,298,299,144,300,301,302,144,144,144,144,144,144,144,144,144,144},
+	{144,144,144,144,144,144,144,144,144,144,303,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,144,304,144,144,144},
+	{305,306,307,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,282,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,78,0,0,0,308,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,309,0,0,0,0,0,0,310,0,0,0,0,0,0,0,0,0,0,0},
+	{297,144,311,312,313,314,315,316,317,318,319,318,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,144,169,144,144,0,320,0,0,185,0,0,0,0,0,0},
+	{321,144,144,318,22,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,235},
+	{222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222,222},
+	{222,223,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+};
+
+constexpr std::uint8_t stage3[322][16] = {
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{1,0,0,0,0,0,0,0,1,0,1,0,0,0,0,1},
+	{0,0,1,1,1,1,0,0,1,1,1,0,1,1,1,0},
+	{2,2,2,2,2,2,0,2,2,2,2,2,2,2,2,2},
+	{0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,0},
+	{0,2,2,2,2,2,2,0,0,2,2,2,2,2,0,2},
+	{2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+	{0,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+	{2,2,2,2,2,2,0,0,2,2,2,2,2,2,2,2},
+	{2,0,1,1,2,2,2,2,0,2,2,2,2,2,2,1},
+	{1,0,0,2,2,2,2,2,2,1,0,0,2,2,2,2},
+	{2,2,0,0,2,2,2,2,2,2,2,2,2,2,2,2},
+	{2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1},
+	{2,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2},
+	{2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,1,1,1,1,1,1,1,1,1,2,2,2},
+	{2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2},
+	{2,2,2,2,0,0,2,2,2,2,2,2,2,2,2,2},
+	{2,1,1,1,2,2,0,0,2,2,2,2,2,2,2,2},
+	{2,2,2,2,2,2,2,2,2,2,2,2,0,0,2,2},
+	{0,0,0,0,0,0,2,2,2,2,2,2,2,2,2,2},
+	{2,2,2,2,0,0,0,0,0,0,0,0,0,0,0,0},
+	{1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,1,1,1,1,1,1,0,0},
+	{1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0},
+	{3,3,3,3,3,4,3,3,3,3,3,3,3,4,4,3},
+	{4,3,4,3,3,5,6,6,6,6,5,7,6,6,6,6},
+	{6,8,8,9,9,9,9,10,10,6,6,6,6,9,9,6},
+	{9,9,6,6,11,11,11,11,12,6,6,6,6,4,4,4},
+	{13,13,3,13,13,14,4,6,6,6,4,4,4,6,6,0},
+	{4,4,4,6,6,6,6,4,5,6,6,4,15,16,16,15},
+	{16,16,15,4,4,4,4,4,4,4,4,4,4,4,4,4},
+	{0,0,0,0,17,0,0,0,0,0,1,0,0,0,17,0},
+	{0,0,0,0,1,18,2,17,2,2,2,0,2,0,2,2},
+	{0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,2},
+	{0,0,0,0,0,0,0,0,0,0,2,2,2,2,2,0},
+	{1,1,1,18,18,1,1,0,0,0,0,0,0,0,0,0},
+	{1,1,1,0,1,1,0,0,0,1,0,0,0,0,0,0},
+	{2,2,0,2,0,0,0,2,0,0,0,0,2,2,2,0},
+	{0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0},
+	{0,0,0,0,0,0,2,2,0,0,0,0,0,0,0,0},
+	{0,0,0,4,4,4,4,4,0,0,0,0,0,0,0,0},
+	{0,2,2,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{2,2,2,2,0,0,2,2,0,0,2,2,2,2,2,2},
+	{0,0,2,2,2,2,2,2,0,0,2,2,2,2,2,2},
+	{2,2,2,2,2,2,0,0,2,2,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
+	{0,6,4,4,4,4,6,4,4,4,19,6,4,4,4,4},
+	{4,4,6,6,6,6,6,6,4,4,6,4,4,19,20,4},
+	{21,22,23,24,25,26,27,28,29,30,30,31,32,33,0,34},
+	{0,35,36,0,4,6,0,29,0,0,0,0,0,0,0,0},
+	{4,4,4,4,4,4,4,4,37,38,39,0,0,0,0,0},
+	{0,0,2,2,2,2,2,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,40,41,42,37,38},
+	{39,43,44,3,3,9,6,4,4,4,4,4,6,4,4,6},
+	{45,0,0,0,0,1,1,1,1,0,0,0,0,0,0,0},
+	{2,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,2,0,0,4,4,4,4,4,4,4,0,0,4},
+	{4,4,4,6,4,0,0,4,4,0,6,4,4,6,0,0},
+	{0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{4,6,4,4,6,4,4,6,6,6,4,6,6,4,6,4},
+	{4,4,6,4,6,4,6,4,6,4,4,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,4,4,4,4,4},
+	{4,4,6,4,0,0,0,0,0,0,0,0,0,6,0,0},
+	{0,0,0,0,0,0,4,4,4,4,0,4,4,4,4,4},
+	{4,4,4,4,0,4,4,4,0,4,4,4,4,4,0,0},
+	{0,0,0,0,0,0,0,0,0,6,6,6,0,0,0,0},
+	{0,0,0,0,0,0,0,0,4,6,6,6,4,4,4,4},
+	{0,0,0,0,0,0,0,0,0,0,4,4,4,4,4,6},
+	{6,6,6,6,4,4,4,4,4,4,4,4,4,4,4,4},
+	{4,4,0,6,4,4,6,4,4,6,4,4,4,6,6,6},
+	{40,41,42,4,4,4,6,4,4,6,6,4,4,4,4,4},
+	{0,2,0,0,2,0,0,0,0,0,0,0,47,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0},
+	{0,4,6,4,4,0,0,0,17,17,17,17,17,17,17,17},
+	{0,0,0,0,0,0,0,0,0,0,0,0,49,0,50,0},
+	{0,0,0,0,0,0,0,0,0,0,0,2,2,48,0,0},
+	{0,0,0,0,0,0,0,50,0,0,0,0,17,17,0,17},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0},
+	{0,0,0,17,0,0,17,0,0,0,0,0,49,0,0,0},
+	{0,0,0,0,0,0,0,0,0,17,17,17,0,0,17,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0},
+	{0,0,0,0,0,0,0,0,2,0,0,2,2,48,0,0},
+	{0,0,0,0,0,0,50,50,0,0,0,0,17,17,0,0},
+	{0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0},
+	{0,0,0,0,0,0,0,0,0,0,2,2,2,48,0,0},
+	{0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,2,0,0,0,0,48,0,0},
+	{0,0,0,0,0,51,52,0,0,0,0,0,0,0,0,0},
+	{2,0,50,0,0,0,0,2,2,0,2,2,0,48,0,0},
+	{0,0,0,0,0,50,50,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,48,48,0,50,0},
+	{0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,50},
+	{0,0,0,0,0,0,0,0,0,0,2,0,2,2,2,50},
+	{0,0,0,1,0,0,0,0,54,54,48,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,55,55,55,55,0,0,0,0},
+	{0,0,0,1,0,0,0,0,56,56,48,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,57,57,57,57,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,1,1,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0},
+	{0,0,0,0,0,0,0,0,6,6,0,0,0,0,0,0},
+	{0,0,0,0,0,6,0,6,0,58,0,0,0,0,0,0},
+	{0,0,0,17,0,0,0,0,0,0,0,0,0,17,0,0},
+	{0,0,17,0,0,0,0,17,0,0,0,0,17,0,0,0},
+	{0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0},
+	{0,59,60,17,61,17,17,1,17,1,60,60,60,60,0,0},
+	{60,17,4,4,48,0,4,4,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,2,0,0,0,0,0,0,0,50,0},
+	{0,0,0,0,0,0,0,49,0,48,48,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0},
+	{0,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,4,4,4},
+	{0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,48,0,0,0,0,0,0,0,0,0,0,4,0,0},
+	{0,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,19,4,6,0,0,0,0},
+	{0,0,0,0,0,0,0,4,6,0,0,0,0,0,0,0},
+	{48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,4,4,4,4,4,4,4,4,0,0,6},
+	{4,4,4,4,4,6,6,6,6,6,6,4,4,6,0,6},
+	{6,4,4,6,6,4,4,4,4,4,6,4,4,4,4,0},
+	{0,0,0,0,0,0,2,0,2,0,2,0,2,0,2,0},
+	{0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,49,50,0,0,0,0,0,2,0,2,0,0},
+	{2,2,0,2,48,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,4,6,4,4,4},
+	{4,4,4,4,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,48,48,0,0,0,0},
+	{0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0},
+	{0,0,48,48,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0},
+	{4,4,4,0,11,6,6,6,6,6,4,4,6,6,6,6},
+	{4,0,11,11,11,11,11,11,11,0,0,0,0,6,0,0},
+	{0,0,0,0,4,0,0,0,4,4,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,0},
+	{1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1},
+	{4,4,6,4,4,4,4,4,4,4,6,4,4,16,62,6},
+	{8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+	{4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+	{4,4,4,4,4,4,5,20,20,6,63,4,15,6,4,6},
+	{2,2,2,2,2,2,2,2,2,2,1,18,0,0,0,0},
+	{2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,0},
+	{2,2,2,2,2,2,0,0,2,2,2,2,2,2,0,0},
+	{2,2,2,2,2,2,2,2,0,2,0,2,0,2,0,2},
+	{2,17,2,17,2,17,2,17,2,17,2,17,2,17,0,0},
+	{2,2,2,2,2,0,2,2,2,2,2,17,2,1,17,1},
+	{1,18,2,2,2,0,2,2,2,17,2,17,2,18,18,18},
+	{2,2,2,17,0,0,2,2,2,2,2,17,0,18,18,18},
+	{2,2,2,17,2,2,2,2,2,2,2,17,2,18,17,17},
+	{0,0,2,2,2,0,2,2,2,17,2,17,2,17,1,0},
+	{17,17,1,1,1,1,1,1,1,1,1,0,0,0,0,0},
+	{0,1,0,0,0,0,0,1,0,0,0,0,0,0,0,0},
+	{0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,1},
+	{0,0,0,1,1,0,1,1,0,0,0,0,1,0,1,0},
+	{0,0,0,0,0,0,0,1,1,1,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1},
+	{1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0},
+	{4,4,11,11,4,4,4,4,11,11,11,4,4,0,0,0},
+	{0,4,0,0,0,11,11,4,6,4,11,11,6,6,6,6},
+	{4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{1,1,1,1,0,1,1,1,0,1,1,1,1,1,1,1},
+	{1,1,1,1,0,1,1,0,0,1,1,1,1,1,0,0},
+	{1,1,1,0,1,0,17,0,1,0,17,17,1,1,0,1},
+	{1,1,0,1,1,1,1,1,1,1,0,1,1,1,1,1},
+	{1,0,0,0,0,1,1,1,1,1,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,2,2,2},
+	{0,0,0,0,2,0,0,0,0,2,0,0,2,0,0,0},
+	{0,0,0,0,2,0,2,0,0,0,0,0,1,1,0,1},
+	{1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,2,0,0,2,0,0,2,0,2,0,0,0,0,0,0},
+	{2,0,2,0,0,0,0,0,0,0,0,0,0,2,2,2},
+	{2,2,0,0,2,2,0,0,2,2,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,2,2,2,2},
+	{2,2,2,2,0,0,0,0,0,0,2,2,2,2,0,0},
+	{0,0,0,0,0,0,0,0,0,17,17,0,0,0,0,0},
+	{0,0,0,0,1,1,1,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4},
+	{4,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48},
+	{0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0},
+	{1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,63,20,5,19,64,64},
+	{0,0,0,0,0,0,1,0,1,1,1,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,0},
+	{2,0,2,0,2,0,2,0,2,0,2,0,2,0,2,0},
+	{2,0,2,0,0,2,0,2,0,2,0,0,0,0,0,0},
+	{2,2,0,2,2,0,2,2,0,2,2,0,2,2,0,0},
+	{0,0,0,0,2,0,0,0,0,65,65,1,1,0,2,1},
+	{0,0,0,0,2,0,0,2,2,2,2,0,0,0,2,1},
+	{0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+	{0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0},
+	{0,0,0,0,4,4,4,4,4,4,4,4,4,4,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,1,1,4,4},
+	{0,0,1,1,1,0,0,0,1,1,0,0,0,0,0,0},
+	{0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,6,6,6,0,0},
+	{0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0},
+	{4,0,4,4,6,0,0,4,4,0,0,0,0,0,4,4},
+	{0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1},
+	{17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17},
+	{17,17,17,17,17,17,17,17,17,17,17,17,17,17,0,0},
+	{17,0,17,0,0,17,17,17,17,17,17,17,17,17,17,0},
+	{17,0,17,0,0,17,17,0,0,0,17,17,17,17,17,17},
+	{17,17,17,17,17,17,17,17,17,17,0,0,0,0,0,0},
+	{1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0},
+	{0,0,0,1,1,1,1,1,0,0,0,0,0,17,66,17},
+	{1,1,1,1,1,1,1,1,1,1,17,17,17,17,17,17},
+	{17,17,17,17,17,17,17,0,17,17,17,17,17,0,17,0},
+	{17,17,0,17,17,0,17,17,17,17,17,17,17,17,17,1},
+	{1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0},
+	{1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0},
+	{4,4,4,4,4,4,4,6,6,6,6,6,6,6,4,4},
+	{1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1},
+	{1,1,1,0,1,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,0,1,1,1,1,0,0,0,0},
+	{1,1,1,0,1,0,1,1,1,1,1,1,1,1,1,1},
+	{0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1},
+	{0,0,1,1,1,1,1,1,0,0,1,1,1,0,0,0},
+	{1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0},
+	{6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,4,4,4,4,4,0,0,0,0,0},
+	{0,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1},
+	{1,0,1,1,1,1,1,1,1,1,1,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,4},
+	{0,0,0,0,0,0,0,0,4,11,6,0,0,0,0,48},
+	{0,0,0,0,0,4,6,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,4,4,4,4,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,4,4,0,0,0},
+	{0,0,0,0,0,0,6,6,4,4,4,6,4,6,6,6},
+	{0,0,4,6,4,6,0,0,0,0,0,0,0,0,0,0},
+	{48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48},
+	{0,0,0,0,0,0,0,0,0,0,2,0,2,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,48,47,0,0,0,0,0},
+	{4,4,4,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,50,0,0,0,0,0,0,2,2},
+	{0,0,0,48,48,0,0,0,0,0,0,0,0,0,0,0},
+	{48,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0},
+	{0,0,0,0,0,48,49,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,49,48,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,49,49,0,50,0},
+	{0,0,0,0,0,0,4,4,4,4,4,4,4,0,0,0},
+	{4,4,4,4,4,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,48,0,0,0,49,0,0,0,0,0,0,0,0,0},
+	{50,0,0,0,0,0,0,0,0,0,50,2,2,50,2,0},
+	{0,0,48,49,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50},
+	{0,0,0,0,0,0,0,0,0,0,2,2,0,0,0,48},
+	{49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,48,49,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,48,49,0,0,0,0,0},
+	{50,0,0,0,0,0,0,0,2,0,0,0,0,48,48,0},
+	{0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0},
+	{0,0,49,0,48,48,0,0,0,0,0,0,0,0,0,0},
+	{11,11,11,11,11,0,0,0,0,0,0,0,0,0,0,0},
+	{4,4,4,4,4,4,4,0,0,0,0,0,0,0,0,0},
+	{67,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,17},
+	{17,17,17,17,17,58,58,11,11,11,0,0,0,68,58,58},
+	{58,58,58,0,0,0,0,0,0,0,0,6,6,6,6,6},
+	{6,6,6,0,0,4,4,4,4,4,6,6,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,4,4,4,4,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,17,17,17,17,17},
+	{17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{0,0,4,4,4,0,0,0,0,0,0,0,0,0,0,0},
+	{1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1},
+	{0,0,1,0,0,1,1,0,0,1,1,1,1,0,1,1},
+	{1,1,1,1,1,1,1,1,1,1,0,1,0,1,1,1},
+	{1,1,1,1,0,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,0,1,1,1,1,0,0,1,1,1},
+	{1,1,1,1,1,0,1,1,1,1,1,1,1,0,1,1},
+	{1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,0},
+	{1,1,1,1,1,0,1,0,0,0,1,1,1,1,1,1},
+	{1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1},
+	{4,4,4,4,4,4,4,0,4,4,4,4,4,4,4,4},
+	{4,4,4,4,4,4,4,4,4,0,0,4,4,4,4,4},
+	{4,4,0,4,4,0,4,4,4,4,4,0,0,0,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,4,4,4,4},
+	{6,6,6,6,6,6,6,0,0,0,0,0,0,0,0,0},
+	{0,0,0,0,4,4,4,4,4,4,49,0,0,0,0,0},
+	{0,1,1,0,1,0,0,1,0,1,1,1,1,1,1,1},
+	{1,1,1,0,1,1,1,1,0,1,0,1,0,0,0,0},
+	{0,0,1,0,0,0,0,1,0,1,0,1,0,1,1,1},
+	{0,1,1,0,1,0,0,1,0,1,0,1,0,1,0,1},
+	{0,1,1,0,1,0,0,1,1,1,1,0,1,1,1,1},
+	{1,1,1,0,1,1,1,1,0,1,1,1,1,0,1,0},
+	{1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0},
+	{0,1,1,1,0,1,1,1,1,1,0,1,1,1,1,1},
+	{0,0,0,0,0,0,0,0,0,0,1,1,1,0,0,0},
+	{1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0},
+};
+
+constexpr auto lookup(char32_t c) -> record {
+	auto const cp = unsigned(c) < 0x110000u ? unsigned(c) : 0xFFFFFu; // noncharacter
+	auto const row = stage1[cp >> stage2_shift];
+	auto const block = stage2[row][(cp >> stage3_shift) & ((1u << (stage2_shift - stage3_shift)) - 1)];
+	return records[stage3[block][cp & ((1u << stage3_shift) - 1)]];
+}
+
+// single level decomposition mappings (hangul syllables are decomposed
+// algorithmically), sorted by codepoint
+struct decomposition {
+	char32_t cp;
+	std::uint16_t offset; // in decomposition_data
+	std::uint8_t size;
+	bool compat;          // compatibility mapping
+};
+
+constexpr decomposition decompositions[5795] = {
+	{0xa0,0,1,true},{0xa8,1,2,true},{0xaa,3,1,true},{0xaf,4,2,true},{0xb2,6,1,true},{0xb3,7,1,true},
+	{0xb4,8,2,true},{0xb5,10,1,true},{0xb8,11,2,true},{0xb9,13,1,true},{0xba,14,1,true},{0xbc,15,3,true},
+	{0xbd,18,3,true},{0xbe,21,3,true},{0xc0,24,2,false},{0xc1,26,2,false},{0xc2,28,2,false},{0xc3,30,2,false},
+	{0xc4,32,2,false},{0xc5,34,2,false},{0xc7,36,2,false},{0xc8,38,2,false},{0xc9,40,2,false},{0xca,42,2,false},
+	{0xcb,44,2,false},{0xcc,46,2,false},{0xcd,48,2,false},{0xce,50,2,false},{0xcf,52,2,false},{0xd1,54,2,false},
+	{0xd2,56,2,false},{0xd3,58,2,false},{0xd4,60,2,false},{0xd5,62,2,false},{0xd6,64,2,false},{0xd9,66,2,false},
+	{0xda,68,2,false},{0xdb,70,2,false},{0xdc,72,2,false},{0xdd,74,2,false},{0xe0,76,2,false},{0xe1,78,2,false},
+	{0xe2,80,2,false},{0xe3,82,2,false},{0xe4,84,2,false},{0xe5,86,2,false},{0xe7,88,2,false},{0xe8,90,2,false},
+	{0xe9,92,2,false},{0xea,94,2,false},{0xeb,96,2,false},{0xec,98,2,false},{0xed,100,2,false},{0xee,102,2,false},
+	{0xef,104,2,false},{0xf1,106,2,false},{0xf2,108,2,false},{0xf3,110,2,false},{0xf4,112,2,false},{0xf5,114,2,false},
+	{0xf6,116,2,false},{0xf9,118,2,false},{0xfa,120,2,false},{0xfb,122,2,false},{0xfc,124,2,false},{0xfd,126,2,false},
+	{0xff,128,2,false},{0x100,130,2,false},{0x101,132,2,false},{0x102,134,2,false},{0x103,136,2,false},{0x104,138,2,false},
+	{0x105,140,2,false},{0x106,142,2,false},{0x107,144,2,false},{0x108,146,2,false},{0x109,148,2,false},{0x10a,150,2,false},
+	{0x10b,152,2,false},{0x10c,154,2,false},{0x10d,156,2,false},{0x10e,158,2,false},{0x10f,160,2,false},{0x112,162,2,false},
+	{0x113,164,2,false},{0x114,166,2,false},{0x115,168,2,false},{0x116,170,2,false},{0x117,172,2,false},{0x118,174,2,false},
+	{0x119,176,2,false},{0x11a,178,2,false},{0x11b,180,2,false},{0x11c,182,2,false},{0x11d,184,2,false},{0x11e,186,2,false},
+	{0x11f,188,2,false},{0x120,190,2,false},{0x121,192,2,false},{0x122,194,2,false},{0x123,196,2,false},{0x124,198,2,false},
+	{0x125,200,2,false},{0x128,202,2,false},{0x129,204,2,false},{0x12a,206,2,false},{0x12b,208,2,false},{0x12c,210,2,false},
+	{0x12d,212,2,false},{0x12e,214,2,false},{0x12f,216,2,false},{0x130,218,2,false},{0x132,220,2,true},{0x133,222,2,true},
+	{0x134,224,2,false},{0x135,226,2,false},{0x136,228,2,false},{0x137,230,2,false},{0x139,232,2,false},{0x13a,234,2,false},
+	{0x13b,236,2,false},{0x13c,238,2,false},{0x13d,240,2,false},{0x13e,242,2,false},{0x13f,244,2,true},{0x140,246,2,true},
+	{0x143,248,2,false},{0x144,250,2,false},{0x145,252,2,false},{0x146,254,2,false},{0x147,256,2,false},{0x148,258,2,false},
+	{0x149,260,2,true},{0x14c,262,2,false},{0x14d,264,2,false},{0x14e,266,2,false},{0x14f,268,2,false},{0x150,270,2,false},
+	{0x151,272,2,false},{0x154,274,2,false},{0x155,276,2,false},{0x156,278,2,false},{0x157,280,2,false},{0x158,282,2,false},
+	{0x159,284,2,false},{0x15a,286,2,false},{0x15b,288,2,false},{0x15c,290,2,false},{0x15d,292,2,false},{0x15e,294,2,false},
+	{0x15f,296,2,false},{0x160,298,2,false},{0x161,300,2,false},{0x162,302,2,false},{0x163,304,2,false},{0x164,306,2,false},
+	{0x165,308,2,false},{0x168,310,2,false},{0x169,312,2,false},{0x16a,314,2,false},{0x16b,316,2,false},{0x16c,318,2,false},
+	{0x16d,320,2,false},{0x16e,322,2,false},{0x16f,324,2,false},{0x170,326,2,false},{0x171,328,2,false},{0x172,330,2,false},
+	{0x173,332,2,false},{0x174,334,2,false},{0x175,336,2,false},{0x176,338,2,false},{0x177,340,2,false},{0x178,342,2,false},
+	{0x179,344,2,false},{0x17a,346,2,false},{0x17b,348,2,false},{0x17c,350,2,false},{0x17d,352,2,false},{0x17e,354,2,false},
+	{0x17f,356,1,true},{0x1a0,357,2,false},{0x1a1,359,2,false},{0x1af,361,2,false},{0x1b0,363,2,false},{0x1c4,365,2,true},
+	{0x1c5,367,2,true},{0x1c6,369,2,true},{0x1c7,371,2,true},{0x1c8,373,2,true},{0x1c9,375,2,true},{0x1ca,377,2,true},
+	{0x1cb,379,2,true},{0x1cc,381,2,true},{0x1cd,383,2,false},{0x1ce,385,2,false},{0x1cf,387,2,false},{0x1d0,389,2,false},
+	{0x1d1,391,2,false},{0x1d2,393,2,false},{0x1d3,395,2,false},{0x1d4,397,2,false},{0x1d5,399,2,false},{0x1d6,401,2,false},
+	{0x1d7,403,2,false},{0x1d8,405,2,false},{0x1d9,407,2,false},{0x1da,409,2,false},{0x1db,411,2,false},{0x1dc,413,2,false},
+	{0x1de,415,2,false},{0x1df,417,2,false},{0x1e0,419,2,false},{0x1e1,421,2,false},{0x1e2,423,2,false},{0x1e3,425,2,false},
+	{0x1e6,427,2,false},{0x1e7,429,2,false},{0x1e8,431,2,false},{0x1e9,433,2,false},{0x1ea,435,2,false},{0x1eb,437,2,false},
+	{0x1ec,439,2,false},{0x1ed,441,2,false},{0x1ee,443,2,false},{0x1ef,445,2,false},{0x1f0,447,2,false},{0x1f1,449,2,true},
+	{0x1f2,451,2,true},{0x1f3,453,2,true},{0x1f4,455,2,false},{0x1f5,457,2,false},{0x1f8,459,2,false},{0x1f9,461,2,false},
+	{0x1fa,463,2,false},{0x1fb,465,2,false},{0x1fc,467,2,false},{0x1fd,469,2,false},{0x1fe,471,2,false},{0x1ff,473,2,false},
+	{0x200,475,2,false},{0x201,477,2,false},{0x202,479,2,false},{0x203,481,2,false},{0x204,483,2,false},{0x205,485,2,false},
+	{0x206,487,2,false},{0x207,489,2,false},{0x208,491,2,false},{0x209,493,2,false},{0x20a,495,2,false},{0x20b,497,2,false},
+	{0x20c,499,2,false},{0x20d,501,2,false},{0x20e,503,2,false},{0x20f,505,2,false},{0x210,507,2,false},{0x211,509,2,false},
+	{0x212,511,2,false},{0x213,513,2,false},{0x214,515,2,false},{0x215,517,2,false},{0x216,519,2,false},{0x217,521,2,false},
+	{0x218,523,2,false},{0x219,525,2,false},{0x21a,527,2,false},{0x21b,529,2,false},{0x21e,531,2,false},{0x21f,533,2,false},
+	{0x226,535,2,false},{0x227,537,2,false},{0x228,539,2,false},{0x229,541,2,false},{0x22a,543,2,false},{0x22b,545,2,false},
+	{0x22c,547,2,false},{0x22d,549,2,false},{0x22e,551,2,false},{0x22f,553,2,false},{0x230,555,2,false},{0x231,557,2,false},
+	{0x232,559,2,false},{0x233,561,2,false},{0x2b0,563,1,true},{0x2b1,564,1,true},{0x2b2,565,1,true},{0x2b3,566,1,true},
+	{0x2b4,567,1,true},{0x2b5,568,1,true},{0x2b6,569,1,true},{0x2b7,570,1,true},{0x2b8,571,1,true},{0x2d8,572,2,true},
+	{0x2d9,574,2,true},{0x2da,576,2,true},{0x2db,578,2,true},{0x2dc,580,2,true},{0x2dd,582,2,true},{0x2e0,584,1,true},
+	{0x2e1,585,1,true},{0x2e2,586,1,true},{0x2e3,587,1,true},{0x2e4,588,1,true},{0x340,589,1,false},{0x341,590,1,false},
+	{0x343,591,1,false},{0x344,592,2,false},{0x374,594,1,false},{0x37a,595,2,true},{0x37e,597,1,false},{0x384,598,2,true},
+	{0x385,600,2,false},{0x386,602,2,false},{0x387,604,1,false},{0x388,605,2,false},{0x389,607,2,false},{0x38a,609,2,false},
+	{0x38c,611,2,false},{0x38e,613,2,false},{0x38f,615,2,false},{0x390,617,2,false},{0x3aa,619,2,false},{0x3ab,621,2,false},
+	{0x3ac,623,2,false},{0x3ad,625,2,false},{0x3ae,627,2,false},{0x3af,629,2,false},{0x3b0,631,2,false},{0x3ca,633,2,false},
+	{0x3cb,635,2,false},{0x3cc,637,2,false},{0x3cd,639,2,false},{0x3ce,641,2,false},{0x3d0,643,1,true},{0x3d1,644,1,true},
+	{0x3d2,645,1,true},{0x3d3,646,2,false},{0x3d4,648,2,false},{0x3d5,650,1,true},{0x3d6,651,1,true},{0x3f0,652,1,true},
+	{0x3f1,653,1,true},{0x3f2,654,1,true},{0x3f4,655,1,true},{0x3f5,656,1,true},{0x3f9,657,1,true},{0x400,658,2,false},
+	{0x401,660,2,false},{0x403,662,2,false},{0x407,664,2,false},{0x40c,666,2,false},{0x40d,668,2,false},{0x40e,670,2,false},
+	{0x419,672,2,false},{0x439,674,2,false},{0x450,676,2,false},{0x451,678,2,false},{0x453,680,2,false},{0x457,682,2,false},
+	{0x45c,684,2,false},{0x45d,686,2,false},{0x45e,688,2,false},{0x476,690,2,false},{0x477,692,2,false},{0x4c1,694,2,false},
+	{0x4c2,696,2,false},{0x4d0,698,2,false},{0x4d1,700,2,false},{0x4d2,702,2,false},{0x4d3,704,2,false},{0x4d6,706,2,false},
+	{0x4d7,708,2,false},{0x4da,710,2,false},{0x4db,712,2,false},{0x4dc,714,2,false},{0x4dd,716,2,false},{0x4de,718,2,false},
+	{0x4df,720,2,false},{0x4e2,722,2,false},{0x4e3,724,2,false},{0x4e4,726,2,false},{0x4e5,728,2,false},{0x4e6,730,2,false},
+	{0x4e7,732,2,false},{0x4ea,734,2,false},{0x4eb,736,2,false},{0x4ec,738,2,false},{0x4ed,740,2,false},{0x4ee,742,2,false},
+	{0x4ef,744,2,false},{0x4f0,746,2,false},{0x4f1,748,2,false},{0x4f2,750,2,false},{0x4f3,752,2,false},{0x4f4,754,2,false},
+	{0x4f5,756,2,false},{0x4f8,758,2,false},{0x4f9,760,2,false},{0x587,762,2,true},{0x622,764,2,false},{0x623,766,2,false},
+	{0x624,768,2,false},{0x625,770,2,false},{0x626,772,2,false},{0x675,774,2,true},{0x676,776,2,true},{0x677,778,2,true},
+	{0x678,780,2,true},{0x6c0,782,2,false},{0x6c2,784,2,false},{0x6d3,786,2,false},{0x929,788,2,false},{0x931,790,2,false},
+	{0x934,792,2,false},{0x958,794,2,false},{0x959,796,2,false},{0x95a,798,2,false},{0x95b,800,2,false},{0x95c,802,2,false},
+	{0x95d,804,2,false},{0x95e,806,2,false},{0x95f,808,2,false},{0x9cb,810,2,false},{0x9cc,812,2,false},{0x9dc,814,2,false},
+	{0x9dd,816,2,false},{0x9df,818,2,false},{0xa33,820,2,false},{0xa36,822,2,false},{0xa59,824,2,false},{0xa5a,826,2,false},
+	{0xa5b,828,2,false},{0xa5e,830,2,false},{0xb48,832,2,false},{0xb4b,834,2,false},{0xb4c,836,2,false},{0xb5c,838,2,false},
+	{0xb5d,840,2,false},{0xb94,842,2,false},{0xbca,844,2,false},{0xbcb,846,2,false},{0xbcc,848,2,false},{0xc48,850,2,false},
+	{0xcc0,852,2,false},{0xcc7,854,2,false},{0xcc8,856,2,false},{0xcca,858,2,false},{0xccb,860,2,false},{0xd4a,862,2,false},
+	{0xd4b,864,2,false},{0xd4c,866,2,false},{0xdda,868,2,false},{0xddc,870,2,false},{0xddd,872,2,false},{0xdde,874,2,false},
+	{0xe33,876,2,true},{0xeb3,878,2,true},{0xedc,880,2,true},{0xedd,882,2,true},{0xf0c,884,1,true},{0xf43,885,2,false},
+	{0xf4d,887,2,false},{0xf52,889,2,false},{0xf57,891,2,false},{0xf5c,893,2,false},{0xf69,895,2,false},{0xf73,897,2,false},
+	{0xf75,899,2,false},{0xf76,901,2,false},{0xf77,903,2,true},{0xf78,905,2,false},{0xf79,907,2,true},{0xf81,909,2,false},
+	{0xf93,911,2,false},{0xf9d,913,2,false},{0xfa2,915,2,false},{0xfa7,917,2,false},{0xfac,919,2,false},{0xfb9,921,2,false},
+	{0x1026,923,2,false},{0x10fc,925,1,true},{0x1b06,926,2,false},{0x1b08,928,2,false},{0x1b0a,930,2,false},{0x1b0c,932,2,false},
+	{0x1b0e,934,2,false},{0x1b12,936,2,false},{0x1b3b,938,2,false},{0x1b3d,940,2,false},{0x1b40,942,2,false},{0x1b41,944,2,false},
+	{0x1b43,946,2,false},{0x1d2c,948,1,true},{0x1d2d,949,1,true},{0x1d2e,950,1,true},{0x1d30,951,1,true},{0x1d31,952,1,true},
+	{0x1d32,953,1,true},{0x1d33,954,1,true},{0x1d34,955,1,true},{0x1d35,956,1,true},{0x1d36,957,1,true},{0x1d37,958,1,true},
+	{0x1d38,959,1,true},{0x1d39,960,1,true},{0x1d3a,961,1,true},{0x1d3c,962,1,true},{0x1d3d,963,1,true},{0x1d3e,964,1,true},
+	{0x1d3f,965,1,true},{0x1d40,966,1,true},{0x1d41,967,1,true},{0x1d42,968,1,true},{0x1d43,969,1,true},{0x1d44,970,1,true},
+	{0x1d45,971,1,true},{0x1d46,972,1,true},{0x1d47,973,1,true},{0x1d48,974,1,true},{0x1d49,975,1,true},{0x1d4a,976,1,true},
+	{0x1d4b,977,1,true},{0x1d4c,978,1,true},{0x1d4d,979,1,true},{0x1d4f,980,1,true},{0x1d50,981,1,true},{0x1d51,982,1,true},
+	{0x1d52,983,1,true},{0x1d53,984,1,true},{0x1d54,985,1,true},{0x1d55,986,1,true},{0x1d56,987,1,true},{0x1d57,988,1,true},
+	{0x1d58,989,1,true},{0x1d59,990,1,true},{0x1d5a,991,1,true},{0x1d5b,992,1,true},{0x1d5c,993,1,true},{0x1d5d,994,1,true},
+	{0x1d5e,995,1,true},{0x1d5f,996,1,true},{0x1d60,997,1,true},{0x1d61,998,1,true},{0x1d62,999,1,true},{0x1d63,1000,1,true},
+	{0x1d64,1001,1,true},{0x1d65,1002,1,true},{0x1d66,1003,1,true},{0x1d67,1004,1,true},{0x1d68,1005,1,true},{0x1d69,1006,1,true},
+	{0x1d6a,1007,1,true},{0x1d78,1008,1,true},{0x1d9b,1009,1,true},{0x1d9c,1010,1,true},{0x1d9d,1011,1,true},{0x1d9e,1012,1,true},
+	{0x1d9f,1013,1,true},{0x1da0,1014,1,true},{0x1da1,1015,1,true},{0x1da2,1016,1,true},{0x1da3,1017,1,true},{0x1da4,1018,1,true},
+	{0x1da5,1019,1,true},{0x1da6,1020,1,true},{0x1da7,1021,1,true},{0x1da8,1022,1,true},{0x1da9,1023,1,true},{0x1daa,1024,1,true},
+	{0x1dab,1025,1,true},{0x1dac,1026,1,true},{0x1dad,1027,1,true},{0x1dae,1028,1,true},{0x1daf,1029,1,true},{0x1db0,1030,1,true},
+	{0x1db1,1031,1,true},{0x1db2,1032,1,true},{0x1db3,1033,1,true},{0x1db4,1034,1,true},{0x1db5,1035,1,true},{0x1db6,1036,1,true},
+	{0x1db7,1037,1,true},{0x1db8,1038,1,true},{0x1db9,1039,1,true},{0x1dba,1040,1,true},{0x1dbb,1041,1,true},{0x1dbc,1042,1,true},
+	{0x1dbd,1043,1,true},{0x1dbe,1044,1,true},{0x1dbf,1045,1,true},{0x1e00,1046,2,false},{0x1e01,1048,2,false},{0x1e02,1050,2,false},
+	{0x1e03,1052,2,false},{0x1e04,1054,2,false},{0x1e05,1056,2,false},{0x1e06,1058,2,false},{0x1e07,1060,2,false},{0x1e08,1062,2,false},
+	{0x1e09,1064,2,false},{0x1e0a,1066,2,false},{0x1e0b,1068,2,false},{0x1e0c,1070,2,false},{0x1e0d,1072,2,false},{0x1e0e,1074,2,false},
+	{0x1e0f,1076,2,false},{0x1e10,1078,2,false},{0x1e11,1080,2,false},{0x1e12,1082,2,false},{0x1e13,1084,2,false},{0x1e14,1086,2,false},
+	{0x1e15,1088,2,false},{0x1e16,1090,2,false},{0x1e17,1092,2,false},{0x1e18,1094,2,false},{0x1e19,1096,2,false},{0x1e1a,1098,2,false},
+	{0x1e1b,1100,2,false},{0x1e1c,1102,2,false},{0x1e1d,1104,2,false},{0x1e1e,1106,2,false},{0x1e1f,1108,2,false},{0x1e20,1110,2,false},
+	{0x1e21,1112,2,false},{0x1e22,1114,2,false},{0x1e23,1116,2,false},{0x1e24,1118,2,false},{0x1e25,1120,2,false},{0x1e26,1122,2,false},
+	{0x1e27,1124,2,false},{0x1e28,1126,2,false},{0x1e29,1128,2,false},{0x1e2a,1130,2,false},{0x1e2b,1132,2,false},{0x1e2c,1134,2,false},
+	{0x1e2d,1136,2,false},{0x1e2e,1138,2,false},{0x1e2f,1140,2,false},{0x1e30,1142,2,false},{0x1e31,1144,2,false},{0x1e32,1146,2,false},
+	{0x1e33,1148,2,false},{0x1e34,1150,2,false},{0x1e35,1152,2,false},{0x1e36,1154,2,false},{0x1e37,1156,2,false},{0x1e38,1158,2,false},
+	{0x1e39,1160,2,false},{0x1e3a,1162,2,false},{0x1e3b,1164,2,false},{0x1e3c,1166,2,false},{0x1e3d,1168,2,false},{0x1e3e,1170,2,false},
+	{0x1e3f,1172,2,false},{0x1e40,1174,2,false},{0x1e41,1176,2,false},{0x1e42,1178,2,false},{0x1e43,1180,2,false},{0x1e44,1182,2,false},
+	{0x1e45,1184,2,false},{0x1e46,1186,2,false},{0x1e47,1188,2,false},{0x1e48,1190,2,false},{0x1e49,1192,2,false},{0x1e4a,1194,2,false},
+	{0x1e4b,1196,2,false},{0x1e4c,1198,2,false},{0x1e4d,1200,2,false},{0x1e4e,1202,2,false},{0x1e4f,1204,2,false},{0x1e50,1206,2,false},
+	{0x1e51,1208,2,false},{0x1e52,1210,2,false},{0x1e53,1212,2,false},{0x1e54,1214,2,false},{0x1e55,1216,2,false},{0x1e56,1218,2,false},
+	{0x1e57,1220,2,false},{0x1e58,1222,2,false},{0x1e59,1224,2,false},{0x1e5a,1226,2,false},{0x1e5b,1228,2,false},{0x1e5c,1230,2,false},
+	{0x1e5d,1232,2,false},{0x1e5e,1234,2,false},{0x1e5f,1236,2,false},{0x1e60,1238,2,false},{0x1e61,1240,2,false},{0x1e62,1242,2,false},
+	{0x1e63,1244,2,false},{0x1e64,1246,2,false},{0x1e65,1248,2,false},{0x1e66,1250,2,false},{0x1e67,1252,2,false},{0x1e68,1254,2,false},
+	{0x1e69,1256,2,false},{0x1e6a,1258,2,false},{0x1e6b,1260,2,false},{0x1e6c,1262,2,false},{0x1e6d,1264,2,false},{0x1e6e,1266,2,false},
+	{0x1e6f,1268,2,false},{0x1e70,1270,2,false},{0x1e71,1272,2,false},{0x1e72,1274,2,false},{0x1e73,1276,2,false},{0x1e74,1278,2,false},
+	{0x1e75,1280,2,false},{0x1e76,1282,2,false},{0x1e77,1284,2,false},{0x1e78,1286,2,false},{0x1e79,1288,2,false},{0x1e7a,1290,2,false},
+	{0x1e7b,1292,2,false},{0x1e7c,1294,2,false},{0x1e7d,1296,2,false},{0x1e7e,1298,2,false},{0x1e7f,1300,2,false},{0x1e80,1302,2,false},
+	{0x1e81,1304,2,false},{0x1e82,1306,2,false},{0x1e83,1308,2,false},{0x1e84,1310,2,false},{0x1e85,1312,2,false},{0x1e86,1314,2,false},
+	{0x1e87,1316,2,false},{0x1e88,1318,2,false},{0x1e89,1320,2,false},{0x1e8a,1322,2,false},{0x1e8b,1324,2,false},{0x1e8c,1326,2,false},
+	{0x1e8d,1328,2,false},{0x1e8e,1330,2,false},{0x1e8f,1332,2,false},{0x1e90,1334,2,false},{0x1e91,1336,2,false},{0x1e92,1338,2,false},
+	{0x1e93,1340,2,false},{0x1e94,1342,2,false},{0x1e95,1344,2,false},{0x1e96,1346,2,false},{0x1e97,1348,2,false},{0x1e98,1350,2,false},
+	{0x1e99,1352,2,false},{0x1e9a,1354,2,true},{0x1e9b,1356,2,false},{0x1ea0,1358,2,false},{0x1ea1,1360,2,false},{0x1ea2,1362,2,false},
+	{0x1ea3,1364,2,false},{0x1ea4,1366,2,false},{0x1ea5,1368,2,false},{0x1ea6,1370,2,false},{0x1ea7,1372,2,false},{0x1ea8,1374,2,false},
+	{0x1ea9,1376,2,false},{0x1eaa,1378,2,false},{0x1eab,1380,2,false},{0x1eac,1382,2,false},{0x1ead,1384,2,false},{0x1eae,1386,2,false},
+	{0x1eaf,1388,2,false},{0x1eb0,1390,2,false},{0x1eb1,1392,2,false},{0x1eb2,1394,2,false},{0x1eb3,1396,2,false},{0x1eb4,1398,2,false},
+	{0x1eb5,1400,2,false},{0x1eb6,1402,2,false},{0x1eb7,1404,2,false},{0x1eb8,1406,2,false},{0x1eb9,1408,2,false},{0x1eba,1410,2,false},
+	{0x1ebb,1412,2,false},{0x1ebc,1414,2,false},{0x1ebd,1416,2,false},{0x1ebe,1418,2,false},{0x1ebf,1420,2,false},{0x1ec0,1422,2,false},
+	{0x1ec1,1424,2,false},{0x1ec2,1426,2,false},{0x1ec3,1428,2,false},{0x1ec4,1430,2,false},{0x1ec5,1432,2,false},{0x1ec6,1434,2,false},
+	{0x1ec7,1436,2,false},{0x1ec8,1438,2,false},{0x1ec9,1440,2,false},{0x1eca,1442,2,false},{0x1ecb,1444,2,false},{0x1ecc,1446,2,false},
+	{0x1ecd,1448,2,false},{0x1ece,1450,2,false},{0x1ecf,1452,2,false},{0x1ed0,1454,2,false},{0x1ed1,1456,2,false},{0x1ed2,1458,2,false},
+	{0x1ed3,1460,2,false},{0x1ed4,1462,2,false},{0x1ed5,1464,2,false},{0x1ed6,1466,2,false},{0x1ed7,1468,2,false},{0x1ed8,1470,2,false},
+	{0x1ed9,1472,2,false},{0x1eda,1474,2,false},{0x1edb,1476,2,false},{0x1edc,1478,2,false},{0x1edd,1480,2,false},{0x1ede,1482,2,false},
+	{0x1edf,1484,2,false},{0x1ee0,1486,2,false},{0x1ee1,1488,2,false},{0x1ee2,1490,2,false},{0x1ee3,1492,2,false},{0x1ee4,1494,2,false},
+	{0x1ee5,1496,2,false},{0x1ee6,1498,2,false},{0x1ee7,1500,2,false},{0x1ee8,1502,2,false},{0x1ee9,1504,2,false},{0x1eea,1506,2,false},
+	{0x1eeb,1508,2,false},{0x1eec,1510,2,false},{0x1eed,1512,2,false},{0x1eee,1514,2,false},{0x1eef,1516,2,false},{0x1ef0,1518,2,false},
+	{0x1ef1,1520,2,false},{0x1ef2,1522,2,false},{0x1ef3,1524,2,false},{0x1ef4,1526,2,false},{0x1ef5,1528,2,false},{0x1ef6,1530,2,false},
+	{0x1ef7,1532,2,false},{0x1ef8,1534,2,false},{0x1ef9,1536,2,false},{0x1f00,1538,2,false},{0x1f01,1540,2,false},{0x1f02,1542,2,false},
+	{0x1f03,1544,2,false},{0x1f04,1546,2,false},{0x1f05,1548,2,false},{0x1f06,1550,2,false},{0x1f07,1552,2,false},{0x1f08,1554,2,false},
+	{0x1f09,1556,2,false},{0x1f0a,1558,2,false},{0x1f0b,1560,2,false},{0x1f0c,1562,2,false},{0x1f0d,1564,2,false},{0x1f0e,1566,2,false},
+	{0x1f0f,1568,2,false},{0x1f10,1570,2,false},{0x1f11,1572,2,false},{0x1f12,1574,2,false},{0x1f13,1576,2,false},{0x1f14,1578,2,false},
+	{0x1f15,1580,2,false},{0x1f18,1582,2,false},{0x1f19,1584,2,false},{0x1f1a,1586,2,false},{0x1f1b,1588,2,false},{0x1f1c,1590,2,false},
+	{0x1f1d,1592,2,false},{0x1f20,1594,2,false},{0x1f21,1596,2,false},{0x1f22,1598,2,false},{0x1f23,1600,2,false},{0x1f24,1602,2,false},
+	{0x1f25,1604,2,false},{0x1f26,1606,2,false},{0x1f27,1608,2,false},{0x1f28,1610,2,false},{0x1f29,1612,2,false},{0x1f2a,1614,2,false},
+	{0x1f2b,1616,2,false},{0x1f2c,1618,2,false},{0x1f2d,1620,2,false},{0x1f2e,1622,2,false},{0x1f2f,1624,2,false},{0x1f30,1626,2,false},
+	{0x1f31,1628,2,false},{0x1f32,1630,2,false},{0x1f33,1632,2,false},{0x1f34,1634,2,false},{0x1f35,1636,2,false},{0x1f36,1638,2,false},
+	{0x1f37,1640,2,false},{0x1f38,1642,2,false},{0x1f39,1644,2,false},{0x1f3a,1646,2,false},{0x1f3b,1648,2,false},{0x1f3c,1650,2,false},
+	{0x1f3d,1652,2,false},{0x1f3e,1654,2,false},{0x1f3f,1656,2,false},{0x1f40,1658,2,false},{0x1f41,1660,2,false},{0x1f42,1662,2,false},
+	{0x1f43,1664,2,false},{0x1f44,1666,2,false},{0x1f45,1668,2,false},{0x1f48,1670,2,false},{0x1f49,1672,2,false},{0x1f4a,1674,2,false},
+	{0x1f4b,1676,2,false},{0x1f4c,1678,2,false},{0x1f4d,1680,2,false},{0x1f50,1682,2,false},{0x1f51,1684,2,false},{0x1f52,1686,2,false},
+	{0x1f53,1688,2,false},{0x1f54,1690,2,false},{0x1f55,1692,2,false},{0x1f56,1694,2,false},{0x1f57,1696,2,false},{0x1f59,1698,2,false},
+	{0x1f5b,1700,2,false},{0x1f5d,1702,2,false},{0x1f5f,1704,2,false},{0x1f60,1706,2,false},{0x1f61,1708,2,false},{0x1f62,1710,2,false},
+	{0x1f63,1712,2,false},{0x1f64,1714,2,false},{0x1f65,1716,2,false},{0x1f66,1718,2,false},{0x1f67,1720,2,false},{0x1f68,1722,2,false},
+	{0x1f69,1724,2,false},{0x1f6a,1726,2,false},{0x1f6b,1728,2,false},{0x1f6c,1730,2,false},{0x1f6d,1732,2,false},{0x1f6e,1734,2,false},
+	{0x1f6f,1736,2,false},{0x1f70,1738,2,false},{0x1f71,1740,1,false},{0x1f72,1741,2,false},{0x1f73,1743,1,false},{0x1f74,1744,2,false},
+	{0x1f75,1746,1,false},{0x1f76,1747,2,false},{0x1f77,1749,1,false},{0x1f78,1750,2,false},{0x1f79,1752,1,false},{0x1f7a,1753,2,false},
+	{0x1f7b,1755,1,false},{0x1f7c,1756,2,false},{0x1f7d,1758,1,false},{0x1f80,1759,2,false},{0x1f81,1761,2,false},{0x1f82,1763,2,false},
+	{0x1f83,1765,2,false},{0x1f84,1767,2,false},{0x1f85,1769,2,false},{0x1f86,1771,2,false},{0x1f87,1773,2,false},{0x1f88,1775,2,false},
+	{0x1f89,1777,2,false},{0x1f8a,1779,2,false},{0x1f8b,1781,2,false},{0x1f8c,1783,2,false},{0x1f8d,1785,2,false},{0x1f8e,1787,2,false},
+	{0x1f8f,1789,2,false},{0x1f90,1791,2,false},{0x1f91,1793,2,false},{0x1f92,1795,2,false},{0x1f93,1797,2,false},{0x1f94,1799,2,false},
+	{0x1f95,1801,2,false},{0x1f96,1803,2,false},{0x1f97,1805,2,false},{0x1f98,1807,2,false},{0x1f99,1809,2,false},{0x1f9a,1811,2,false},
+	{0x1f9b,1813,2,false},{0x1f9c,1815,2,false},{0x1f9d,1817,2,false},{0x1f9e,1819,2,false},{0x1f9f,1821,2,false},{0x1fa0,1823,2,false},
+	{0x1fa1,1825,2,false},{0x1fa2,1827,2,false},{0x1fa3,1829,2,false},{0x1fa4,1831,2,false},{0x1fa5,1833,2,false},{0x1fa6,1835,2,false},
+	{0x1fa7,1837,2,false},{0x1fa8,1839,2,false},{0x1fa9,1841,2,false},{0x1faa,1843,2,false},{0x1fab,1845,2,false},{0x1fac,1847,2,false},
+	{0x1fad,1849,2,false},{0x1fae,1851,2,false},{0x1faf,1853,2,false},{0x1fb0,1855,2,false},{0x1fb1,1857,2,false},{0x1fb2,1859,2,false},
+	{0x1fb3,1861,2,false},{0x1fb4,1863,2,false},{0x1fb6,1865,2,false},{0x1fb7,1867,2,false},{0x1fb8,1869,2,false},{0x1fb9,1871,2,false},
+	{0x1fba,1873,2,false},{0x1fbb,1875,1,false},{0x1fbc,1876,2,false},{0x1fbd,1878,2,true},{0x1fbe,1880,1,false},{0x1fbf,1881,2,true},
+	{0x1fc0,1883,2,true},{0x1fc1,1885,2,false},{0x1fc2,1887,2,false},{0x1fc3,1889,2,false},{0x1fc4,1891,2,false},{0x1fc6,1893,2,false},
+	{0x1fc7,1895,2,false},{0x1fc8,1897,2,false},{0x1fc9,1899,1,false},{0x1fca,1900,2,false},{0x1fcb,1902,1,false},{0x1fcc,1903,2,false},
+	{0x1fcd,1905,2,false},{0x1fce,1907,2,false},{0x1fcf,1909,2,false},{0x1fd0,1911,2,false},{0x1fd1,1913,2,false},{0x1fd2,1915,2,false},
+	{0x1fd3,1917,1,false},{0x1fd6,1918,2,false},{0x1fd7,1920,2,false},{0x1fd8,1922,2,false},{0x1fd9,1924,2,false},{0x1fda,1926,2,false},
+	{0x1fdb,1928,1,false},{0x1fdd,1929,2,false},{0x1fde,1931,2,false},{0x1fdf,1933,2,false},{0x1fe0,1935,2,false},{0x1fe1,1937,2,false},
+	{0x1fe2,1939,2,false},{0x1fe3,1941,1,false},{0x1fe4,1942,2,false},{0x1fe5,1944,2,false},{0x1fe6,1946,2,false},{0x1fe7,1948,2,false},
+	{0x1fe8,1950,2,false},{0x1fe9,1952,2,false},{0x1fea,1954,2,false},{0x1feb,1956,1,false},{0x1fec,1957,2,false},{0x1fed,1959,2,false},
+	{0x1fee,1961,1,false},{0x1fef,1962,1,false},{0x1ff2,1963,2,false},{0x1ff3,1965,2,false},{0x1ff4,1967,2,false},{0x1ff6,1969,2,false},
+	{0x1ff7,1971,2,false},{0x1ff8,1973,2,false},{0x1ff9,1975,1,false},{0x1ffa,1976,2,false},{0x1ffb,1978,1,false},{0x1ffc,1979,2,false},
+	{0x1ffd,1981,1,false},{0x1ffe,1982,2,true},{0x2000,1984,1,false},{0x2001,1985,1,false},{0x2002,1986,1,true},{0x2003,1987,1,true},
+	{0x2004,1988,1,true},{0x2005,1989,1,true},{0x2006,1990,1,true},{0x2007,1991,1,true},{0x2008,1992,1,true},{0x2009,1993,1,true},
+	{0x200a,1994,1,true},{0x2011,1995,1,true},{0x2017,1996,2,true},{0x2024,1998,1,true},{0x2025,1999,2,true},{0x2026,2001,3,true},
+	{0x202f,2004,1,true},{0x2033,2005,2,true},{0x2034,2007,3,true},{0x2036,2010,2,true},{0x2037,2012,3,true},{0x203c,2015,2,true},
+	{0x203e,2017,2,true},{0x2047,2019,2,true},{0x2048,2021,2,true},{0x2049,2023,2,true},{0x2057,2025,4,true},{0x205f,2029,1,true},
+	{0x2070,2030,1,true},{0x2071,2031,1,true},{0x2074,2032,1,true},{0x2075,2033,1,true},{0x2076,2034,1,true},{0x2077,2035,1,true},
+	{0x2078,2036,1,true},{0x2079,2037,1,true},{0x207a,2038,1,true},{0x207b,2039,1,true},{0x207c,2040,1,true},{0x207d,2041,1,true},
+	{0x207e,2042,1,true},{0x207f,2043,1,true},{0x2080,2044,1,true},{0x2081,2045,1,true},{0x2082,2046,1,true},{0x2083,2047,1,true},
+	{0x2084,2048,1,true},{0x2085,2049,1,true},{0x2086,2050,1,true},{0x2087,2051,1,true},{0x2088,2052,1,true},{0x2089,2053,1,true},
+	{0x208a,2054,1,true},{0x208b,2055,1,true},{0x208c,2056,1,true},{0x208d,2057,1,true},{0x208e,2058,1,true},{0x2090,2059,1,true},
+	{0x2091,2060,1,true},{0x2092,2061,1,true},{0x2093,2062,1,true},{0x2094,2063,1,true},{0x2095,2064,1,true},{0x2096,2065,1,true},
+	{0x2097,2066,1,true},{0x2098,2067,1,true},{0x2099,2068,1,true},{0x209a,2069,1,true},{0x209b,2070,1,true},{0x209c,2071,1,true},
+	{0x20a8,2072,2,true},{0x2100,2074,3,true},{0x2101,2077,3,true},{0x2102,2080,1,true},{0x2103,2081,2,true},{0x2105,2083,3,true},
+	{0x2106,2086,3,true},{0x2107,2089,1,true},{0x2109,2090,2,true},{0x210a,2092,1,true},{0x210b,2093,1,true},{0x210c,2094,1,true},
+	{0x210d,2095,1,true},{0x210e,2096,1,true},{0x210f,2097,1,true},{0x2110,2098,1,true},{0x2111,2099,1,true},{0x2112,2100,1,true},
+	{0x2113,2101,1,true},{0x2115,2102,1,true},{0x2116,2103,2,true},{0x2119,2105,1,true},{0x211a,2106,1,true},{0x211b,2107,1,true},
+	{0x211c,2108,1,true},{0x211d,2109,1,true},{0x2120,2110,2,true},{0x2121,2112,3,true},{0x2122,2115,2,true},{0x2124,2117,1,true},
+	{0x2126,2118,1,false},{0x2128,2119,1,true},{0x212a,2120,1,false},{0x212b,2121,1,false},{0x212c,2122,1,true},{0x212d,2123,1,true},
+	{0x212f,2124,1,true},{0x2130,2125,1,true},{0x2131,2126,1,true},{0x2133,2127,1,true},{0x2134,2128,1,true},{0x2135,2129,1,true},
+	{0x2136,2130,1,true},{0x2137,2131,1,true},{0x2138,2132,1,true},{0x2139,2133,1,true},{0x213b,2134,3,true},{0x213c,2137,1,true},
+	{0x213d,2138,1,true},{0x213e,2139,1,true},{0x213f,2140,1,true},{0x2140,2141,1,true},{0x2145,2142,1,true},{0x2146,2143,1,true},
+	{0x2147,2144,1,true},{0x2148,2145,1,true},{0x2149,2146,1,true},{0x2150,2147,3,true},{0x2151,2150,3,true},{0x2152,2153,4,true},
+	{0x2153,2157,3,true},{0x2154,2160,3,true},{0x2155,2163,3,true},{0x2156,2166,3,true},{0x2157,2169,3,true},{0x2158,2172,3,true},
+	{0x2159,2175,3,true},{0x215a,2178,3,true},{0x215b,2181,3,true},{0x215c,2184,3,true},{0x215d,2187,3,true},{0x215e,2190,3,true},
+	{0x215f,2193,2,true},{0x2160,2195,1,true},{0x2161,2196,2,true},{0x2162,2198,3,true},{0x2163,2201,2,true},{0x2164,2203,1,true},
+	{0x2165,2204,2,true},{0x2166,2206,3,true},{0x2167,2209,4,true},{0x2168,2213,2,true},{0x2169,2215,1,true},{0x216a,2216,2,true},
+	{0x216b,2218,3,true},{0x216c,2221,1,true},{0x216d,2222,1,true},{0x216e,2223,1,true},{0x216f,2224,1,true},{0x2170,2225,1,true},
+	{0x2171,2226,2,true},{0x2172,2228,3,true},{0x2173,2231,2,true},{0x2174,2233,1,true},{0x2175,2234,2,true},{0x2176,2236,3,true},
+	{0x2177,2239,4,true},{0x2178,2243,2,true},{0x2179,2245,1,true},{0x217a,2246,2,true},{0x217b,2248,3,true},{0x217c,2251,1,true},
+	{0x217d,2252,1,true},{0x217e,2253,1,true},{0x217f,2254,1,true},{0x2189,2255,3,true},{0x219a,2258,2,false},{0x219b,2260,2,false},
+	{0x21ae,2262,2,false},{0x21cd,2264,2,false},{0x21ce,2266,2,false},{0x21cf,2268,2,false},{0x2204,2270,2,false},{0x2209,2272,2,false},
+	{0x220c,2274,2,false},{0x2224,2276,2,false},{0x2226,2278,2,false},{0x222c,2280,2,true},{0x222d,2282,3,true},{0x222f,2285,2,true},
+	{0x2230,2287,3,true},{0x2241,2290,2,false},{0x2244,2292,2,false},{0x2247,2294,2,false},{0x2249,2296,2,false},{0x2260,2298,2,false},
+	{0x2262,2300,2,false},{0x226d,2302,2,false},{0x226e,2304,2,false},{0x226f,2306,2,false},{0x2270,2308,2,false},{0x2271,2310,2,false},
+	{0x2274,2312,2,false},{0x2275,2314,2,false},{0x2278,2316,2,false},{0x2279,2318,2,false},{0x2280,2320,2,false},{0x2281,2322,2,false},
+	{0x2284,2324,2,false},{0x2285,2326,2,false},{0x2288,2328,2,false},{0x2289,2330,2,false},{0x22ac,2332,2,false},{0x22ad,2334,2,false},
+	{0x22ae,2336,2,false},{0x22af,2338,2,false},{0x22e0,2340,2,false},{0x22e1,2342,2,false},{0x22e2,2344,2,false},{0x22e3,2346,2,false},
+	{0x22ea,2348,2,false},{0x22eb,2350,2,false},{0x22ec,2352,2,false},{0x22ed,2354,2,false},{0x2329,2356,1,false},{0x232a,2357,1,false},
+	{0x2460,2358,1,true},{0x2461,2359,1,true},{0x2462,2360,1,true},{0x2463,2361,1,true},{0x2464,2362,1,true},{0x2465,2363,1,true},
+	{0x2466,2364,1,true},{0x2467,2365,1,true},{0x2468,2366,1,true},{0x2469,2367,2,true},{0x246a,2369,2,true},{0x246b,2371,2,true},
+	{0x246c,2373,2,true},{0x246d,2375,2,true},{0x246e,2377,2,true},{0x246f,2379,2,true},{0x2470,2381,2,true},{0x2471,2383,2,true},
+	{0x2472,2385,2,true},{0x2473,2387,2,true},{0x2474,2389,3,true},{0x2475,2392,3,true},{0x2476,2395,3,true},{0x2477,2398,3,true},
+	{0x2478,2401,3,true},{0x2479,2404,3,true},{0x247a,2407,3,true},{0x247b,2410,3,true},{0x247c,2413,3,true},{0x247d,2416,4,true},
+	{0x247e,2420,4,true},{0x247f,2424,4,true},{0x2480,2428,4,true},{0x2481,2432,4,true},{0x2482,2436,4,true},{0x2483,2440,4,true},
+	{0x2484,2444,4,true},{0x2485,2448,4,true},{0x2486,2452,4,true},{0x2487,2456,4,true},{0x2488,2460,2,true},{0x2489,2462,2,true},
+	{0x248a,2464,2,true},{0x248b,2466,2,true},{0x248c,2468,2,true},{0x248d,2470,2,true},{0x248e,2472,2,true},{0x248f,2474,2,true},
+	{0x2490,2476,2,true},{0x2491,2478,3,true},{0x2492,2481,3,true},{0x2493,2484,3,true},{0x2494,2487,3,true},{0x2495,2490,3,true},
+	{0x2496,2493,3,true},{0x2497,2496,3,true},{0x2498,2499,3,true},{0x2499,2502,3,true},{0x249a,2505,3,true},{0x249b,2508,3,true},
+	{0x249c,2511,3,true},{0x249d,2514,3,true},{0x249e,2517,3,true},{0x249f,2520,3,true},{0x24a0,2523,3,true},{0x24a1,2526,3,true},
+	{0x24a2,2529,3,true},{0x24a3,2532,3,true},{0x24a4,2535,3,true},{0x24a5,2538,3,true},{0x24a6,2541,3,true},{0x24a7,2544,3,true},
+	{0x24a8,2547,3,true},{0x24a9,2550,3,true},{0x24aa,2553,3,true},{0x24ab,2556,3,true},{0x24ac,2559,3,true},{0x24ad,2562,3,true},
+	{0x24ae,2565,3,true},{0x24af,2568,3,true},{0x24b0,2571,3,true},{0x24b1,2574,3,true},{0x24b2,2577,3,true},{0x24b3,2580,3,true},
+	{0x24b4,2583,3,true},{0x24b5,2586,3,true},{0x24b6,2589,1,true},{0x24b7,2590,1,true},{0x24b8,2591,1,true},{0x24b9,2592,1,true},
+	{0x24ba,2593,1,true},{0x24bb,2594,1,true},{0x24bc,2595,1,true},{0x24bd,2596,1,true},{0x24be,2597,1,true},{0x24bf,2598,1,true},
+	{0x24c0,2599,1,true},{0x24c1,2600,1,true},{0x24c2,2601,1,true},{0x24c3,2602,1,true},{0x24c4,2603,1,true},{0x24c5,2604,1,true},
+	{0x24c6,2605,1,true},{0x24c7,2606,1,true},{0x24c8,2607,1,true},{0x24c9,2608,1,true},{0x24ca,2609,1,true},{0x24cb,2610,1,true},
+	{0x24cc,2611,1,true},{0x24cd,2612,1,true},{0x24ce,2613,1,true},{0x24cf,2614,1,true},{0x24d0,2615,1,true},{0x24d1,2616,1,true},
+	{0x24d2,2617,1,true},{0x24d3,2618,1,true},{0x24d4,2619,1,true},{0x24d5,2620,1,true},{0x24d6,2621,1,true},{0x24d7,2622,1,true},
+	{0x24d8,2623,1,true},{0x24d9,2624,1,true},{0x24da,2625,1,true},{0x24db,2626,1,true},{0x24dc,2627,1,true},{0x24dd,2628,1,true},
+	{0x24de,2629,1,true},{0x24df,2630,1,true},{0x24e0,2631,1,true},{0x24e1,2632,1,true},{0x24e2,2633,1,true},{0x24e3,2634,1,true},
+	{0x24e4,2635,1,true},{0x24e5,2636,1,true},{0x24e6,2637,1,true},{0x24e7,2638,1,true},{0x24e8,2639,1,true},{0x24e9,2640,1,true},
+	{0x24ea,2641,1,true},{0x2a0c,2642,4,true},{0x2a74,2646,3,true},{0x2a75,2649,2,true},{0x2a76,2651,3,true},{0x2adc,2654,2,false},
+	{0x2c7c,2656,1,true},{0x2c7d,2657,1,true},{0x2d6f,2658,1,true},{0x2e9f,2659,1,true},{0x2ef3,2660,1,true},{0x2f00,2661,1,true},
+	{0x2f01,2662,1,true},{0x2f02,2663,1,true},{0x2f03,2664,1,true},{0x2f04,2665,1,true},{0x2f05,2666,1,true},{0x2f06,2667,1,true},
+	{0x2f07,2668,1,true},{0x2f08,2669,1,true},{0x2f09,2670,1,true},{0x2f0a,2671,1,true},{0x2f0b,2672,1,true},{0x2f0c,2673,1,true},
+	{0x2f0d,2674,1,true},{0x2f0e,2675,1,true},{0x2f0f,2676,1,true},{0x2f10,2677,1,true},{0x2f11,2678,1,true},{0x2f12,2679,1,true},
+	{0x2f13,2680,1,true},{0x2f14,2681,1,true},{0x2f15,2682,1,true},{0x2f16,2683,1,true},{0x2f17,2684,1,true},{0x2f18,2685,1,true},
+	{0x2f19,2686,1,true},{0x2f1a,2687,1,true},{0x2f1b,2688,1,true},{0x2f1c,2689,1,true},{0x2f1d,2690,1,true},{0x2f1e,2691,1,true},
+	{0x2f1f,2692,1,true},{0x2f20,2693,1,true},{0x2f21,2694,1,true},{0x2f22,2695,1,true},{0x2f23,2696,1,true},{0x2f24,2697,1,true},
+	{0x2f25,2698,1,true},{0x2f26,2699,1,true},{0x2f27,2700,1,true},{0x2f28,2701,1,true},{0x2f29,2702,1,true},{0x2f2a,2703,1,true},
+	{0x2f2b,2704,1,true},{0x2f2c,2705,1,true},{0x2f2d,2706,1,true},{0x2f2e,2707,1,true},{0x2f2f,2708,1,true},{0x2f30,2709,1,true},
+	{0x2f31,2710,1,true},{0x2f32,2711,1,true},{0x2f33,2712,1,true},{0x2f34,2713,1,true},{0x2f35,2714,1,true},{0x2f36,2715,1,true},
+	{0x2f37,2716,1,true},{0x2f38,2717,1,true},{0x2f39,2718,1,true},{0x2f3a,2719,1,true},{0x2f3b,2720,1,true},{0x2f3c,2721,1,true},
+	{0x2f3d,2722,1,true},{0x2f3e,2723,1,true},{0x2f3f,2724,1,true},{0x2f40,2725,1,true},{0x2f41,2726,1,true},{0x2f42,2727,1,true},
+	{0x2f43,2728,1,true},{0x2f44,2729,1,true},{0x2f45,2730,1,true},{0x2f46,2731,1,true},{0x2f47,2732,1,true},{0x2f48,2733,1,true},
+	{0x2f49,2734,1,true},{0x2f4a,2735,1,true},{0x2f4b,2736,1,true},{0x2f4c,2737,1,true},{0x2f4d,2738,1,true},{0x2f4e,2739,1,true},
+	{0x2f4f,2740,1,true},{0x2f50,2741,1,true},{0x2f51,2742,1,true},{0x2f52,2743,1,true},{0x2f53,2744,1,true},{0x2f54,2745,1,true},
+	{0x2f55,2746,1,true},{0x2f56,2747,1,true},{0x2f57,2748,1,true},{0x2f58,2749,1,true},{0x2f59,2750,1,true},{0x2f5a,2751,1,true},
+	{0x2f5b,2752,1,true},{0x2f5c,2753,1,true},{0x2f5d,2754,1,true},{0x2f5e,2755,1,true},{0x2f5f,2756,1,true},{0x2f60,2757,1,true},
+	{0x2f61,2758,1,true},{0x2f62,2759,1,true},{0x2f63,2760,1,true},{0x2f64,2761,1,true},{0x2f65,2762,1,true},{0x2f66,2763,1,true},
+	{0x2f67,2764,1,true},{0x2f68,2765,1,true},{0x2f69,2766,1,true},{0x2f6a,2767,1,true},{0x2f6b,2768,1,true},{0x2f6c,2769,1,true},
+	{0x2f6d,2770,1,true},{0x2f6e,2771,1,true},{0x2f6f,2772,1,true},{0x2f70,2773,1,true},{0x2f71,2774,1,true},{0x2f72,2775,1,true},
+	{0x2f73,2776,1,true},{0x2f74,2777,1,true},{0x2f75,2778,1,true},{0x2f76,2779,1,true},{0x2f77,2780,1,true},{0x2f78,2781,1,true},
+	{0x2f79,2782,1,true},{0x2f7a,2783,1,true},{0x2f7b,2784,1,true},{0x2f7c,2785,1,true},{0x2f7d,2786,1,true},{0x2f7e,2787,1,true},
+	{0x2f7f,2788,1,true},{0x2f80,2789,1,true},{0x2f81,2790,1,true},{0x2f82,2791,1,true},{0x2f83,2792,1,true},{0x2f84,2793,1,true},
+	{0x2f85,2794,1,true},{0x2f86,2795,1,true},{0x2f87,2796,1,true},{0x2f88,2797,1,true},{0x2f89,2798,1,true},{0x2f8a,2799,1,true},
+	{0x2f8b,2800,1,true},{0x2f8c,2801,1,true},{0x2f8d,2802,1,true},{0x2f8e,2803,1,true},{0x2f8f,2804,1,true},{0x2f90,2805,1,true},
+	{0x2f91,2806,1,true},{0x2f92,2807,1,true},{0x2f93,2808,1,true},{0x2f94,2809,1,true},{0x2f95,2810,1,true},{0x2f96,2811,1,true},
+	{0x2f97,2812,1,true},{0x2f98,2813,1,true},{0x2f99,2814,1,true},{0x2f9a,2815,1,true},{0x2f9b,2816,1,true},{0x2f9c,2817,1,true},
+	{0x2f9d,2818,1,true},{0x2f9e,2819,1,true},{0x2f9f,2820,1,true},{0x2fa0,2821,1,true},{0x2fa1,2822,1,true},{0x2fa2,2823,1,true},
+	{0x2fa3,2824,1,true},{0x2fa4,2825,1,true},{0x2fa5,2826,1,true},{0x2fa6,2827,1,true},{0x2fa7,2828,1,true},{0x2fa8,2829,1,true},
+	{0x2fa9,2830,1,true},{0x2faa,2831,1,true},{0x2fab,2832,1,true},{0x2fac,2833,1,true},{0x2fad,2834,1,true},{0x2fae,2835,1,true},
+	{0x2faf,2836,1,true},{0x2fb0,2837,1,true},{0x2fb1,2838,1,true},{0x2fb2,2839,1,true},{0x2fb3,2840,1,true},{0x2fb4,2841,1,true},
+	{0x2fb5,2842,1,true},{0x2fb6,2843,1,true},{0x2fb7,2844,1,true},{0x2fb8,2845,1,true},{0x2fb9,2846,1,true},{0x2fba,2847,1,true},
+	{0x2fbb,2848,1,true},{0x2fbc,2849,1,true},{0x2fbd,2850,1,true},{0x2fbe,2851,1,true},{0x2fbf,2852,1,true},{0x2fc0,2853,1,true},
+	{0x2fc1,2854,1,true},{0x2fc2,2855,1,true},{0x2fc3,2856,1,true},{0x2fc4,2857,1,true},{0x2fc5,2858,1,true},{0x2fc6,2859,1,true},
+	{0x2fc7,2860,1,true},{0x2fc8,2861,1,true},{0x2fc9,2862,1,true},{0x2fca,2863,1,true},{0x2fcb,2864,1,true},{0x2fcc,2865,1,true},
+	{0x2fcd,2866,1,true},{0x2fce,2867,1,true},{0x2fcf,2868,1,true},{0x2fd0,2869,1,true},{0x2fd1,2870,1,true},{0x2fd2,2871,1,true},
+	{0x2fd3,2872,1,true},{0x2fd4,2873,1,true},{0x2fd5,2874,1,true},{0x3000,2875,1,true},{0x3036,2876,1,true},{0x3038,2877,1,true},
+	{0x3039,2878,1,true},{0x303a,2879,1,true},{0x304c,2880,2,false},{0x304e,2882,2,false},{0x3050,2884,2,false},{0x3052,2886,2,false},
+	{0x3054,2888,2,false},{0x3056,2890,2,false},{0x3058,2892,2,false},{0x305a,2894,2,false},{0x305c,2896,2,false},{0x305e,2898,2,false},
+	{0x3060,2900,2,false},{0x3062,2902,2,false},{0x3065,2904,2,false},{0x3067,2906,2,false},{0x3069,2908,2,false},{0x3070,2910,2,false},
+	{0x3071,2912,2,false},{0x3073,2914,2,false},{0x3074,2916,2,false},{0x3076,2918,2,false},{0x3077,2920,2,false},{0x3079,2922,2,false},
+	{0x307a,2924,2,false},{0x307c,2926,2,false},{0x307d,2928,2,false},{0x3094,2930,2,false},{0x309b,2932,2,true},{0x309c,2934,2,true},
+	{0x309e,2936,2,false},{0x309f,2938,2,true},{0x30ac,2940,2,false},{0x30ae,2942,2,false},{0x30b0,2944,2,false},{0x30b2,2946,2,false},
+	{0x30b4,2948,2,false},{0x30b6,2950,2,false},{0x30b8,2952,2,false},{0x30ba,2954,2,false},{0x30bc,2956,2,false},{0x30be,2958,2,false},
+	{0x30c0,2960,2,false},{0x30c2,2962,2,false},{0x30c5,2964,2,false},{0x30c7,2966,2,false},{0x30c9,2968,2,false},{0x30d0,2970,2,false},
+	{0x30d1,2972,2,false},{0x30d3,2974,2,false},{0x30d4,2976,2,false},{0x30d6,2978,2,false},{0x30d7,2980,2,false},{0x30d9,2982,2,false},
+	{0x30da,2984,2,false},{0x30dc,2986,2,false},{0x30dd,2988,2,false},{0x30f4,2990,2,false},{0x30f7,2992,2,false},{0x30f8,2994,2,false},
+	{0x30f9,2996,2,false},{0x30fa,2998,2,false},{0x30fe,3000,2,false},{0x30ff,3002,2,true},{0x3131,3004,1,true},{0x3132,3005,1,true},
+	{0x3133,3006,1,true},{0x3134,3007,1,true},{0x3135,3008,1,true},{0x3136,3009,1,true},{0x3137,3010,1,true},{0x3138,3011,1,true},
+	{0x3139,3012,1,true},{0x313a,3013,1,true},{0x313b,3014,1,true},{0x313c,3015,1,true},{0x313d,3016,1,true},{0x313e,3017,1,true},
+	{0x313f,3018,1,true},{0x3140,3019,1,true},{0x3141,3020,1,true},{0x3142,3021,1,true},{0x3143,3022,1,true},{0x3144,3023,1,true},
+	{0x3145,3024,1,true},{0x3146,3025,1,true},{0x3147,3026,1,true},{0x3148,3027,1,true},{0x3149,3028,1,true},{0x314a,3029,1,true},
+	{0x314b,3030,1,true},{0x314c,3031,1,true},{0x314d,3032,1,true},{0x314e,3033,1,true},{0x314f,3034,1,true},{0x3150,3035,1,true},
+	{0x3151,3036,1,true},{0x3152,3037,1,true},{0x3153,3038,1,true},{0x3154,3039,1,true},{0x3155,3040,1,true},{0x3156,3041,1,true},
+	{0x3157,3042,1,true},{0x3158,3043,1,true},{0x3159,3044,1,true},{0x315a,3045,1,true},{0x315b,3046,1,true},{0x315c,3047,1,true},
+	{0x315d,3048,1,true},{0x315e,3049,1,true},{0x315f,3050,1,true},{0x3160,3051,1,true},{0x3161,3052,1,true},{0x3162,3053,1,true},
+	{0x3163,3054,1,true},{0x3164,3055,1,true},{0x3165,3056,1,true},{0x3166,3057,1,true},{0x3167,3058,1,true},{0x3168,3059,1,true},
+	{0x3169,3060,1,true},{0x316a,3061,1,true},{0x316b,3062,1,true},{0x316c,3063,1,true},{0x316d,3064,1,true},{0x316e,3065,1,true},
+	{0x316f,3066,1,true},{0x3170,3067,1,true},{0x3171,3068,1,true},{0x3172,3069,1,true},{0x3173,3070,1,true},{0x3174,3071,1,true},
+	{0x3175,3072,1,true},{0x3176,3073,1,true},{0x3177,3074,1,true},{0x3178,3075,1,true},{0x3179,3076,1,true},{0x317a,3077,1,true},
+	{0x317b,3078,1,true},{0x317c,3079,1,true},{0x317d,3080,1,true},{0x317e,3081,1,true},{0x317f,3082,1,true},{0x3180,3083,1,true},
+	{0x3181,3084,1,true},{0x3182,3085,1,true},{0x3183,3086,1,true},{0x3184,3087,1,true},{0x3185,3088,1,true},{0x3186,3089,1,true},
+	{0x3187,3090,1,true},{0x3188,3091,1,true},{0x3189,3092,1,true},{0x318a,3093,1,true},{0x318b,3094,1,true},{0x318c,3095,1,true},
+	{0x318d,3096,1,true},{0x318e,3097,1,true},{0x3192,3098,1,true},{0x3193,3099,1,true},{0x3194,3100,1,true},{0x3195,3101,1,true},
+	{0x3196,3102,1,true},{0x3197,3103,1,true},{0x3198,3104,1,true},{0x3199,3105,1,true},{0x319a,3106,1,true},{0x319b,3107,1,true},
+	{0x319c,3108,1,true},{0x319d,3109,1,true},{0x319e,3110,1,true},{0x319f,3111,1,true},{0x3200,3112,3,true},{0x3201,3115,3,true},
+	{0x3202,3118,3,true},{0x3203,3121,3,true},{0x3204,3124,3,true},{0x3205,3127,3,true},{0x3206,3130,3,true},{0x3207,3133,3,true},
+	{0x3208,3136,3,true},{0x3209,3139,3,true},{0x320a,3142,3,true},{0x320b,3145,3,true},{0x320c,3148,3,true},{0x320d,3151,3,true},
+	{0x320e,3154,4,true},{0x320f,3158,4,true},{0x3210,3162,4,true},{0x3211,3166,4,true},{0x3212,3170,4,true},{0x3213,3174,4,true},
+	{0x3214,3178,4,true},{0x3215,3182,4,true},{0x3216,3186,4,true},{0x3217,3190,4,true},{0x3218,3194,4,true},{0x3219,3198,4,true},
+	{0x321a,3202,4,true},{0x321b,3206,4,true},{0x321c,3210,4,true},{0x321d,3214,7,true},{0x321e,3221,6,true},{0x3220,3227,3,true},
+	{0x3221,3230,3,true},{0x3222,3233,3,true},{0x3223,3236,3,true},{0x3224,3239,3,true},{0x3225,3242,3,true},{0x3226,3245,3,true},
+	{0x3227,3248,3,true},{0x3228,3251,3,true},{0x3229,3254,3,true},{0x322a,3257,3,true},{0x322b,3260,3,true},{0x322c,3263,3,true},
+	{0x322d,3266,3,true},{0x322e,3269,3,true},{0x322f,3272,3,true},{0x3230,3275,3,true},{0x3231,3278,3,true},{0x3232,3281,3,true},
+	{0x3233,3284,3,true},{0x3234,3287,3,true},{0x3235,3290,3,true},{0x3236,3293,3,true},{0x3237,3296,3,true},{0x3238,3299,3,true},
+	{0x3239,3302,3,true},{0x323a,3305,3,true},{0x323b,3308,3,true},{0x323c,3311,3,true},{0x323d,3314,3,true},{0x323e,3317,3,true},
+	{0x323f,3320,3,true},{0x3240,3323,3,true},{0x3241,3326,3,true},{0x3242,3329,3,true},{0x3243,3332,3,true},{0x3244,3335,1,true},
+	{0x3245,3336,1,true},{0x3246,3337,1,true},{0x3247,3338,1,true},{0x3250,3339,3,true},{0x3251,3342,2,true},{0x3252,3344,2,true},
+	{0x3253,3346,2,true},{0x3254,3348,2,true},{0x3255,3350,2,true},{0x3256,3352,2,true},{0x3257,3354,2,true},{0x3258,3356,2,true},
+	{0x3259,3358,2,true},{0x325a,3360,2,true},{0x325b,3362,2,true},{0x325c,3364,2,true},{0x325d,3366,2,true},{0x325e,3368,2,true},
+	{0x325f,3370,2,true},{0x3260,3372,1,true},{0x3261,3373,1,true},{0x3262,3374,1,true},{0x3263,3375,1,true},{0x3264,3376,1,true},
+	{0x3265,3377,1,true},{0x3266,3378,1,true},{0x3267,3379,1,true},{0x3268,3380,1,true},{0x3269,3381,1,true},{0x326a,3382,1,true},
+	{0x326b,3383,1,true},{0x326c,3384,1,true},{0x326d,3385,1,true},{0x326e,3386,2,true},{0x326f,3388,2,true},{0x3270,3390,2,true},
+	{0x3271,3392,2,true},{0x3272,3394,2,true},{0x3273,3396,2,true},{0x3274,3398,2,true},{0x3275,3400,2,true},{0x3276,3402,2,true},
+	{0x3277,3404,2,true},{0x3278,3406,2,true},{0x3279,3408,2,true},{0x327a,3410,2,true},{0x327b,3412,2,true},{0x327c,3414,5,true},
+	{0x327d,3419,4,true},{0x327e,3423,2,true},{0x3280,3425,1,true},{0x3281,3426,1,true},{0x3282,3427,1,true},{0x3283,3428,1,true},
+	{0x3284,3429,1,true},{0x3285,3430,1,true},{0x3286,3431,1,true},{0x3287,3432,1,true},{0x3288,3433,1,true},{0x3289,3434,1,true},
+	{0x328a,3435,1,true},{0x328b,3436,1,true},{0x328c,3437,1,true},{0x328d,3438,1,true},{0x328e,3439,1,true},{0x328f,3440,1,true},
+	{0x3290,3441,1,true},{0x3291,3442,1,true},{0x3292,3443,1,true},{0x3293,3444,1,true},{0x3294,3445,1,true},{0x3295,3446,1,true},
+	{0x3296,3447,1,true},{0x3297,3448,1,true},{0x3298,3449,1,true},{0x3299,3450,1,true},{0x329a,3451,1,true},{0x329b,3452,1,true},
+	{0x329c,3453,1,true},{0x329d,3454,1,true},{0x329e,3455,1,true},{0x329f,3456,1,true},{0x32a0,3457,1,true},{0x32a1,3458,1,true},
+	{0x32a2,3459,1,true},{0x32a3,3460,1,true},{0x32a4,3461,1,true},{0x32a5,3462,1,true},{0x32a6,3463,1,true},{0x32a7,3464,1,true},
+	{0x32a8,3465,1,true},{0x32a9,3466,1,true},{0x32aa,3467,1,true},{0x32ab,3468,1,true},{0x32ac,3469,1,true},{0x32ad,3470,1,true},
+	{0x32ae,3471,1,true},{0x32af,3472,1,true},{0x32b0,3473,1,true},{0x32b1,3474,2,true},{0x32b2,3476,2,true},{0x32b3,3478,2,true},
+	{0x32b4,3480,2,true},{0x32b5,3482,2,true},{0x32b6,3484,2,true},{0x32b7,3486,2,true},{0x32b8,3488,2,true},{0x32b9,3490,2,true},
+	{0x32ba,3492,2,true},{0x32bb,3494,2,true},{0x32bc,3496,2,true},{0x32bd,3498,2,true},{0x32be,3500,2,true},{0x32bf,3502,2,true},
+	{0x32c0,3504,2,true},{0x32c1,3506,2,true},{0x32c2,3508,2,true},{0x32c3,3510,2,true},{0x32c4,3512,2,true},{0x32c5,3514,2,true},
+	{0x32c6,3516,2,true},{0x32c7,3518,2,true},{0x32c8,3520,2,true},{0x32c9,3522,3,true},{0x32ca,3525,3,true},{0x32cb,3528,3,true},
+	{0x32cc,3531,2,true},{0x32cd,3533,3,true},{0x32ce,3536,2,true},{0x32cf,3538,3,true},{0x32d0,3541,1,true},{0x32d1,3542,1,true},
+	{0x32d2,3543,1,true},{0x32d3,3544,1,true},{0x32d4,3545,1,true},{0x32d5,3546,1,true},{0x32d6,3547,1,true},{0x32d7,3548,1,true},
+	{0x32d8,3549,1,true},{0x32d9,3550,1,true},{0x32da,3551,1,true},{0x32db,3552,1,true},{0x32dc,3553,1,true},{0x32dd,3554,1,true},
+	{0x32de,3555,1,true},{0x32df,3556,1,true},{0x32e0,3557,1,true},{0x32e1,3558,1,true},{0x32e2,3559,1,true},{0x32e3,3560,1,true},
+	{0x32e4,3561,1,true},{0x32e5,3562,1,true},{0x32e6,3563,1,true},{0x32e7,3564,1,true},{0x32e8,3565,1,true},{0x32e9,3566,1,true},
+	{0x32ea,3567,1,true},{0x32eb,3568,1,true},{0x32ec,3569,1,true},{0x32ed,3570,1,true},{0x32ee,3571,1,true},{0x32ef,3572,1,true},
+	{0x32f0,3573,1,true},{0x32f1,3574,1,true},{0x32f2,3575,1,true},{0x32f3,3576,1,true},{0x32f4,3577,1,true},{0x32f5,3578,1,true},
+	{0x32f6,3579,1,true},{0x32f7,3580,1,true},{0x32f8,3581,1,true},{0x32f9,3582,1,true},{0x32fa,3583,1,true},{0x32fb,3584,1,true},
+	{0x32fc,3585,1,true},{0x32fd,3586,1,true},{0x32fe,3587,1,true},{0x32ff,3588,2,true},{0x3300,3590,4,true},{0x3301,3594,4,true},
+	{0x3302,3598,4,true},{0x3303,3602,3,true},{0x3304,3605,4,true},{0x3305,3609,3,true},{0x3306,3612,3,true},{0x3307,3615,5,true},
+	{0x3308,3620,4,true},{0x3309,3624,3,true},{0x330a,3627,3,true},{0x330b,3630,3,true},{0x330c,3633,4,true},{0x330d,3637,4,true},
+	{0x330e,3641,3,true},{0x330f,3644,3,true},{0x3310,3647,2,true},{0x3311,3649,3,true},{0x3312,3652,4,true},{0x3313,3656,4,true},
+	{0x3314,3660,2,true},{0x3315,3662,5,true},{0x3316,3667,6,true},{0x3317,3673,5,true},{0x3318,3678,3,true},{0x3319,3681,5,true},
+	{0x331a,3686,5,true},{0x331b,3691,4,true},{0x331c,3695,3,true},{0x331d,3698,3,true},{0x331e,3701,3,true},{0x331f,3704,4,true},
+	{0x3320,3708,5,true},{0x3321,3713,4,true},{0x3322,3717,3,true},{0x3323,3720,3,true},{0x3324,3723,3,true},{0x3325,3726,2,true},
+	{0x3326,3728,2,true},{0x3327,3730,2,true},{0x3328,3732,2,true},{0x3329,3734,3,true},{0x332a,3737,3,true},{0x332b,3740,5,true},
+	{0x332c,3745,3,true},{0x332d,3748,4,true},{0x332e,3752,5,true},{0x332f,3757,3,true},{0x3330,3760,2,true},{0x3331,3762,2,true},
+	{0x3332,3764,5,true},{0x3333,3769,4,true},{0x3334,3773,5,true},{0x3335,3778,3,true},{0x3336,3781,5,true},{0x3337,3786,2,true},
+	{0x3338,3788,3,true},{0x3339,3791,3,true},{0x333a,3794,3,true},{0x333b,3797,3,true},{0x333c,3800,3,true},{0x333d,3803,4,true},
+	{0x333e,3807,3,true},{0x333f,3810,2,true},{0x3340,3812,3,true},{0x3341,3815,3,true},{0x3342,3818,3,true},{0x3343,3821,4,true},
+	{0x3344,3825,3,true},{0x3345,3828,3,true},{0x3346,3831,3,true},{0x3347,3834,5,true},{0x3348,3839,4,true},{0x3349,3843,2,true},
+	{0x334a,3845,5,true},{0x334b,3850,2,true},{0x334c,3852,4,true},{0x334d,3856,4,true},{0x334e,3860,3,true},{0x334f,3863,3,true},
+	{0x3350,3866,3,true},{0x3351,3869,4,true},{0x3352,3873,2,true},{0x3353,3875,3,true},{0x3354,3878,4,true},{0x3355,3882,2,true},
+	{0x3356,3884,5,true},{0x3357,3889,3,true},{0x3358,3892,2,true},{0x3359,3894,2,true},{0x335a,3896,2,true},{0x335b,3898,2,true},
+	{0x335c,3900,2,true},{0x335d,3902,2,true},{0x335e,3904,2,true},{0x335f,3906,2,true},{0x3360,3908,2,true},{0x3361,3910,2,true},
+	{0x3362,3912,3,true},{0x3363,3915,3,true},{0x3364,3918,3,true},{0x3365,3921,3,true},{0x3366,3924,3,true},{0x3367,3927,3,true},
+	{0x3368,3930,3,true},{0x3369,3933,3,true},{0x336a,3936,3,true},{0x336b,3939,3,true},{0x336c,3942,3,true},{0x336d,3945,3,true},
+	{0x336e,3948,3,true},{0x336f,3951,3,true},{0x3370,3954,3,true},{0x3371,3957,3,true},{0x3372,3960,2,true},{0x3373,3962,2,true},
+	{0x3374,3964,3,true},{0x3375,3967,2,true},{0x3376,3969,2,true},{0x3377,3971,2,true},{0x3378,3973,3,true},{0x3379,3976,3,true},
+	{0x337a,3979,2,true},{0x337b,3981,2,true},{0x337c,3983,2,true},{0x337d,3985,2,true},{0x337e,3987,2,true},{0x337f,3989,4,true},
+	{0x3380,3993,2,true},{0x3381,3995,2,true},{0x3382,3997,2,true},{0x3383,3999,2,true},{0x3384,4001,2,true},{0x3385,4003,2,true},
+	{0x3386,4005,2,true},{0x3387,4007,2,true},{0x3388,4009,3,true},{0x3389,4012,4,true},{0x338a,4016,2,true},{0x338b,4018,2,true},
+	{0x338c,4020,2,true},{0x338d,4022,2,true},{0x338e,4024,2,true},{0x338f,4026,2,true},{0x3390,4028,2,true},{0x3391,4030,3,true},
+	{0x3392,4033,3,true},{0x3393,4036,3,true},{0x3394,4039,3,true},{0x3395,4042,2,true},{0x3396,4044,2,true},{0x3397,4046,2,true},
+	{0x3398,4048,2,true},{0x3399,4050,2,true},{0x339a,4052,2,true},{0x339b,4054,2,true},{0x339c,4056,2,true},{0x339d,4058,2,true},
+	{0x339e,4060,2,true},{0x339f,4062,3,true},{0x33a0,4065,3,true},{0x33a1,4068,2,true},{0x33a2,4070,3,true},{0x33a3,4073,3,true},
+	{0x33a4,4076,3,true},{0x33a5,4079,2,true},{0x33a6,4081,3,true},{0x33a7,4084,3,true},{0x33a8,4087,4,true},{0x33a9,4091,2,true},
+	{0x33aa,4093,3,true},{0x33ab,4096,3,true},{0x33ac,4099,3,true},{0x33ad,4102,3,true},{0x33ae,4105,5,true},{0x33af,4110,6,true},
+	{0x33b0,4116,2,true},{0x33b1,4118,2,true},{0x33b2,4120,2,true},{0x33b3,4122,2,true},{0x33b4,4124,2,true},{0x33b5,4126,2,true},
+	{0x33b6,4128,2,true},{0x33b7,4130,2,true},{0x33b8,4132,2,true},{0x33b9,4134,2,true},{0x33ba,4136,2,true},{0x33bb,4138,2,true},
+	{0x33bc,4140,2,true},{0x33bd,4142,2,true},{0x33be,4144,2,true},{0x33bf,4146,2,true},{0x33c0,4148,2,true},{0x33c1,4150,2,true},
+	{0x33c2,4152,4,true},{0x33c3,4156,2,true},{0x33c4,4158,2,true},{0x33c5,4160,2,true},{0x33c6,4162,4,true},{0x33c7,4166,3,true},
+	{0x33c8,4169,2,true},{0x33c9,4171,2,true},{0x33ca,4173,2,true},{0x33cb,4175,2,true},{0x33cc,4177,2,true},{0x33cd,4179,2,true},
+	{0x33ce,4181,2,true},{0x33cf,4183,2,true},{0x33d0,4185,2,true},{0x33d1,4187,2,true},{0x33d2,4189,3,true},{0x33d3,4192,2,true},
+	{0x33d4,4194,2,true},{0x33d5,4196,3,true},{0x33d6,4199,3,true},{0x33d7,4202,2,true},{0x33d8,4204,4,true},{0x33d9,4208,3,true},
+	{0x33da,4211,2,true},{0x33db,4213,2,true},{0x33dc,4215,2,true},{0x33dd,4217,2,true},{0x33de,4219,3,true},{0x33df,4222,3,true},
+	{0x33e0,4225,2,true},{0x33e1,4227,2,true},{0x33e2,4229,2,true},{0x33e3,4231,2,true},{0x33e4,4233,2,true},{0x33e5,4235,2,true},
+	{0x33e6,4237,2,true},{0x33e7,4239,2,true},{0x33e8,4241,2,true},{0x33e9,4243,3,true},{0x33ea,4246,3,true},{0x33eb,4249,3,true},
+	{0x33ec,4252,3,true},{0x33ed,4255,3,true},{0x33ee,4258,3,true},{0x33ef,4261,3,true},{0x33f0,4264,3,true},{0x33f1,4267,3,true},
+	{0x33f2,4270,3,true},{0x33f3,4273,3,true},{0x33f4,4276,3,true},{0x33f5,4279,3,true},{0x33f6,4282,3,true},{0x33f7,4285,3,true},
+	{0x33f8,4288,3,true},{0x33f9,4291,3,true},{0x33fa,4294,3,true},{0x33fb,4297,3,true},{0x33fc,4300,3,true},{0x33fd,4303,3,true},
+	{0x33fe,4306,3,true},{0x33ff,4309,3,true},{0xa69c,4312,1,true},{0xa69d,4313,1,true},{0xa770,4314,1,true},{0xa7f2,4315,1,true},
+	{0xa7f3,4316,1,true},{0xa7f4,4317,1,true},{0xa7f8,4318,1,true},{0xa7f9,4319,1,true},{0xab5c,4320,1,true},{0xab5d,4321,1,true},
+	{0xab5e,4322,1,true},{0xab5f,4323,1,true},{0xab69,4324,1,true},{0xf900,4325,1,false},{0xf901,4326,1,false},{0xf902,4327,1,false},
+	{0xf903,4328,1,false},{0xf904,4329,1,false},{0xf905,4330,1,false},{0xf906,4331,1,false},{0xf907,4332,1,false},{0xf908,4333,1,false},
+	{0xf909,4334,1,false},{0xf90a,4335,1,false},{0xf90b,4336,1,false},{0xf90c,4337,1,false},{0xf90d,4338,1,false},{0xf90e,4339,1,false},
+	{0xf90f,4340,1,false},{0xf910,4341,1,false},{0xf911,4342,1,false},{0xf912,4343,1,false},{0xf913,4344,1,false},{0xf914,4345,1,false},
+	{0xf915,4346,1,false},{0xf916,4347,1,false},{0xf917,4348,1,false},{0xf918,4349,1,false},{0xf919,4350,1,false},{0xf91a,4351,1,false},
+	{0xf91b,4352,1,false},{0xf91c,4353,1,false},{0xf91d,4354,1,false},{0xf91e,4355,1,false},{0xf91f,4356,1,false},{0xf920,4357,1,false},
+	{0xf921,4358,1,false},{0xf922,4359,1,false},{0xf923,4360,1,false},{0xf924,4361,1,false},{0xf925,4362,1,false},{0xf926,4363,1,false},
+	{0xf927,4364,1,false},{0xf928,4365,1,false},{0xf929,4366,1,false},{0xf92a,4367,1,false},{0xf92b,4368,1,false},{0xf92c,4369,1,false},
+	{0xf92d,4370,1,false},{0xf92e,4371,1,false},{0xf92f,4372,1,false},{0xf930,4373,1,false},{0xf931,4374,1,false},{0xf932,4375,1,false},
+	{0xf933,4376,1,false},{0xf934,4377,1,false},{0xf935,4378,1,false},{0xf936,4379,1,false},{0xf937,4380,1,false},{0xf938,4381,1,false},
+	{0xf939,4382,1,false},{0xf93a,4383,1,false},{0xf93b,4384,1,false},{0xf93c,4385,1,false},{0xf93d,4386,1,false},{0xf93e,4387,1,false},
+	{0xf93f,4388,1,false},{0xf940,4389,1,false},{0xf941,4390,1,false},{0xf942,4391,1,false},{0xf943,4392,1,false},{0xf944,4393,1,false},
+	{0xf945,4394,1,false},{0xf946,4395,1,false},{0xf947,4396,1,false},{0xf948,4397,1,false},{0xf949,4398,1,false},{0xf94a,4399,1,false},
+	{0xf94b,4400,1,false},{0xf94c,4401,1,false},{0xf94d,4402,1,false},{0xf94e,4403,1,false},{0xf94f,4404,1,false},{0xf950,4405,1,false},
+	{0xf951,4406,1,false},{0xf952,4407,1,false},{0xf953,4408,1,false},{0xf954,4409,1,false},{0xf955,4410,1,false},{0xf956,4411,1,false},
+	{0xf957,4412,1,false},{0xf958,4413,1,false},{0xf959,4414,1,false},{0xf95a,4415,1,false},{0xf95b,4416,1,false},{0xf95c,4417,1,false},
+	{0xf95d,4418,1,false},{0xf95e,4419,1,false},{0xf95f,4420,1,false},{0xf960,4421,1,false},{0xf961,4422,1,false},{0xf962,4423,1,false},
+	{0xf963,4424,1,false},{0xf964,4425,1,false},{0xf965,4426,1,false},{0xf966,4427,1,false},{0xf967,4428,1,false},{0xf968,4429,1,false},
+	{0xf969,4430,1,false},{0xf96a,4431,1,false},{0xf96b,4432,1,false},{0xf96c,4433,1,false},{0xf96d,4434,1,false},{0xf96e,4435,1,false},
+	{0xf96f,4436,1,false},{0xf970,4437,1,false},{0xf971,4438,1,false},{0xf972,4439,1,false},{0xf973,4440,1,false},{0xf974,4441,1,false},
+	{0xf975,4442,1,false},{0xf976,4443,1,false},{0xf977,4444,1,false},{0xf978,4445,1,false},{0xf979,4446,1,false},{0xf97a,4447,1,false},
+	{0xf97b,4448,1,false},{0xf97c,4449,1,false},{0xf97d,4450,1,false},{0xf97e,4451,1,false},{0xf97f,4452,1,false},{0xf980,4453,1,false},
+	{0xf981,4454,1,false},{0xf982,4455,1,false},{0xf983,4456,1,false},{0xf984,4457,1,false},{0xf985,4458,1,false},{0xf986,4459,1,false},
+	{0xf987,4460,1,false},{0xf988,4461,1,false},{0xf989,4462,1,false},{0xf98a,4463,1,false},{0xf98b,4464,1,false},{0xf98c,4465,1,false},
+	{0xf98d,4466,1,false},{0xf98e,4467,1,false},{0xf98f,4468,1,false},{0xf990,4469,1,false},{0xf991,4470,1,false},{0xf992,4471,1,false},
+	{0xf993,4472,1,false},{0xf994,4473,1,false},{0xf995,4474,1,false},{0xf996,4475,1,false},{0xf997,4476,1,false},{0xf998,4477,1,false},
+	{0xf999,4478,1,false},{0xf99a,4479,1,false},{0xf99b,4480,1,false},{0xf99c,4481,1,false},{0xf99d,4482,1,false},{0xf99e,4483,1,false},
+	{0xf99f,4484,1,false},{0xf9a0,4485,1,false},{0xf9a1,4486,1,false},{0xf9a2,4487,1,false},{0xf9a3,4488,1,false},{0xf9a4,4489,1,false},
+	{0xf9a5,4490,1,false},{0xf9a6,4491,1,false},{0xf9a7,4492,1,false},{0xf9a8,4493,1,false},{0xf9a9,4494,1,false},{0xf9aa,4495,1,false},
+	{0xf9ab,4496,1,false},{0xf9ac,4497,1,false},{0xf9ad,4498,1,false},{0xf9ae,4499,1,false},{0xf9af,4500,1,false},{0xf9b0,4501,1,false},
+	{0xf9b1,4502,1,false},{0xf9b2,4503,1,false},{0xf9b3,4504,1,false},{0xf9b4,4505,1,false},{0xf9b5,4506,1,false},{0xf9b6,4507,1,false},
+	{0xf9b7,4508,1,false},{0xf9b8,4509,1,false},{0xf9b9,4510,1,false},{0xf9ba,4511,1,false},{0xf9bb,4512,1,false},{0xf9bc,4513,1,false},
+	{0xf9bd,4514,1,false},{0xf9be,4515,1,false},{0xf9bf,4516,1,false},{0xf9c0,4517,1,false},{0xf9c1,4518,1,false},{0xf9c2,4519,1,false},
+	{0xf9c3,4520,1,false},{0xf9c4,4521,1,false},{0xf9c5,4522,1,false},{0xf9c6,4523,1,false},{0xf9c7,4524,1,false},{0xf9c8,4525,1,false},
+	{0xf9c9,4526,1,false},{0xf9ca,4527,1,false},{0xf9cb,4528,1,false},{0xf9cc,4529,1,false},{0xf9cd,4530,1,false},{0xf9ce,4531,1,false},
+	{0xf9cf,4532,1,false},{0xf9d0,4533,1,false},{0xf9d1,4534,1,false},{0xf9d2,4535,1,false},{0xf9d3,4536,1,false},{0xf9d4,4537,1,false},
+	{0xf9d5,4538,1,false},{0xf9d6,4539,1,false},{0xf9d7,4540,1,false},{0xf9d8,4541,1,false},{0xf9d9,4542,1,false},{0xf9da,4543,1,false},
+	{0xf9db,4544,1,false},{0xf9dc,4545,1,false},{0xf9dd,4546,1,false},{0xf9de,4547,1,false},{0xf9df,4548,1,false},{0xf9e0,4549,1,false},
+	{0xf9e1,4550,1,false},{0xf9e2,4551,1,false},{0xf9e3,4552,1,false},{0xf9e4,4553,1,false},{0xf9e5,4554,1,false},{0xf9e6,4555,1,false},
+	{0xf9e7,4556,1,false},{0xf9e8,4557,1,false},{0xf9e9,4558,1,false},{0xf9ea,4559,1,false},{0xf9eb,4560,1,false},{0xf9ec,4561,1,false},
+	{0xf9ed,4562,1,false},{0xf9ee,4563,1,false},{0xf9ef,4564,1,false},{0xf9f0,4565,1,false},{0xf9f1,4566,1,false},{0xf9f2,4567,1,false},
+	{0xf9f3,4568,1,false},{0xf9f4,4569,1,false},{0xf9f5,4570,1,false},{0xf9f6,4571,1,false},{0xf9f7,4572,1,false},{0xf9f8,4573,1,false},
+	{0xf9f9,4574,1,false},{0xf9fa,4575,1,false},{0xf9fb,4576,1,false},{0xf9fc,4577,1,false},{0xf9fd,4578,1,false},{0xf9fe,4579,1,false},
+	{0xf9ff,4580,1,false},{0xfa00,4581,1,false},{0xfa01,4582,1,false},{0xfa02,4583,1,false},{0xfa03,4584,1,false},{0xfa04,4585,1,false},
+	{0xfa05,4586,1,false},{0xfa06,4587,1,false},{0xfa07,4588,1,false},{0xfa08,4589,1,false},{0xfa09,4590,1,false},{0xfa0a,4591,1,false},
+	{0xfa0b,4592,1,false},{0xfa0c,4593,1,false},{0xfa0d,4594,1,false},{0xfa10,4595,1,false},{0xfa12,4596,1,false},{0xfa15,4597,1,false},
+	{0xfa16,4598,1,false},{0xfa17,4599,1,false},{0xfa18,4600,1,false},{0xfa19,4601,1,false},{0xfa1a,4602,1,false},{0xfa1b,4603,1,false},
+	{0xfa1c,4604,1,false},{0xfa1d,4605,1,false},{0xfa1e,4606,1,false},{0xfa20,4607,1,false},{0xfa22,4608,1,false},{0xfa25,4609,1,false},
+	{0xfa26,4610,1,false},{0xfa2a,4611,1,false},{0xfa2b,4612,1,false},{0xfa2c,4613,1,false},{0xfa2d,4614,1,false},{0xfa2e,4615,1,false},
+	{0xfa2f,4616,1,false},{0xfa30,4617,1,false},{0xfa31,4618,1,false},{0xfa32,4619,1,false},{0xfa33,4620,1,false},{0xfa34,4621,1,false},
+	{0xfa35,4622,1,false},{0xfa36,4623,1,false},{0xfa37,4624,1,false},{0xfa38,4625,1,false},{0xfa39,4626,1,false},{0xfa3a,4627,1,false},
+	{0xfa3b,4628,1,false},{0xfa3c,4629,1,false},{0xfa3d,4630,1,false},{0xfa3e,4631,1,false},{0xfa3f,4632,1,false},{0xfa40,4633,1,false},
+	{0xfa41,4634,1,false},{0xfa42,4635,1,false},{0xfa43,4636,1,false},{0xfa44,4637,1,false},{0xfa45,4638,1,false},{0xfa46,4639,1,false},
+	{0xfa47,4640,1,false},{0xfa48,4641,1,false},{0xfa49,4642,1,false},{0xfa4a,4643,1,false},{0xfa4b,4644,1,false},{0xfa4c,4645,1,false},
+	{0xfa4d,4646,1,false},{0xfa4e,4647,1,false},{0xfa4f,4648,1,false},{0xfa50,4649,1,false},{0xfa51,4650,1,false},{0xfa52,4651,1,false},
+	{0xfa53,4652,1,false},{0xfa54,4653,1,false},{0xfa55,4654,1,false},{0xfa56,4655,1,false},{0xfa57,4656,1,false},{0xfa58,4657,1,false},
+	{0xfa59,4658,1,false},{0xfa5a,4659,1,false},{0xfa5b,4660,1,false},{0xfa5c,4661,1,false},{0xfa5d,4662,1,false},{0xfa5e,4663,1,false},
+	{0xfa5f,4664,1,false},{0xfa60,4665,1,false},{0xfa61,4666,1,false},{0xfa62,4667,1,false},{0xfa63,4668,1,false},{0xfa64,4669,1,false},
+	{0xfa65,4670,1,false},{0xfa66,4671,1,false},{0xfa67,4672,1,false},{0xfa68,4673,1,false},{0xfa69,4674,1,false},{0xfa6a,4675,1,false},
+	{0xfa6b,4676,1,false},{0xfa6c,4677,1,false},{0xfa6d,4678,1,false},{0xfa70,4679,1,false},{0xfa71,4680,1,false},{0xfa72,4681,1,false},
+	{0xfa73,4682,1,false},{0xfa74,4683,1,false},{0xfa75,4684,1,false},{0xfa76,4685,1,false},{0xfa77,4686,1,false},{0xfa78,4687,1,false},
+	{0xfa79,4688,1,false},{0xfa7a,4689,1,false},{0xfa7b,4690,1,false},{0xfa7c,4691,1,false},{0xfa7d,4692,1,false},{0xfa7e,4693,1,false},
+	{0xfa7f,4694,1,false},{0xfa80,4695,1,false},{0xfa81,4696,1,false},{0xfa82,4697,1,false},{0xfa83,4698,1,false},{0xfa84,4699,1,false},
+	{0xfa85,4700,1,false},{0xfa86,4701,1,false},{0xfa87,4702,1,false},{0xfa88,4703,1,false},{0xfa89,4704,1,false},{0xfa8a,4705,1,false},
+	{0xfa8b,4706,1,false},{0xfa8c,4707,1,false},{0xfa8d,4708,1,false},{0xfa8e,4709,1,false},{0xfa8f,4710,1,false},{0xfa90,4711,1,false},
+	{0xfa91,4712,1,false},{0xfa92,4713,1,false},{0xfa93,4714,1,false},{0xfa94,4715,1,false},{0xfa95,4716,1,false},{0xfa96,4717,1,false},
+	{0xfa97,4718,1,false},{0xfa98,4719,1,false},{0xfa99,4720,1,false},{0xfa9a,4721,1,false},{0xfa9b,4722,1,false},{0xfa9c,4723,1,false},
+	{0xfa9d,4724,1,false},{0xfa9e,4725,1,false},{0xfa9f,4726,1,false},{0xfaa0,4727,1,false},{0xfaa1,4728,1,false},{0xfaa2,4729,1,false},
+	{0xfaa3,4730,1,false},{0xfaa4,4731,1,false},{0xfaa5,4732,1,false},{0xfaa6,4733,1,false},{0xfaa7,4734,1,false},{0xfaa8,4735,1,false},
+	{0xfaa9,4736,1,false},{0xfaaa,4737,1,false},{0xfaab,4738,1,false},{0xfaac,4739,1,false},{0xfaad,4740,1,false},{0xfaae,4741,1,false},
+	{0xfaaf,4742,1,false},{0xfab0,4743,1,false},{0xfab1,4744,1,false},{0xfab2,4745,1,false},{0xfab3,4746,1,false},{0xfab4,4747,1,false},
+	{0xfab5,4748,1,false},{0xfab6,4749,1,false},{0xfab7,4750,1,false},{0xfab8,4751,1,false},{0xfab9,4752,1,false},{0xfaba,4753,1,false},
+	{0xfabb,4754,1,false},{0xfabc,4755,1,false},{0xfabd,4756,1,false},{0xfabe,4757,1,false},{0xfabf,4758,1,false},{0xfac0,4759,1,false},
+	{0xfac1,4760,1,false},{0xfac2,4761,1,false},{0xfac3,4762,1,false},{0xfac4,4763,1,false},{0xfac5,4764,1,false},{0xfac6,4765,1,false},
+	{0xfac7,4766,1,false},{0xfac8,4767,1,false},{0xfac9,4768,1,false},{0xfaca,4769,1,false},{0xfacb,4770,1,false},{0xfacc,4771,1,false},
+	{0xfacd,4772,1,false},{0xface,4773,1,false},{0xfacf,4774,1,false},{0xfad0,4775,1,false},{0xfad1,4776,1,false},{0xfad2,4777,1,false},
+	{0xfad3,4778,1,false},{0xfad4,4779,1,false},{0xfad5,4780,1,false},{0xfad6,4781,1,false},{0xfad7,4782,1,false},{0xfad8,4783,1,false},
+	{0xfad9,4784,1,false},{0xfb00,4785,2,true},{0xfb01,4787,2,true},{0xfb02,4789,2,true},{0xfb03,4791,3,true},{0xfb04,4794,3,true},
+	{0xfb05,4797,2,true},{0xfb06,4799,2,true},{0xfb13,4801,2,true},{0xfb14,4803,2,true},{0xfb15,4805,2,true},{0xfb16,4807,2,true},
+	{0xfb17,4809,2,true},{0xfb1d,4811,2,false},{0xfb1f,4813,2,false},{0xfb20,4815,1,true},{0xfb21,4816,1,true},{0xfb22,4817,1,true},
+	{0xfb23,4818,1,true},{0xfb24,4819,1,true},{0xfb25,4820,1,true},{0xfb26,4821,1,true},{0xfb27,4822,1,true},{0xfb28,4823,1,true},
+	{0xfb29,4824,1,true},{0xfb2a,4825,2,false},{0xfb2b,4827,2,false},{0xfb2c,4829,2,false},{0xfb2d,4831,2,false},{0xfb2e,4833,2,false},
+	{0xfb2f,4835,2,false},{0xfb30,4837,2,false},{0xfb31,4839,2,false},{0xfb32,4841,2,false},{0xfb33,4843,2,false},{0xfb34,4845,2,false},
+	{0xfb35,4847,2,false},{0xfb36,4849,2,false},{0xfb38,4851,2,false},{0xfb39,4853,2,false},{0xfb3a,4855,2,false},{0xfb3b,4857,2,false},
+	{0xfb3c,4859,2,false},{0xfb3e,4861,2,false},{0xfb40,4863,2,false},{0xfb41,4865,2,false},{0xfb43,4867,2,false},{0xfb44,4869,2,false},
+	{0xfb46,4871,2,false},{0xfb47,4873,2,false},{0xfb48,4875,2,false},{0xfb49,4877,2,false},{0xfb4a,4879,2,false},{0xfb4b,4881,2,false},
+	{0xfb4c,4883,2,false},{0xfb4d,4885,2,false},{0xfb4e,4887,2,false},{0xfb4f,4889,2,true},{0xfb50,4891,1,true},{0xfb51,4892,1,true},
+	{0xfb52,4893,1,true},{0xfb53,4894,1,true},{0xfb54,4895,1,true},{0xfb55,4896,1,true},{0xfb56,4897,1,true},{0xfb57,4898,1,true},
+	{0xfb58,4899,1,true},{0xfb59,4900,1,true},{0xfb5a,4901,1,true},{0xfb5b,4902,1,true},{0xfb5c,4903,1,true},{0xfb5d,4904,1,true},
+	{0xfb5e,4905,1,true},{0xfb5f,4906,1,true},{0xfb60,4907,1,true},{0xfb61,4908,1,true},{0xfb62,4909,1,true},{0xfb63,4910,1,true},
+	{0xfb64,4911,1,true},{0xfb65,4912,1,true},{0xfb66,4913,1,true},{0xfb67,4914,1,true},{0xfb68,4915,1,true},{0xfb69,4916,1,true},
+	{0xfb6a,4917,1,true},{0xfb6b,4918,1,true},{0xfb6c,4919,1,true},{0xfb6d,4920,1,true},{0xfb6e,4921,1,true},{0xfb6f,4922,1,true},
+	{0xfb70,4923,1,true},{0xfb71,4924,1,true},{0xfb72,4925,1,true},{0xfb73,4926,1,true},{0xfb74,4927,1,true},{0xfb75,4928,1,true},
+	{0xfb76,4929,1,true},{0xfb77,4930,1,true},{0xfb78,4931,1,true},{0xfb79,4932,1,true},{0xfb7a,4933,1,true},{0xfb7b,4934,1,true},
+	{0xfb7c,4935,1,true},{0xfb7d,4936,1,true},{0xfb7e,4937,1,true},{0xfb7f,4938,1,true},{0xfb80,4939,1,true},{0xfb81,4940,1,true},
+	{0xfb82,4941,1,true},{0xfb83,4942,1,true},{0xfb84,4943,1,true},{0xfb85,4944,1,true},{0xfb86,4945,1,true},{0xfb87,4946,1,true},
+	{0xfb88,4947,1,true},{0xfb89,4948,1,true},{0xfb8a,4949,1,true},{0xfb8b,4950,1,true},{0xfb8c,4951,1,true},{0xfb8d,4952,1,true},
+	{0xfb8e,4953,1,true},{0xfb8f,4954,1,true},{0xfb90,4955,1,true},{0xfb91,4956,1,true},{0xfb92,4957,1,true},{0xfb93,4958,1,true},
+	{0xfb94,4959,1,true},{0xfb95,4960,1,true},{0xfb96,4961,1,true},{0xfb97,4962,1,true},{0xfb98,4963,1,true},{0xfb99,4964,1,true},
+	{0xfb9a,4965,1,true},{0xfb9b,4966,1,true},{0xfb9c,4967,1,true},{0xfb9d,4968,1,true},{0xfb9e,4969,1,true},{0xfb9f,4970,1,true},
+	{0xfba0,4971,1,true},{0xfba1,4972,1,true},{0xfba2,4973,1,true},{0xfba3,4974,1,true},{0xfba4,4975,1,true},{0xfba5,4976,1,true},
+	{0xfba6,4977,1,true},{0xfba7,4978,1,true},{0xfba8,4979,1,true},{0xfba9,4980,1,true},{0xfbaa,4981,1,true},{0xfbab,4982,1,true},
+	{0xfbac,4983,1,true},{0xfbad,4984,1,true},{0xfbae,4985,1,true},{0xfbaf,4986,1,true},{0xfbb0,4987,1,true},{0xfbb1,4988,1,true},
+	{0xfbd3,4989,1,true},{0xfbd4,4990,1,true},{0xfbd5,4991,1,true},{0xfbd6,4992,1,true},{0xfbd7,4993,1,true},{0xfbd8,4994,1,true},
+	{0xfbd9,4995,1,true},{0xfbda,4996,1,true},{0xfbdb,4997,1,true},{0xfbdc,4998,1,true},{0xfbdd,4999,1,true},{0xfbde,5000,1,true},
+	{0xfbdf,5001,1,true},{0xfbe0,5002,1,true},{0xfbe1,5003,1,true},{0xfbe2,5004,1,true},{0xfbe3,5005,1,true},{0xfbe4,5006,1,true},
+	{0xfbe5,5007,1,true},{0xfbe6,5008,1,true},{0xfbe7,5009,1,true},{0xfbe8,5010,1,true},{0xfbe9,5011,1,true},{0xfbea,5012,2,true},
+	{0xfbeb,5014,2,true},{0xfbec,5016,2,true},{0xfbed,5018,2,true},{0xfbee,5020,2,true},{0xfbef,5022,2,true},{0xfbf0,5024,2,true},
+	{0xfbf1,5026,2,true},{0xfbf2,5028,2,true},{0xfbf3,5030,2,true},{0xfbf4,5032,2,true},{0xfbf5,5034,2,true},{0xfbf6,5036,2,true},
+	{0xfbf7,5038,2,true},{0xfbf8,5040,2,true},{0xfbf9,5042,2,true},{0xfbfa,5044,2,true},{0xfbfb,5046,2,true},{0xfbfc,5048,1,true},
+	{0xfbfd,5049,1,true},{0xfbfe,5050,1,true},{0xfbff,5051,1,true},{0xfc00,5052,2,true},{0xfc01,5054,2,true},{0xfc02,5056,2,true},
+	{0xfc03,5058,2,true},{0xfc04,5060,2,true},{0xfc05,5062,2,true},{0xfc06,5064,2,true},{0xfc07,5066,2,true},{0xfc08,5068,2,true},
+	{0xfc09,5070,2,true},{0xfc0a,5072,2,true},{0xfc0b,5074,2,true},{0xfc0c,5076,2,true},{0xfc0d,5078,2,true},{0xfc0e,5080,2,true},
+	{0xfc0f,5082,2,true},{0xfc10,5084,2,true},{0xfc11,5086,2,true},{0xfc12,5088,2,true},{0xfc13,5090,2,true},{0xfc14,5092,2,true},
+	{0xfc15,5094,2,true},{0xfc16,5096,2,true},{0xfc17,5098,2,true},{0xfc18,5100,2,true},{0xfc19,5102,2,true},{0xfc1a,5104,2,true},
+	{0xfc1b,5106,2,true},{0xfc1c,5108,2,true},{0xfc1d,5110,2,true},{0xfc1e,5112,2,true},{0xfc1f,5114,2,true},{0xfc20,5116,2,true},
+	{0xfc21,5118,2,true},{0xfc22,5120,2,true},{0xfc23,5122,2,true},{0xfc24,5124,2,true},{0xfc25,5126,2,true},{0xfc26,5128,2,true},
+	{0xfc27,5130,2,true},{0xfc28,5132,2,true},{0xfc29,5134,2,true},{0xfc2a,5136,2,true},{0xfc2b,5138,2,true},{0xfc2c,5140,2,true},
+	{0xfc2d,5142,2,true},{0xfc2e,5144,2,true},{0xfc2f,5146,2,true},{0xfc30,5148,2,true},{0xfc31,5150,2,true},{0xfc32,5152,2,true},
+	{0xfc33,5154,2,true},{0xfc34,5156,2,true},{0xfc35,5158,2,true},{0xfc36,5160,2,true},{0xfc37,5162,2,true},{0xfc38,5164,2,true},
+	{0xfc39,5166,2,true},{0xfc3a,5168,2,true},{0xfc3b,5170,2,true},{0xfc3c,5172,2,true},{0xfc3d,5174,2,true},{0xfc3e,5176,2,true},
+	{0xfc3f,5178,2,true},{0xfc40,5180,2,true},{0xfc41,5182,2,true},{0xfc42,5184,2,true},{0xfc43,5186,2,true},{0xfc44,5188,2,true},
+	{0xfc45,5190,2,true},{0xfc46,5192,2,true},{0xfc47,5194,2,true},{0xfc48,5196,2,true},{0xfc49,5198,2,true},{0xfc4a,5200,2,true},
+	{0xfc4b,5202,2,true},{0xfc4c,5204,2,true},{0xfc4d,5206,2,true},{0xfc4e,5208,2,true},{0xfc4f,5210,2,true},{0xfc50,5212,2,true},
+	{0xfc51,5214,2,true},{0xfc52,5216,2,true},{0xfc53,5218,2,true},{0xfc54,5220,2,true},{0xfc55,5222,2,true},{0xfc56,5224,2,true},
+	{0xfc57,5226,2,true},{0xfc58,5228,2,true},{0xfc59,5230,2,true},{0xfc5a,5232,2,true},{0xfc5b,5234,2,true},{0xfc5c,5236,2,true},
+	{0xfc5d,5238,2,true},{0xfc5e,5240,3,true},{0xfc5f,5243,3,true},{0xfc60,5246,3,true},{0xfc61,5249,3,true},{0xfc62,5252,3,true},
+	{0xfc63,5255,3,true},{0xfc64,5258,2,true},{0xfc65,5260,2,true},{0xfc66,5262,2,true},{0xfc67,5264,2,true},{0xfc68,5266,2,true},
+	{0xfc69,5268,2,true},{0xfc6a,5270,2,true},{0xfc6b,5272,2,true},{0xfc6c,5274,2,true},{0xfc6d,5276,2,true},{0xfc6e,5278,2,true},
+	{0xfc6f,5280,2,true},{0xfc70,5282,2,true},{0xfc71,5284,2,true},{0xfc72,5286,2,true},{0xfc73,5288,2,true},{0xfc74,5290,2,true},
+	{0xfc75,5292,2,true},{0xfc76,5294,2,true},{0xfc77,5296,2,true},{0xfc78,5298,2,true},{0xfc79,5300,2,true},{0xfc7a,5302,2,true},
+	{0xfc7b,5304,2,true},{0xfc7c,5306,2,true},{0xfc7d,5308,2,true},{0xfc7e,5310,2,true},{0xfc7f,5312,2,true},{0xfc80,5314,2,true},
+	{0xfc81,5316,2,true},{0xfc82,5318,2,true},{0xfc83,5320,2,true},{0xfc84,5322,2,true},{0xfc85,5324,2,true},{0xfc86,5326,2,true},
+	{0xfc87,5328,2,true},{0xfc88,5330,2,true},{0xfc89,5332,2,true},{0xfc8a,5334,2,true},{0xfc8b,5336,2,true},{0xfc8c,5338,2,true},
+	{0xfc8d,5340,2,true},{0xfc8e,5342,2,true},{0xfc8f,5344,2,true},{0xfc90,5346,2,true},{0xfc91,5348,2,true},{0xfc92,5350,2,true},
+	{0xfc93,5352,2,true},{0xfc94,5354,2,true},{0xfc95,5356,2,true},{0xfc96,5358,2,true},{0xfc97,5360,2,true},{0xfc98,5362,2,true},
+	{0xfc99,5364,2,true},{0xfc9a,5366,2,true},{0xfc9b,5368,2,true},{0xfc9c,5370,2,true},{0xfc9d,5372,2,true},{0xfc9e,5374,2,true},
+	{0xfc9f,5376,2,true},{0xfca0,5378,2,true},{0xfca1,5380,2,true},{0xfca2,5382,2,true},{0xfca3,5384,2,true},{0xfca4,5386,2,true},
+	{0xfca5,5388,2,true},{0xfca6,5390,2,true},{0xfca7,5392,2,true},{0xfca8,5394,2,true},{0xfca9,5396,2,true},{0xfcaa,5398,2,true},
+	{0xfcab,5400,2,true},{0xfcac,5402,2,true},{0xfcad,5404,2,true},{0xfcae,5406,2,true},{0xfcaf,5408,2,true},{0xfcb0,5410,2,true},
+	{0xfcb1,5412,2,true},{0xfcb2,5414,2,true},{0xfcb3,5416,2,true},{0xfcb4,5418,2,true},{0xfcb5,5420,2,true},{0xfcb6,5422,2,true},
+	{0xfcb7,5424,2,true},{0xfcb8,5426,2,true},{0xfcb9,5428,2,true},{0xfcba,5430,2,true},{0xfcbb,5432,2,true},{0xfcbc,5434,2,true},
+	{0xfcbd,5436,2,true},{0xfcbe,5438,2,true},{0xfcbf,5440,2,true},{0xfcc0,5442,2,true},{0xfcc1,5444,2,true},{0xfcc2,5446,2,true},
+	{0xfcc3,5448,2,true},{0xfcc4,5450,2,true},{0xfcc5,5452,2,true},{0xfcc6,5454,2,true},{0xfcc7,5456,2,true},{0xfcc8,5458,2,true},
+	{0xfcc9,5460,2,true},{0xfcca,5462,2,true},{0xfccb,5464,2,true},{0xfccc,5466,2,true},{0xfccd,5468,2,true},{0xfcce,5470,2,true},
+	{0xfccf,5472,2,true},{0xfcd0,5474,2,true},{0xfcd1,5476,2,true},{0xfcd2,5478,2,true},{0xfcd3,5480,2,true},{0xfcd4,5482,2,true},
+	{0xfcd5,5484,2,true},{0xfcd6,5486,2,true},{0xfcd7,5488,2,true},{0xfcd8,5490,2,true},{0xfcd9,5492,2,true},{0xfcda,5494,2,true},
+	{0xfcdb,5496,2,true},{0xfcdc,5498,2,true},{0xfcdd,5500,2,true},{0xfcde,5502,2,true},{0xfcdf,5504,2,true},{0xfce0,5506,2,true},
+	{0xfce1,5508,2,true},{0xfce2,5510,2,true},{0xfce3,5512,2,true},{0xfce4,5514,2,true},{0xfce5,5516,2,true},{0xfce6,5518,2,true},
+	{0xfce7,5520,2,true},{0xfce8,5522,2,true},{0xfce9,5524,2,true},{0xfcea,5526,2,true},{0xfceb,5528,2,true},{0xfcec,5530,2,true},
+	{0xfced,5532,2,true},{0xfcee,5534,2,true},{0xfcef,5536,2,true},{0xfcf0,5538,2,true},{0xfcf1,5540,2,true},{0xfcf2,5542,3,true},
+	{0xfcf3,5545,3,true},{0xfcf4,5548,3,true},{0xfcf5,5551,2,true},{0xfcf6,5553,2,true},{0xfcf7,5555,2,true},{0xfcf8,5557,2,true},
+	{0xfcf9,5559,2,true},{0xfcfa,5561,2,true},{0xfcfb,5563,2,true},{0xfcfc,5565,2,true},{0xfcfd,5567,2,true},{0xfcfe,5569,2,true},
+	{0xfcff,5571,2,true},{0xfd00,5573,2,true},{0xfd01,5575,2,true},{0xfd02,5577,2,true},{0xfd03,5579,2,true},{0xfd04,5581,2,true},
+	{0xfd05,5583,2,true},{0xfd06,5585,2,true},{0xfd07,5587,2,true},{0xfd08,5589,2,true},{0xfd09,5591,2,true},{0xfd0a,5593,2,true},
+	{0xfd0b,5595,2,true},{0xfd0c,5597,2,true},{0xfd0d,5599,2,true},{0xfd0e,5601,2,true},{0xfd0f,5603,2,true},{0xfd10,5605,2,true},
+	{0xfd11,5607,2,true},{0xfd12,5609,2,true},{0xfd13,5611,2,true},{0xfd14,5613,2,true},{0xfd15,5615,2,true},{0xfd16,5617,2,true},
+	{0xfd17,5619,2,true},{0xfd18,5621,2,true},{0xfd19,5623,2,true},{0xfd1a,5625,2,true},{0xfd1b,5627,2,true},{0xfd1c,5629,2,true},
+	{0xfd1d,5631,2,true},{0xfd1e,5633,2,true},{0xfd1f,5635,2,true},{0xfd20,5637,2,true},{0xfd21,5639,2,true},{0xfd22,5641,2,true},
+	{0xfd23,5643,2,true},{0xfd24,5645,2,true},{0xfd25,5647,2,true},{0xfd26,5649,2,true},{0xfd27,5651,2,true},{0xfd28,5653,2,true},
+	{0xfd29,5655,2,true},{0xfd2a,5657,2,true},{0xfd2b,5659,2,true},{0xfd2c,5661,2,true},{0xfd2d,5663,2,true},{0xfd2e,5665,2,true},
+	{0xfd2f,5667,2,true},{0xfd30,5669,2,true},{0xfd31,5671,2,true},{0xfd32,5673,2,true},{0xfd33,5675,2,true},{0xfd34,5677,2,true},
+	{0xfd35,5679,2,true},{0xfd36,5681,2,true},{0xfd37,5683,2,true},{0xfd38,5685,2,true},{0xfd39,5687,2,true},{0xfd3a,5689,2,true},
+	{0xfd3b,5691,2,true},{0xfd3c,5693,2,true},{0xfd3d,5695,2,true},{0xfd50,5697,3,true},{0xfd51,5700,3,true},{0xfd52,5703,3,true},
+	{0xfd53,5706,3,true},{0xfd54,5709,3,true},{0xfd55,5712,3,true},{0xfd56,5715,3,true},{0xfd57,5718,3,true},{0xfd58,5721,3,true},
+	{0xfd59,5724,3,true},{0xfd5a,5727,3,true},{0xfd5b,5730,3,true},{0xfd5c,5733,3,true},{0xfd5d,5736,3,true},{0xfd5e,5739,3,true},
+	{0xfd5f,5742,3,true},{0xfd60,5745,3,true},{0xfd61,5748,3,true},{0xfd62,5751,3,true},{0xfd63,5754,3,true},{0xfd64,5757,3,true},
+	{0xfd65,5760,3,true},{0xfd66,5763,3,true},{0xfd67,5766,3,true},{0xfd68,5769,3,true},{0xfd69,5772,3,true},{0xfd6a,5775,3,true},
+	{0xfd6b,5778,3,true},{0xfd6c,5781,3,true},{0xfd6d,5784,3,true},{0xfd6e,5787,3,true},{0xfd6f,5790,3,true},{0xfd70,5793,3,true},
+	{0xfd71,5796,3,true},{0xfd72,5799,3,true},{0xfd73,5802,3,true},{0xfd74,5805,3,true},{0xfd75,5808,3,true},{0xfd76,5811,3,true},
+	{0xfd77,5814,3,true},{0xfd78,5817,3,true},{0xfd79,5820,3,true},{0xfd7a,5823,3,true},{0xfd7b,5826,3,true},{0xfd7c,5829,3,true},
+	{0xfd7d,5832,3,true},{0xfd7e,5835,3,true},{0xfd7f,5838,3,true},{0xfd80,5841,3,true},{0xfd81,5844,3,true},{0xfd82,5847,3,true},
+	{0xfd83,5850,3,true},{0xfd84,5853,3,true},{0xfd85,5856,3,true},{0xfd86,5859,3,true},{0xfd87,5862,3,true},{0xfd88,5865,3,true},
+	{0xfd89,5868,3,true},{0xfd8a,5871,3,true},{0xfd8b,5874,3,true},{0xfd8c,5877,3,true},{0xfd8d,5880,3,true},{0xfd8e,5883,3,true},
+	{0xfd8f,5886,3,true},{0xfd92,5889,3,true},{0xfd93,5892,3,true},{0xfd94,5895,3,true},{0xfd95,5898,3,true},{0xfd96,5901,3,true},
+	{0xfd97,5904,3,true},{0xfd98,5907,3,true},{0xfd99,5910,3,true},{0xfd9a,5913,3,true},{0xfd9b,5916,3,true},{0xfd9c,5919,3,true},
+	{0xfd9d,5922,3,true},{0xfd9e,5925,3,true},{0xfd9f,5928,3,true},{0xfda0,5931,3,true},{0xfda1,5934,3,true},{0xfda2,5937,3,true},
+	{0xfda3,5940,3,true},{0xfda4,5943,3,true},{0xfda5,5946,3,true},{0xfda6,5949,3,true},{0xfda7,5952,3,true},{0xfda8,5955,3,true},
+	{0xfda9,5958,3,true},{0xfdaa,5961,3,true},{0xfdab,5964,3,true},{0xfdac,5967,3,true},{0xfdad,5970,3,true},{0xfdae,5973,3,true},
+	{0xfdaf,5976,3,true},{0xfdb0,5979,3,true},{0xfdb1,5982,3,true},{0xfdb2,5985,3,true},{0xfdb3,5988,3,true},{0xfdb4,5991,3,true},
+	{0xfdb5,5994,3,true},{0xfdb6,5997,3,true},{0xfdb7,6000,3,true},{0xfdb8,6003,3,true},{0xfdb9,6006,3,true},{0xfdba,6009,3,true},
+	{0xfdbb,6012,3,true},{0xfdbc,6015,3,true},{0xfdbd,6018,3,true},{0xfdbe,6021,3,true},{0xfdbf,6024,3,true},{0xfdc0,6027,3,true},
+	{0xfdc1,6030,3,true},{0xfdc2,6033,3,true},{0xfdc3,6036,3,true},{0xfdc4,6039,3,true},{0xfdc5,6042,3,true},{0xfdc6,6045,3,true},
+	{0xfdc7,6048,3,true},{0xfdf0,6051,3,true},{0xfdf1,6054,3,true},{0xfdf2,6057,4,true},{0xfdf3,6061,4,true},{0xfdf4,6065,4,true},
+	{0xfdf5,6069,4,true},{0xfdf6,6073,4,true},{0xfdf7,6077,4,true},{0xfdf8,6081,4,true},{0xfdf9,6085,3,true},{0xfdfa,6088,18,true},
+	{0xfdfb,6106,8,true},{0xfdfc,6114,4,true},{0xfe10,6118,1,true},{0xfe11,6119,1,true},{0xfe12,6120,1,true},{0xfe13,6121,1,true},
+	{0xfe14,6122,1,true},{0xfe15,6123,1,true},{0xfe16,6124,1,true},{0xfe17,6125,1,true},{0xfe18,6126,1,true},{0xfe19,6127,1,true},
+	{0xfe30,6128,1,true},{0xfe31,6129,1,true},{0xfe32,6130,1,true},{0xfe33,6131,1,true},{0xfe34,6132,1,true},{0xfe35,6133,1,true},
+	{0xfe36,6134,1,true},{0xfe37,6135,1,true},{0xfe38,6136,1,true},{0xfe39,6137,1,true},{0xfe3a,6138,1,true},{0xfe3b,6139,1,true},
+	{0xfe3c,6140,1,true},{0xfe3d,6141,1,true},{0xfe3e,6142,1,true},{0xfe3f,6143,1,true},{0xfe40,6144,1,true},{0xfe41,6145,1,true},
+	{0xfe42,6146,1,true},{0xfe43,6147,1,true},{0xfe44,6148,1,true},{0xfe47,6149,1,true},{0xfe48,6150,1,true},{0xfe49,6151,1,true},
+	{0xfe4a,6152,1,true},{0xfe4b,6153,1,true},{0xfe4c,6154,1,true},{0xfe4d,6155,1,true},{0xfe4e,6156,1,true},{0xfe4f,6157,1,true},
+	{0xfe50,6158,1,true},{0xfe51,6159,1,true},{0xfe52,6160,1,true},{0xfe54,6161,1,true},{0xfe55,6162,1,true},{0xfe56,6163,1,true},
+	{0xfe57,6164,1,true},{0xfe58,6165,1,true},{0xfe59,6166,1,true},{0xfe5a,6167,1,true},{0xfe5b,6168,1,true},{0xfe5c,6169,1,true},
+	{0xfe5d,6170,1,true},{0xfe5e,6171,1,true},{0xfe5f,6172,1,true},{0xfe60,6173,1,true},{0xfe61,6174,1,true},{0xfe62,6175,1,true},
+	{0xfe63,6176,1,true},{0xfe64,6177,1,true},{0xfe65,6178,1,true},{0xfe66,6179,1,true},{0xfe68,6180,1,true},{0xfe69,6181,1,true},
+	{0xfe6a,6182,1,true},{0xfe6b,6183,1,true},{0xfe70,6184,2,true},{0xfe71,6186,2,true},{0xfe72,6188,2,true},{0xfe74,6190,2,true},
+	{0xfe76,6192,2,true},{0xfe77,6194,2,true},{0xfe78,6196,2,true},{0xfe79,6198,2,true},{0xfe7a,6200,2,true},{0xfe7b,6202,2,true},
+	{0xfe7c,6204,2,true},{0xfe7d,6206,2,true},{0xfe7e,6208,2,true},{0xfe7f,6210,2,true},{0xfe80,6212,1,true},{0xfe81,6213,1,true},
+	{0xfe82,6214,1,true},{0xfe83,6215,1,true},{0xfe84,6216,1,true},{0xfe85,6217,1,true},{0xfe86,6218,1,true},{0xfe87,6219,1,true},
+	{0xfe88,6220,1,true},{0xfe89,6221,1,true},{0xfe8a,6222,1,true},{0xfe8b,6223,1,true},{0xfe8c,6224,1,true},{0xfe8d,6225,1,true},
+	{0xfe8e,6226,1,true},{0xfe8f,6227,1,true},{0xfe90,6228,1,true},{0xfe91,6229,1,true},{0xfe92,6230,1,true},{0xfe93,6231,1,true},
+	{0xfe94,6232,1,true},{0xfe95,6233,1,true},{0xfe96,6234,1,true},{0xfe97,6235,1,true},{0xfe98,6236,1,true},{0xfe99,6237,1,true},
+	{0xfe9a,6238,1,true},{0xfe9b,6239,1,true},{0xfe9c,6240,1,true},{0xfe9d,6241,1,true},{0xfe9e,6242,1,true},{0xfe9f,6243,1,true},
+	{0xfea0,6244,1,true},{0xfea1,6245,1,true},{0xfea2,6246,1,true},{0xfea3,6247,1,true},{0xfea4,6248,1,true},{0xfea5,6249,1,true},
+	{0xfea6,6250,1,true},{0xfea7,6251,1,true},{0xfea8,6252,1,true},{0xfea9,6253,1,true},{0xfeaa,6254,1,true},{0xfeab,6255,1,true},
+	{0xfeac,6256,1,true},{0xfead,6257,1,true},{0xfeae,6258,1,true},{0xfeaf,6259,1,true},{0xfeb0,6260,1,true},{0xfeb1,6261,1,true},
+	{0xfeb2,6262,1,true},{0xfeb3,6263,1,true},{0xfeb4,6264,1,true},{0xfeb5,6265,1,true},{0xfeb6,6266,1,true},{0xfeb7,6267,1,true},
+	{0xfeb8,6268,1,true},{0xfeb9,6269,1,true},{0xfeba,6270,1,true},{0xfebb,6271,1,true},{0xfebc,6272,1,true},{0xfebd,6273,1,true},
+	{0xfebe,6274,1,true},{0xfebf,6275,1,true},{0xfec0,6276,1,true},{0xfec1,6277,1,true},{0xfec2,6278,1,true},{0xfec3,6279,1,true},
+	{0xfec4,6280,1,true},{0xfec5,6281,1,true},{0xfec6,6282,1,true},{0xfec7,6283,1,true},{0xfec8,6284,1,true},{0xfec9,6285,1,true},
+	{0xfeca,6286,1,true},{0xfecb,6287,1,true},{0xfecc,6288,1,true},{0xfecd,6289,1,true},{0xfece,6290,1,true},{0xfecf,6291,1,true},
+	{0xfed0,6292,1,true},{0xfed1,6293,1,true},{0xfed2,6294,1,true},{0xfed3,6295,1,true},{0xfed4,6296,1,true},{0xfed5,6297,1,true},
+	{0xfed6,6298,1,true},{0xfed7,6299,1,true},{0xfed8,6300,1,true},{0xfed9,6301,1,true},{0xfeda,6302,1,true},{0xfedb,6303,1,true},
+	{0xfedc,6304,1,true},{0xfedd,6305,1,true},{0xfede,6306,1,true},{0xfedf,6307,1,true},{0xfee0,6308,1,true},{0xfee1,6309,1,true},
+	{0xfee2,6310,1,true},{0xfee3,6311,1,true},{0xfee4,6312,1,true},{0xfee5,6313,1,true},{0xfee6,6314,1,true},{0xfee7,6315,1,true},
+	{0xfee8,6316,1,true},{0xfee9,6317,1,true},{0xfeea,6318,1,true},{0xfeeb,6319,1,true},{0xfeec,6320,1,true},{0xfeed,6321,1,true},
+	{0xfeee,6322,1,true},{0xfeef,6323,1,true},{0xfef0,6324,1,true},{0xfef1,6325,1,true},{0xfef2,6326,1,true},{0xfef3,6327,1,true},
+	{0xfef4,6328,1,true},{0xfef5,6329,2,true},{0xfef6,6331,2,true},{0xfef7,6333,2,true},{0xfef8,6335,2,true},{0xfef9,6337,2,true},
+	{0xfefa,6339,2,true},{0xfefb,6341,2,true},{0xfefc,6343,2,true},{0xff01,6345,1,true},{0xff02,6346,1,true},{0xff03,6347,1,true},
+	{0xff04,6348,1,true},{0xff05,6349,1,true},{0xff06,6350,1,true},{0xff07,6351,1,true},{0xff08,6352,1,true},{0xff09,6353,1,true},
+	{0xff0a,6354,1,true},{0xff0b,6355,1,true},{0xff0c,6356,1,true},{0xff0d,6357,1,true},{0xff0e,6358,1,true},{0xff0f,6359,1,true},
+	{0xff10,6360,1,true},{0xff11,6361,1,true},{0xff12,6362,1,true},{0xff13,6363,1,true},{0xff14,6364,1,true},{0xff15,6365,1,true},
+	{0xff16,6366,1,true},{0xff17,6367,1,true},{0xff18,6368,1,true},{0xff19,6369,1,true},{0xff1a,6370,1,true},{0xff1b,6371,1,true},
+	{0xff1c,6372,1,true},{0xff1d,6373,1,true},{0xff1e,6374,1,true},{0xff1f,6375,1,true},{0xff20,6376,1,true},{0xff21,6377,1,true},
+	{0xff22,6378,1,true},{0xff23,6379,1,true},{0xff24,6380,1,true},{0xff25,6381,1,true},{0xff26,6382,1,true},{0xff27,6383,1,true},
+	{0xff28,6384,1,true},{0xff29,6385,1,true},{0xff2a,6386,1,true},{0xff2b,6387,1,true},{0xff2c,6388,1,true},{0xff2d,6389,1,true},
+	{0xff2e,6390,1,true},{0xff2f,6391,1,true},{0xff30,6392,1,true},{0xff31,6393,1,true},{0xff32,6394,1,true},{0xff33,6395,1,true},
+	{0xff34,6396,1,true},{0xff35,6397,1,true},{0xff36,6398,1,true},{0xff37,6399,1,true},{0xff38,6400,1,true},{0xff39,6401,1,true},
+	{0xff3a,6402,1,true},{0xff3b,6403,1,true},{0xff3c,6404,1,true},{0xff3d,6405,1,true},{0xff3e,6406,1,true},{0xff3f,6407,1,true},
+	{0xff40,6408,1,true},{0xff41,6409,1,true},{0xff42,6410,1,true},{0xff43,6411,1,true},{0xff44,6412,1,true},{0xff45,6413,1,true},
+	{0xff46,6414,1,true},{0xff47,6415,1,true},{0xff48,6416,1,true},{0xff49,6417,1,true},{0xff4a,6418,1,true},{0xff4b,6419,1,true},
+	{0xff4c,6420,1,true},{0xff4d,6421,1,true},{0xff4e,6422,1,true},{0xff4f,6423,1,true},{0xff50,6424,1,true},{0xff51,6425,1,true},
+	{0xff52,6426,1,true},{0xff53,6427,1,true},{0xff54,6428,1,true},{0xff55,6429,1,true},{0xff56,6430,1,true},{0xff57,6431,1,true},
+	{0xff58,6432,1,true},{0xff59,6433,1,true},{0xff5a,6434,1,true},{0xff5b,6435,1,true},{0xff5c,6436,1,true},{0xff5d,6437,1,true},
+	{0xff5e,6438,1,true},{0xff5f,6439,1,true},{0xff60,6440,1,true},{0xff61,6441,1,true},{0xff62,6442,1,true},{0xff63,6443,1,true},
+	{0xff64,6444,1,true},{0xff65,6445,1,true},{0xff66,6446,1,true},{0xff67,6447,1,true},{0xff68,6448,1,true},{0xff69,6449,1,true},
+	{0xff6a,6450,1,true},{0xff6b,6451,1,true},{0xff6c,6452,1,true},{0xff6d,6453,1,true},{0xff6e,6454,1,true},{0xff6f,6455,1,true},
+	{0xff70,6456,1,true},{0xff71,6457,1,true},{0xff72,6458,1,true},{0xff73,6459,1,true},{0xff74,6460,1,true},{0xff75,6461,1,true},
+	{0xff76,6462,1,true},{0xff77,6463,1,true},{0xff78,6464,1,true},{0xff79,6465,1,true},{0xff7a,6466,1,true},{0xff7b,6467,1,true},
+	{0xff7c,6468,1,true},{0xff7d,6469,1,true},{0xff7e,6470,1,true},{0xff7f,6471,1,true},{0xff80,6472,1,true},{0xff81,6473,1,true},
+	{0xff82,6474,1,true},{0xff83,6475,1,true},{0xff84,6476,1,true},{0xff85,6477,1,true},{0xff86,6478,1,true},{0xff87,6479,1,true},
+	{0xff88,6480,1,true},{0xff89,6481,1,true},{0xff8a,6482,1,true},{0xff8b,6483,1,true},{0xff8c,6484,1,true},{0xff8d,6485,1,true},
+	{0xff8e,6486,1,true},{0xff8f,6487,1,true},{0xff90,6488,1,true},{0xff91,6489,1,true},{0xff92,6490,1,true},{0xff93,6491,1,true},
+	{0xff94,6492,1,true},{0xff95,6493,1,true},{0xff96,6494,1,true},{0xff97,6495,1,true},{0xff98,6496,1,true},{0xff99,6497,1,true},
+	{0xff9a,6498,1,true},{0xff9b,6499,1,true},{0xff9c,6500,1,true},{0xff9d,6501,1,true},{0xff9e,6502,1,true},{0xff9f,6503,1,true},
+	{0xffa0,6504,1,true},{0xffa1,6505,1,true},{0xffa2,6506,1,true},{0xffa3,6507,1,true},{0xffa4,6508,1,true},{0xffa5,6509,1,true},
+	{0xffa6,6510,1,true},{0xffa7,6511,1,true},{0xffa8,6512,1,true},{0xffa9,6513,1,true},{0xffaa,6514,1,true},{0xffab,6515,1,true},
+	{0xffac,6516,1,true},{0xffad,6517,1,true},{0xffae,6518,1,true},{0xffaf,6519,1,true},{0xffb0,6520,1,true},{0xffb1,6521,1,true},
+	{0xffb2,6522,1,true},{0xffb3,6523,1,true},{0xffb4,6524,1,true},{0xffb5,6525,1,true},{0xffb6,6526,1,true},{0xffb7,6527,1,true},
+	{0xffb8,6528,1,true},{0xffb9,6529,1,true},{0xffba,6530,1,true},{0xffbb,6531,1,true},{0xffbc,6532,1,true},{0xffbd,6533,1,true},
+	{0xffbe,6534,1,true},{0xffc2,6535,1,true},{0xffc3,6536,1,true},{0xffc4,6537,1,true},{0xffc5,6538,1,true},{0xffc6,6539,1,true},
+	{0xffc7,6540,1,true},{0xffca,6541,1,true},{0xffcb,6542,1,true},{0xffcc,6543,1,true},{0xffcd,6544,1,true},{0xffce,6545,1,true},
+	{0xffcf,6546,1,true},{0xffd2,6547,1,true},{0xffd3,6548,1,true},{0xffd4,6549,1,true},{0xffd5,6550,1,true},{0xffd6,6551,1,true},
+	{0xffd7,6552,1,true},{0xffda,6553,1,true},{0xffdb,6554,1,true},{0xffdc,6555,1,true},{0xffe0,6556,1,true},{0xffe1,6557,1,true},
+	{0xffe2,6558,1,true},{0xffe3,6559,1,true},{0xffe4,6560,1,true},{0xffe5,6561,1,true},{0xffe6,6562,1,true},{0xffe8,6563,1,true},
+	{0xffe9,6564,1,true},{0xffea,6565,1,true},{0xffeb,6566,1,true},{0xffec,6567,1,true},{0xffed,6568,1,true},{0xffee,6569,1,true},
+	{0x10781,6570,1,true},{0x10782,6571,1,true},{0x10783,6572,1,true},{0x10784,6573,1,true},{0x10785,6574,1,true},{0x10787,6575,1,true},
+	{0x10788,6576,1,true},{0x10789,6577,1,true},{0x1078a,6578,1,true},{0x1078b,6579,1,true},{0x1078c,6580,1,true},{0x1078d,6581,1,true},
+	{0x1078e,6582,1,true},{0x1078f,6583,1,true},{0x10790,6584,1,true},{0x10791,6585,1,true},{0x10792,6586,1,true},{0x10793,6587,1,true},
+	{0x10794,6588,1,true},{0x10795,6589,1,true},{0x10796,6590,1,true},{0x10797,6591,1,true},{0x10798,6592,1,true},{0x10799,6593,1,true},
+	{0x1079a,6594,1,true},{0x1079b,6595,1,true},{0x1079c,6596,1,true},{0x1079d,6597,1,true},{0x1079e,6598,1,true},{0x1079f,6599,1,true},
+	{0x107a0,6600,1,true},{0x107a1,6601,1,true},{0x107a2,6602,1,true},{0x107a3,6603,1,true},{0x107a4,6604,1,true},{0x107a5,6605,1,true},
+	{0x107a6,6606,1,true},{0x107a7,6607,1,true},{0x107a8,6608,1,true},{0x107a9,6609,1,true},{0x107aa,6610,1,true},{0x107ab,6611,1,true},
+	{0x107ac,6612,1,true},{0x107ad,6613,1,true},{0x107ae,6614,1,true},{0x107af,6615,1,true},{0x107b0,6616,1,true},{0x107b2,6617,1,true},
+	{0x107b3,6618,1,true},{0x107b4,6619,1,true},{0x107b5,6620,1,true},{0x107b6,6621,1,true},{0x107b7,6622,1,true},{0x107b8,6623,1,true},
+	{0x107b9,6624,1,true},{0x107ba,6625,1,true},{0x1109a,6626,2,false},{0x1109c,6628,2,false},{0x110ab,6630,2,false},{0x1112e,6632,2,false},
+	{0x1112f,6634,2,false},{0x1134b,6636,2,false},{0x1134c,6638,2,false},{0x114bb,6640,2,false},{0x114bc,6642,2,false},{0x114be,6644,2,false},
+	{0x115ba,6646,2,false},{0x115bb,6648,2,false},{0x11938,6650,2,false},{0x1d15e,6652,2,false},{0x1d15f,6654,2,false},{0x1d160,6656,2,false},
+	{0x1d161,6658,2,false},{0x1d162,6660,2,false},{0x1d163,6662,2,false},{0x1d164,6664,2,false},{0x1d1bb,6666,2,false},{0x1d1bc,6668,2,false},
+	{0x1d1bd,6670,2,false},{0x1d1be,6672,2,false},{0x1d1bf,6674,2,false},{0x1d1c0,6676,2,false},{0x1d400,6678,1,true},{0x1d401,6679,1,true},
+	{0x1d402,6680,1,true},{0x1d403,6681,1,true},{0x1d404,6682,1,true},{0x1d405,6683,1,true},{0x1d406,6684,1,true},{0x1d407,6685,1,true},
+	{0x1d408,6686,1,true},{0x1d409,6687,1,true},{0x1d40a,6688,1,true},{0x1d40b,6689,1,true},{0x1d40c,6690,1,true},{0x1d40d,6691,1,true},
+	{0x1d40e,6692,1,true},{0x1d40f,6693,1,true},{0x1d410,6694,1,true},{0x1d411,6695,1,true},{0x1d412,6696,1,true},{0x1d413,6697,1,true},
+	{0x1d414,6698,1,true},{0x1d415,6699,1,true},{0x1d416,6700,1,true},{0x1d417,6701,1,true},{0x1d418,6702,1,true},{0x1d419,6703,1,true},
+	{0x1d41a,6704,1,true},{0x1d41b,6705,1,true},{0x1d41c,6706,1,true},{0x1d41d,6707,1,true},{0x1d41e,6708,1,true},{0x1d41f,6709,1,true},
+	{0x1d420,6710,1,true},{0x1d421,6711,1,true},{0x1d422,6712,1,true},{0x1d423,6713,1,true},{0x1d424,6714,1,true},{0x1d425,6715,1,true},
+	{0x1d426,6716,1,true},{0x1d427,6717,1,true},{0x1d428,6718,1,true},{0x1d429,6719,1,true},{0x1d42a,6720,1,true},{0x1d42b,6721,1,true},
+	{0x1d42c,6722,1,true},{0x1d42d,6723,1,true},{0x1d42e,6724,1,true},{0x1d42f,6725,1,true},{0x1d430,6726,1,true},{0x1d431,6727,1,true},
+	{0x1d432,6728,1,true},{0x1d433,6729,1,true},{0x1d434,6730,1,true},{0x1d435,6731,1,true},{0x1d436,6732,1,true},{0x1d437,6733,1,true},
+	{0x1d438,6734,1,true},{0x1d439,6735,1,true},{0x1d43a,6736,1,true},{0x1d43b,6737,1,true},{0x1d43c,6738,1,true},{0x1d43d,6739,1,true},
+	{0x1d43e,6740,1,true},{0x1d43f,6741,1,true},{0x1d440,6742,1,true},{0x1d441,6743,1,true},{0x1d442,6744,1,true},{0x1d443,6745,1,true},
+	{0x1d444,6746,1,true},{0x1d445,6747,1,true},{0x1d446,6748,1,true},{0x1d447,6749,1,true},{0x1d448,6750,1,true},{0x1d449,6751,1,true},
+	{0x1d44a,6752,1,true},{0x1d44b,6753,1,true},{0x1d44c,6754,1,true},{0x1d44d,6755,1,true},{0x1d44e,6756,1,true},{0x1d44f,6757,1,true},
+	{0x1d450,6758,1,true},{0x1d451,6759,1,true},{0x1d452,6760,1,true},{0x1d453,6761,1,true},{0x1d454,6762,1,true},{0x1d456,6763,1,true},
+	{0x1d457,6764,1,true},{0x1d458,6765,1,true},{0x1d459,6766,1,true},{0x1d45a,6767,1,true},{0x1d45b,6768,1,true},{0x1d45c,6769,1,true},
+	{0x1d45d,6770,1,true},{0x1d45e,6771,1,true},{0x1d45f,6772,1,true},{0x1d460,6773,1,true},{0x1d461,6774,1,true},{0x1d462,6775,1,true},
+	{0x1d463,6776,1,true},{0x1d464,6777,1,true},{0x1d465,6778,1,true},{0x1d466,6779,1,true},{0x1d467,6780,1,true},{0x1d468,6781,1,true},
+	{0x1d469,6782,1,true},{0x1d46a,6783,1,true},{0x1d46b,6784,1,true},{0x1d46c,6785,1,true},{0x1d46d,6786,1,true},{0x1d46e,6787,1,true},
+	{0x1d46f,6788,1,true},{0x1d470,6789,1,true},{0x1d471,6790,1,true},{0x1d472,6791,1,true},{0x1d473,6792,1,true},{0x1d474,6793,1,true},
+	{0x1d475,6794,1,true},{0x1d476,6795,1,true},{0x1d477,6796,1,true},{0x1d478,6797,1,true},{0x1d479,6798,1,true},{0x1d47a,6799,1,true},
+	{0x1d47b,6800,1,true},{0x1d47c,6801,1,true},{0x1d47d,6802,1,true},{0x1d47e,6803,1,true},{0x1d47f,6804,1,true},{0x1d480,6805,1,true},
+	{0x1d481,6806,1,true},{0x1d482,6807,1,true},{0x1d483,6808,1,true},{0x1d484,6809,1,true},{0x1d485,6810,1,true},{0x1d486,6811,1,true},
+	{0x1d487,6812,1,true},{0x1d488,6813,1,true},{0x1d489,6814,1,true},{0x1d48a,6815,1,true},{0x1d48b,6816,1,true},{0x1d48c,6817,1,true},
+	{0x1d48d,6818,1,true},{0x1d48e,6819,1,true},{0x1d48f,6820,1,true},{0x1d490,6821,1,true},{0x1d491,6822,1,true},{0x1d492,6823,1,true},
+	{0x1d493,6824,1,true},{0x1d494,6825,1,true},{0x1d495,6826,1,true},{0x1d496,6827,1,true},{0x1d497,6828,1,true},{0x1d498,6829,1,true},
+	{0x1d499,6830,1,true},{0x1d49a,6831,1,true},{0x1d49b,6832,1,true},{0x1d49c,6833,1,true},{0x1d49e,6834,1,true},{0x1d49f,6835,1,true},
+	{0x1d4a2,6836,1,true},{0x1d4a5,6837,1,true},{0x1d4a6,6838,1,true},{0x1d4a9,6839,1,true},{0x1d4aa,6840,1,true},{0x1d4ab,6841,1,true},
+	{0x1d4ac,6842,1,true},{0x1d4ae,6843,1,true},{0x1d4af,6844,1,true},{0x1d4b0,6845,1,true},{0x1d4b1,6846,1,true},{0x1d4b2,6847,1,true},
+	{0x1d4b3,6848,1,true},{0x1d4b4,6849,1,true},{0x1d4b5,6850,1,true},{0x1d4b6,6851,1,true},{0x1d4b7,6852,1,true},{0x1d4b8,6853,1,true},
+	{0x1d4b9,6854,1,true},{0x1d4bb,6855,1,true},{0x1d4bd,6856,1,true},{0x1d4be,6857,1,true},{0x1d4bf,6858,1,true},{0x1d4c0,6859,1,true},
+	{0x1d4c1,6860,1,true},{0x1d4c2,6861,1,true},{0x1d4c3,6862,1,true},{0x1d4c5,6863,1,true},{0x1d4c6,6864,1,true},{0x1d4c7,6865,1,true},
+	{0x1d4c8,6866,1,true},{0x1d4c9,6867,1,true},{0x1d4ca,6868,1,true},{0x1d4cb,6869,1,true},{0x1d4cc,6870,1,true},{0x1d4cd,6871,1,true},
+	{0x1d4ce,6872,1,true},{0x1d4cf,6873,1,true},{0x1d4d0,6874,1,true},{0x1d4d1,6875,1,true},{0x1d4d2,6876,1,true},{0x1d4d3,6877,1,true},
+	{0x1d4d4,6878,1,true},{0x1d4d5,6879,1,true},{0x1d4d6,6880,1,true},{0x1d4d7,6881,1,true},{0x1d4d8,6882,1,true},{0x1d4d9,6883,1,true},
+	{0x1d4da,6884,1,true},{0x1d4db,6885,1,true},{0x1d4dc,6886,1,true},{0x1d4dd,6887,1,true},{0x1d4de,6888,1,true},{0x1d4df,6889,1,true},
+	{0x1d4e0,6890,1,true},{0x1d4e1,6891,1,true},{0x1d4e2,6892,1,true},{0x1d4e3,6893,1,true},{0x1d4e4,6894,1,true},{0x1d4e5,6895,1,true},
+	{0x1d4e6,6896,1,true},{0x1d4e7,6897,1,true},{0x1d4e8,6898,1,true},{0x1d4e9,6899,1,true},{0x1d4ea,6900,1,true},{0x1d4eb,6901,1,true},
+	{0x1d4ec,6902,1,true},{0x1d4ed,6903,1,true},{0x1d4ee,6904,1,true},{0x1d4ef,6905,1,true},{0x1d4f0,6906,1,true},{0x1d4f1,6907,1,true},
+	{0x1d4f2,6908,1,true},{0x1d4f3,6909,1,true},{0x1d4f4,6910,1,true},{0x1d4f5,6911,1,true},{0x1d4f6,6912,1,true},{0x1d4f7,6913,1,true},
+	{0x1d4f8,6914,1,true},{0x1d4f9,6915,1,true},{0x1d4fa,6916,1,true},{0x1d4fb,6917,1,true},{0x1d4fc,6918,1,true},{0x1d4fd,6919,1,true},
+	{0x1d4fe,6920,1,true},{0x1d4ff,6921,1,true},{0x1d500,6922,1,true},{0x1d501,6923,1,true},{0x1d502,6924,1,true},{0x1d503,6925,1,true},
+	{0x1d504,6926,1,true},{0x1d505,6927,1,true},{0x1d507,6928,1,true},{0x1d508,6929,1,true},{0x1d509,6930,1,true},{0x1d50a,6931,1,true},
+	{0x1d50d,6932,1,true},{0x1d50e,6933,1,true},{0x1d50f,6934,1,true},{0x1d510,6935,1,true},{0x1d511,6936,1,true},{0x1d512,6937,1,true},
+	{0x1d513,6938,1,true},{0x1d514,6939,1,true},{0x1d516,6940,1,true},{0x1d517,6941,1,true},{0x1d518,6942,1,true},{0x1d519,6943,1,true},
+	{0x1d51a,6944,1,true},{0x1d51b,6945,1,true},{0x1d51c,6946,1,true},{0x1d51e,6947,1,true},{0x1d51f,6948,1,true},{0x1d520,6949,1,true},
+	{0x1d521,6950,1,true},{0x1d522,6951,1,true},{0x1d523,6952,1,true},{0x1d524,6953,1,true},{0x1d525,6954,1,true},{0x1d526,6955,1,true},
+	{0x1d527,6956,1,true},{0x1d528,6957,1,true},{0x1d529,6958,1,true},{0x1d52a,6959,1,true},{0x1d52b,6960,1,true},{0x1d52c,6961,1,true},
+	{0x1d52d,6962,1,true},{0x1d52e,6963,1,true},{0x1d52f,6964,1,true},{0x1d530,6965,1,true},{0x1d531,6966,1,true},{0x1d532,6967,1,true},
+	{0x1d533,6968,1,true},{0x1d534,6969,1,true},{0x1d535,6970,1,true},{0x1d536,6971,1,true},{0x1d537,6972,1,true},{0x1d538,6973,1,true},
+	{0x1d539,6974,1,true},{0x1d53b,6975,1,true},{0x1d53c,6976,1,true},{0x1d53d,6977,1,true},{0x1d53e,6978,1,true},{0x1d540,6979,1,true},
+	{0x1d541,6980,1,true},{0x1d542,6981,1,true},{0x1d543,6982,1,true},{0x1d544,6983,1,true},{0x1d546,6984,1,true},{0x1d54a,6985,1,true},
+	{0x1d54b,6986,1,true},{0x1d54c,6987,1,true},{0x1d54d,6988,1,true},{0x1d54e,6989,1,true},{0x1d54f,6990,1,true},{0x1d550,6991,1,true},
+	{0x1d552,6992,1,true},{0x1d553,6993,1,true},{0x1d554,6994,1,true},{0x1d555,6995,1,true},{0x1d556,6996,1,true},{0x1d557,6997,1,true},
+	{0x1d558,6998,1,true},{0x1d559,6999,1,true},{0x1d55a,7000,1,true},{0x1d55b,7001,1,true},{0x1d55c,7002,1,true},{0x1d55d,7003,1,true},
+	{0x1d55e,7004,1,true},{0x1d55f,7005,1,true},{0x1d560,7006,1,true},{0x1d561,7007,1,true},{0x1d562,7008,1,true},{0x1d563,7009,1,true},
+	{0x1d564,7010,1,true},{0x1d565,7011,1,true},{0x1d566,7012,1,true},{0x1d567,7013,1,true},{0x1d568,7014,1,true},{0x1d569,7015,1,true},
+	{0x1d56a,7016,1,true},{0x1d56b,7017,1,true},{0x1d56c,7018,1,true},{0x1d56d,7019,1,true},{0x1d56e,7020,1,true},{0x1d56f,7021,1,true},
+	{0x1d570,7022,1,true},{0x1d571,7023,1,true},{0x1d572,7024,1,true},{0x1d573,7025,1,true},{0x1d574,7026,1,true},{0x1d575,7027,1,true},
+	{0x1d576,7028,1,true},{0x1d577,7029,1,true},{0x1d578,7030,1,true},{0x1d579,7031,1,true},{0x1d57a,7032,1,true},{0x1d57b,7033,1,true},
+	{0x1d57c,7034,1,true},{0x1d57d,7035,1,true},{0x1d57e,7036,1,true},{0x1d57f,7037,1,true},{0x1d580,7038,1,true},{0x1d581,7039,1,true},
+	{0x1d582,7040,1,true},{0x1d583,7041,1,true},{0x1d584,7042,1,true},{0x1d585,7043,1,true},{0x1d586,7044,1,true},{0x1d587,7045,1,true},
+	{0x1d588,7046,1,true},{0x1d589,7047,1,true},{0x1d58a,7048,1,true},{0x1d58b,7049,1,true},{0x1d58c,7050,1,true},{0x1d58d,7051,1,true},
+	{0x1d58e,7052,1,true},{0x1d58f,7053,1,true},{0x1d590,7054,1,true},{0x1d591,7055,1,true},{0x1d592,7056,1,true},{0x1d593,7057,1,true},
+	{0x1d594,7058,1,true},{0x1d595,7059,1,true},{0x1d596,7060,1,true},{0x1d597,7061,1,true},{0x1d598,7062,1,true},{0x1d599,7063,1,true},
+	{0x1d59a,7064,1,true},{0x1d59b,7065,1,true},{0x1d59c,7066,1,true},{0x1d59d,7067,1,true},{0x1d59e,7068,1,true},{0x1d59f,7069,1,true},
+	{0x1d5a0,7070,1,true},{0x1d5a1,7071,1,true},{0x1d5a2,7072,1,true},{0x1d5a3,7073,1,true},{0x1d5a4,7074,1,true},{0x1d5a5,7075,1,true},
+	{0x1d5a6,7076,1,true},{0x1d5a7,7077,1,true},{0x1d5a8,7078,1,true},{0x1d5a9,7079,1,true},{0x1d5aa,7080,1,true},{0x1d5ab,7081,1,true},
+	{0x1d5ac,7082,1,true},{0x1d5ad,7083,1,true},{0x1d5ae,7084,1,true},{0x1d5af,7085,1,true},{0x1d5b0,7086,1,true},{0x1d5b1,7087,1,true},
+	{0x1d5b2,7088,1,true},{0x1d5b3,7089,1,true},{0x1d5b4,7090,1,true},{0x1d5b5,7091,1,true},{0x1d5b6,7092,1,true},{0x1d5b7,7093,1,true},
+	{0x1d5b8,7094,1,true},{0x1d5b9,7095,1,true},{0x1d5ba,7096,1,true},{0x1d5bb,7097,1,true},{0x1d5bc,7098,1,true},{0x1d5bd,7099,1,true},
+	{0x1d5be,7100,1,true},{0x1d5bf,7101,1,true},{0x1d5c0,7102,1,true},{0x1d5c1,7103,1,true},{0x1d5c2,7104,1,true},{0x1d5c3,7105,1,true},
+	{0x1d5c4,7106,1,true},{0x1d5c5,7107,1,true},{0x1d5c6,7108,1,true},{0x1d5c7,7109,1,true},{0x1d5c8,7110,1,true},{0x1d5c9,7111,1,true},
+	{0x1d5ca,7112,1,true},{0x1d5cb,7113,1,true},{0x1d5cc,7114,1,true},{0x1d5cd,7115,1,true},{0x1d5ce,7116,1,true},{0x1d5cf,7117,1,true},
+	{0x1d5d0,7118,1,true},{0x1d5d1,7119,1,true},{0x1d5d2,7120,1,true},{0x1d5d3,7121,1,true},{0x1d5d4,7122,1,true},{0x1d5d5,7123,1,true},
+	{0x1d5d6,7124,1,true},{0x1d5d7,7125,1,true},{0x1d5d8,7126,1,true},{0x1d5d9,7127,1,true},{0x1d5da,7128,1,true},{0x1d5db,7129,1,true},
+	{0x1d5dc,7130,1,true},{0x1d5dd,7131,1,true},{0x1d5de,7132,1,true},{0x1d5df,7133,1,true},{0x1d5e0,7134,1,true},{0x1d5e1,7135,1,true},
+	{0x1d5e2,7136,1,true},{0x1d5e3,7137,1,true},{0x1d5e4,7138,1,true},{0x1d5e5,7139,1,true},{0x1d5e6,7140,1,true},{0x1d5e7,7141,1,true},
+	{0x1d5e8,7142,1,true},{0x1d5e9,7143,1,true},{0x1d5ea,7144,1,true},{0x1d5eb,7145,1,true},{0x1d5ec,7146,1,true},{0x1d5ed,7147,1,true},
+	{0x1d5ee,7148,1,true},{0x1d5ef,7149,1,true},{0x1d5f0,7150,1,true},{0x1d5f1,7151,1,true},{0x1d5f2,7152,1,true},{0x1d5f3,7153,1,true},
+	{0x1d5f4,7154,1,true},{0x1d5f5,7155,1,true},{0x1d5f6,7156,1,true},{0x1d5f7,7157,1,true},{0x1d5f8,7158,1,true},{0x1d5f9,7159,1,true},
+	{0x1d5fa,7160,1,true},{0x1d5fb,7161,1,true},{0x1d5fc,7162,1,true},{0x1d5fd,7163,1,true},{0x1d5fe,7164,1,true},{0x1d5ff,7165,1,true},
+	{0x1d600,7166,1,true},{0x1d601,7167,1,true},{0x1d602,7168,1,true},{0x1d603,7169,1,true},{0x1d604,7170,1,true},{0x1d605,7171,1,true},
+	{0x1d606,7172,1,true},{0x1d607,7173,1,true},{0x1d608,7174,1,true},{0x1d609,7175,1,true},{0x1d60a,7176,1,true},{0x1d60b,7177,1,true},
+	{0x1d60c,7178,1,true},{0x1d60d,7179,1,true},{0x1d60e,7180,1,true},{0x1d60f,7181,1,true},{0x1d610,7182,1,true},{0x1d611,7183,1,true},
+	{0x1d612,7184,1,true},{0x1d613,7185,1,true},{0x1d614,7186,1,true},{0x1d615,7187,1,true},{0x1d616,7188,1,true},{0x1d617,7189,1,true},
+	{0x1d618,7190,1,true},{0x1d619,7191,1,true},{0x1d61a,7192,1,true},{0x1d61b,7193,1,true},{0x1d61c,7194,1,true},{0x1d61d,7195,1,true},
+	{0x1d61e,7196,1,true},{0x1d61f,7197,1,true},{0x1d620,7198,1,true},{0x1d621,7199,1,true},{0x1d622,7200,1,true},{0x1d623,7201,1,true},
+	{0x1d624,7202,1,true},{0x1d625,7203,1,true},{0x1d626,7204,1,true},{0x1d627,7205,1,true},{0x1d628,7206,1,true},{0x1d629,7207,1,true},
+	{0x1d62a,7208,1,true},{0x1d62b,7209,1,true},{0x1d62c,7210,1,true},{0x1d62d,7211,1,true},{0x1d62e,7212,1,true},{0x1d62f,7213,1,true},
+	{0x1d630,7214,1,true},{0x1d631,7215,1,true},{0x1d632,7216,1,true},{0x1d633,7217,1,true},{0x1d634,7218,1,true},{0x1d635,7219,1,true},
+	{0x1d636,7220,1,true},{0x1d637,7221,1,true},{0x1d638,7222,1,true},{0x1d639,7223,1,true},{0x1d63a,7224,1,true},{0x1d63b,7225,1,true},
+	{0x1d63c,7226,1,true},{0x1d63d,7227,1,true},{0x1d63e,7228,1,true},{0x1d63f,7229,1,true},{0x1d640,7230,1,true},{0x1d641,7231,1,true},
+	{0x1d642,7232,1,true},{0x1d643,7233,1,true},{0x1d644,7234,1,true},{0x1d645,7235,1,true},{0x1d646,7236,1,true},{0x1d647,7237,1,true},
+	{0x1d648,7238,1,true},{0x1d649,7239,1,true},{0x1d64a,7240,1,true},{0x1d64b,7241,1,true},{0x1d64c,7242,1,true},{0x1d64d,7243,1,true},
+	{0x1d64e,7244,1,true},{0x1d64f,7245,1,true},{0x1d650,7246,1,true},{0x1d651,7247,1,true},{0x1d652,7248,1,true},{0x1d653,7249,1,true},
+	{0x1d654,7250,1,true},{0x1d655,7251,1,true},{0x1d656,7252,1,true},{0x1d657,7253,1,true},{0x1d658,7254,1,true},{0x1d659,7255,1,true},
+	{0x1d65a,7256,1,true},{0x1d65b,7257,1,true},{0x1d65c,7258,1,true},{0x1d65d,7259,1,true},{0x1d65e,7260,1,true},{0x1d65f,7261,1,true},
+	{0x1d660,7262,1,true},{0x1d661,7263,1,true},{0x1d662,7264,1,true},{0x1d663,7265,1,true},{0x1d664,7266,1,true},{0x1d665,7267,1,true},
+	{0x1d666,7268,1,true},{0x1d667,7269,1,true},{0x1d668,7270,1,true},{0x1d669,7271,1,true},{0x1d66a,7272,1,true},{0x1d66b,7273,1,true},
+	{0x1d66c,7274,1,true},{0x1d66d,7275,1,true},{0x1d66e,7276,1,true},{0x1d66f,7277,1,true},{0x1d670,7278,1,true},{0x1d671,7279,1,true},
+	{0x1d672,7280,1,true},{0x1d673,7281,1,true},{0x1d674,7282,1,true},{0x1d675,7283,1,true},{0x1d676,7284,1,true},{0x1d677,7285,1,true},
+	{0x1d678,7286,1,true},{0x1d679,7287,1,true},{0x1d67a,7288,1,true},{0x1d67b,7289,1,true},{0x1d67c,7290,1,true},{0x1d67d,7291,1,true},
+	{0x1d67e,7292,1,true},{0x1d67f,7293,1,true},{0x1d680,7294,1,true},{0x1d681,7295,1,true},{0x1d682,7296,1,true},{0x1d683,7297,1,true},
+	{0x1d684,7298,1,true},{0x1d685,7299,1,true},{0x1d686,7300,1,true},{0x1d687,7301,1,true},{0x1d688,7302,1,true},{0x1d689,7303,1,true},
+	{0x1d68a,7304,1,true},{0x1d68b,7305,1,true},{0x1d68c,7306,1,true},{0x1d68d,7307,1,true},{0x1d68e,7308,1,true},{0x1d68f,7309,1,true},
+	{0x1d690,7310,1,true},{0x1d691,7311,1,true},{0x1d692,7312,1,true},{0x1d693,7313,1,true},{0x1d694,7314,1,true},{0x1d695,7315,1,true},
+	{0x1d696,7316,1,true},{0x1d697,7317,1,true},{0x1d698,7318,1,true},{0x1d699,7319,1,true},{0x1d69a,7320,1,true},{0x1d69b,7321,1,true},
+	{0x1d69c,7322,1,true},{0x1d69d,7323,1,true},{0x1d69e,7324,1,true},{0x1d69f,7325,1,true},{0x1d6a0,7326,1,true},{0x1d6a1,7327,1,true},
+	{0x1d6a2,7328,1,true},{0x1d6a3,7329,1,true},{0x1d6a4,7330,1,true},{0x1d6a5,7331,1,true},{0x1d6a8,7332,1,true},{0x1d6a9,7333,1,true},
+	{0x1d6aa,7334,1,true},{0x1d6ab,7335,1,true},{0x1d6ac,7336,1,true},{0x1d6ad,7337,1,true},{0x1d6ae,7338,1,true},{0x1d6af,7339,1,true},
+	{0x1d6b0,7340,1,true},{0x1d6b1,7341,1,true},{0x1d6b2,7342,1,true},{0x1d6b3,7343,1,true},{0x1d6b4,7344,1,true},{0x1d6b5,7345,1,true},
+	{0x1d6b6,7346,1,true},{0x1d6b7,7347,1,true},{0x1d6b8,7348,1,true},{0x1d6b9,7349,1,true},{0x1d6ba,7350,1,true},{0x1d6bb,7351,1,true},
+	{0x1d6bc,7352,1,true},{0x1d6bd,7353,1,true},{0x1d6be,7354,1,true},{0x1d6bf,7355,1,true},{0x1d6c0,7356,1,true},{0x1d6c1,7357,1,true},
+	{0x1d6c2,7358,1,true},{0x1d6c3,7359,1,true},{0x1d6c4,7360,1,true},{0x1d6c5,7361,1,true},{0x1d6c6,7362,1,true},{0x1d6c7,7363,1,true},
+	{0x1d6c8,7364,1,true},{0x1d6c9,7365,1,true},{0x1d6ca,7366,1,true},{0x1d6cb,7367,1,true},{0x1d6cc,7368,1,true},{0x1d6cd,7369,1,true},
+	{0x1d6ce,7370,1,true},{0x1d6cf,7371,1,true},{0x1d6d0,7372,1,true},{0x1d6d1,7373,1,true},{0x1d6d2,7374,1,true},{0x1d6d3,7375,1,true},
+	{0x1d6d4,7376,1,true},{0x1d6d5,7377,1,true},{0x1d6d6,7378,1,true},{0x1d6d7,7379,1,true},{0x1d6d8,7380,1,true},{0x1d6d9,7381,1,true},
+	{0x1d6da,7382,1,true},{0x1d6db,7383,1,true},{0x1d6dc,7384,1,true},{0x1d6dd,7385,1,true},{0x1d6de,7386,1,true},{0x1d6df,7387,1,true},
+	{0x1d6e0,7388,1,true},{0x1d6e1,7389,1,true},{0x1d6e2,7390,1,true},{0x1d6e3,7391,1,true},{0x1d6e4,7392,1,true},{0x1d6e5,7393,1,true},
+	{0x1d6e6,7394,1,true},{0x1d6e7,7395,1,true},{0x1d6e8,7396,1,true},{0x1d6e9,7397,1,true},{0x1d6ea,7398,1,true},{0x1d6eb,7399,1,true},
+	{0x1d6ec,7400,1,true},{0x1d6ed,7401,1,true},{0x1d6ee,7402,1,true},{0x1d6ef,7403,1,true},{0x1d6f0,7404,1,true},{0x1d6f1,7405,1,true},
+	{0x1d6f2,7406,1,true},{0x1d6f3,7407,1,true},{0x1d6f4,7408,1,true},{0x1d6f5,7409,1,true},{0x1d6f6,7410,1,true},{0x1d6f7,7411,1,true},
+	{0x1d6f8,7412,1,true},{0x1d6f9,7413,1,true},{0x1d6fa,7414,1,true},{0x1d6fb,7415,1,true},{0x1d6fc,7416,1,true},{0x1d6fd,7417,1,true},
+	{0x1d6fe,7418,1,true},{0x1d6ff,7419,1,true},{0x1d700,7420,1,true},{0x1d701,7421,1,true},{0x1d702,7422,1,true},{0x1d703,7423,1,true},
+	{0x1d704,7424,1,true},{0x1d705,7425,1,true},{0x1d706,7426,1,true},{0x1d707,7427,1,true},{0x1d708,7428,1,true},{0x1d709,7429,1,true},
+	{0x1d70a,7430,1,true},{0x1d70b,7431,1,true},{0x1d70c,7432,1,true},{0x1d70d,7433,1,true},{0x1d70e,7434,1,true},{0x1d70f,7435,1,true},
+	{0x1d710,7436,1,true},{0x1d711,7437,1,true},{0x1d712,7438,1,true},{0x1d713,7439,1,true},{0x1d714,7440,1,true},{0x1d715,7441,1,true},
+	{0x1d716,7442,1,true},{0x1d717,7443,1,true},{0x1d718,7444,1,true},{0x1d719,7445,1,true},{0x1d71a,7446,1,true},{0x1d71b,7447,1,true},
+	{0x1d71c,7448,1,true},{0x1d71d,7449,1,true},{0x1d71e,7450,1,true},{0x1d71f,7451,1,true},{0x1d720,7452,1,true},{0x1d721,7453,1,true},
+	{0x1d722,7454,1,true},{0x1d723,7455,1,true},{0x1d724,7456,1,true},{0x1d725,7457,1,true},{0x1d726,7458,1,true},{0x1d727,7459,1,true},
+	{0x1d728,7460,1,true},{0x1d729,7461,1,true},{0x1d72a,7462,1,true},{0x1d72b,7463,1,true},{0x1d72c,7464,1,true},{0x1d72d,7465,1,true},
+	{0x1d72e,7466,1,true},{0x1d72f,7467,1,true},{0x1d730,7468,1,true},{0x1d731,7469,1,true},{0x1d732,7470,1,true},{0x1d733,7471,1,true},
+	{0x1d734,7472,1,true},{0x1d735,7473,1,true},{0x1d736,7474,1,true},{0x1d737,7475,1,true},{0x1d738,7476,1,true},{0x1d739,7477,1,true},
+	{0x1d73a,7478,1,true},{0x1d73b,7479,1,true},{0x1d73c,7480,1,true},{0x1d73d,7481,1,true},{0x1d73e,7482,1,true},{0x1d73f,7483,1,true},
+	{0x1d740,7484,1,true},{0x1d741,7485,1,true},{0x1d742,7486,1,true},{0x1d743,7487,1,true},{0x1d744,7488,1,true},{0x1d745,7489,1,true},
+	{0x1d746,7490,1,true},{0x1d747,7491,1,true},{0x1d748,7492,1,true},{0x1d749,7493,1,true},{0x1d74a,7494,1,true},{0x1d74b,7495,1,true},
+	{0x1d74c,7496,1,true},{0x1d74d,7497,1,true},{0x1d74e,7498,1,true},{0x1d74f,7499,1,true},{0x1d750,7500,1,true},{0x1d751,7501,1,true},
+	{0x1d752,7502,1,true},{0x1d753,7503,1,true},{0x1d754,7504,1,true},{0x1d755,7505,1,true},{0x1d756,7506,1,true},{0x1d757,7507,1,true},
+	{0x1d758,7508,1,true},{0x1d759,7509,1,true},{0x1d75a,7510,1,true},{0x1d75b,7511,1,true},{0x1d75c,7512,1,true},{0x1d75d,7513,1,true},
+	{0x1d75e,7514,1,true},{0x1d75f,7515,1,true},{0x1d760,7516,1,true},{0x1d761,7517,1,true},{0x1d762,7518,1,true},{0x1d763,7519,1,true},
+	{0x1d764,7520,1,true},{0x1d765,7521,1,true},{0x1d766,7522,1,true},{0x1d767,7523,1,true},{0x1d768,7524,1,true},{0x1d769,7525,1,true},
+	{0x1d76a,7526,1,true},{0x1d76b,7527,1,true},{0x1d76c,7528,1,true},{0x1d76d,7529,1,true},{0x1d76e,7530,1,true},{0x1d76f,7531,1,true},
+	{0x1d770,7532,1,true},{0x1d771,7533,1,true},{0x1d772,7534,1,true},{0x1d773,7535,1,true},{0x1d774,7536,1,true},{0x1d775,7537,1,true},
+	{0x1d776,7538,1,true},{0x1d777,7539,1,true},{0x1d778,7540,1,true},{0x1d779,7541,1,true},{0x1d77a,7542,1,true},{0x1d77b,7543,1,true},
+	{0x1d77c,7544,1,true},{0x1d77d,7545,1,true},{0x1d77e,7546,1,true},{0x1d77f,7547,1,true},{0x1d780,7548,1,true},{0x1d781,7549,1,true},
+	{0x1d782,7550,1,true},{0x1d783,7551,1,true},{0x1d784,7552,1,true},{0x1d785,7553,1,true},{0x1d786,7554,1,true},{0x1d787,7555,1,true},
+	{0x1d788,7556,1,true},{0x1d789,7557,1,true},{0x1d78a,7558,1,true},{0x1d78b,7559,1,true},{0x1d78c,7560,1,true},{0x1d78d,7561,1,true},
+	{0x1d78e,7562,1,true},{0x1d78f,7563,1,true},{0x1d790,7564,1,true},{0x1d791,7565,1,true},{0x1d792,7566,1,true},{0x1d793,7567,1,true},
+	{0x1d794,7568,1,true},{0x1d795,7569,1,true},{0x1d796,7570,1,true},{0x1d797,7571,1,true},{0x1d798,7572,1,true},{0x1d799,7573,1,true},
+	{0x1d79a,7574,1,true},{0x1d79b,7575,1,true},{0x1d79c,7576,1,true},{0x1d79d,7577,1,true},{0x1d79e,7578,1,true},{0x1d79f,7579,1,true},
+	{0x1d7a0,7580,1,true},{0x1d7a1,7581,1,true},{0x1d7a2,7582,1,true},{0x1d7a3,7583,1,true},{0x1d7a4,7584,1,true},{0x1d7a5,7585,1,true},
+	{0x1d7a6,7586,1,true},{0x1d7a7,7587,1,true},{0x1d7a8,7588,1,true},{0x1d7a9,7589,1,true},{0x1d7aa,7590,1,true},{0x1d7ab,7591,1,true},
+	{0x1d7ac,7592,1,true},{0x1d7ad,7593,1,true},{0x1d7ae,7594,1,true},{0x1d7af,7595,1,true},{0x1d7b0,7596,1,true},{0x1d7b1,7597,1,true},
+	{0x1d7b2,7598,1,true},{0x1d7b3,7599,1,true},{0x1d7b4,7600,1,true},{0x1d7b5,7601,1,true},{0x1d7b6,7602,1,true},{0x1d7b7,7603,1,true},
+	{0x1d7b8,7604,1,true},{0x1d7b9,7605,1,true},{0x1d7ba,7606,1,true},{0x1d7bb,7607,1,true},{0x1d7bc,7608,1,true},{0x1d7bd,7609,1,true},
+	{0x1d7be,7610,1,true},{0x1d7bf,7611,1,true},{0x1d7c0,7612,1,true},{0x1d7c1,7613,1,true},{0x1d7c2,7614,1,true},{0x1d7c3,7615,1,true},
+	{0x1d7c4,7616,1,true},{0x1d7c5,7617,1,true},{0x1d7c6,7618,1,true},{0x1d7c7,7619,1,true},{0x1d7c8,7620,1,true},{0x1d7c9,7621,1,true},
+	{0x1d7ca,7622,1,true},{0x1d7cb,7623,1,true},{0x1d7ce,7624,1,true},{0x1d7cf,7625,1,true},{0x1d7d0,7626,1,true},{0x1d7d1,7627,1,true},
+	{0x1d7d2,7628,1,true},{0x1d7d3,7629,1,true},{0x1d7d4,7630,1,true},{0x1d7d5,7631,1,true},{0x1d7d6,7632,1,true},{0x1d7d7,7633,1,true},
+	{0x1d7d8,7634,1,true},{0x1d7d9,7635,1,true},{0x1d7da,7636,1,true},{0x1d7db,7637,1,true},{0x1d7dc,7638,1,true},{0x1d7dd,7639,1,true},
+	{0x1d7de,7640,1,true},{0x1d7df,7641,1,true},{0x1d7e0,7642,1,true},{0x1d7e1,7643,1,true},{0x1d7e2,7644,1,true},{0x1d7e3,7645,1,true},
+	{0x1d7e4,7646,1,true},{0x1d7e5,7647,1,true},{0x1d7e6,7648,1,true},{0x1d7e7,7649,1,true},{0x1d7e8,7650,1,true},{0x1d7e9,7651,1,true},
+	{0x1d7ea,7652,1,true},{0x1d7eb,7653,1,true},{0x1d7ec,7654,1,true},{0x1d7ed,7655,1,true},{0x1d7ee,7656,1,true},{0x1d7ef,7657,1,true},
+	{0x1d7f0,7658,1,true},{0x1d7f1,7659,1,true},{0x1d7f2,7660,1,true},{0x1d7f3,7661,1,true},{0x1d7f4,7662,1,true},{0x1d7f5,7663,1,true},
+	{0x1d7f6,7664,1,true},{0x1d7f7,7665,1,true},{0x1d7f8,7666,1,true},{0x1d7f9,7667,1,true},{0x1d7fa,7668,1,true},{0x1d7fb,7669,1,true},
+	{0x1d7fc,7670,1,true},{0x1d7fd,7671,1,true},{0x1d7fe,7672,1,true},{0x1d7ff,7673,1,true},{0x1ee00,7674,1,true},{0x1ee01,7675,1,true},
+	{0x1ee02,7676,1,true},{0x1ee03,7677,1,true},{0x1ee05,7678,1,true},{0x1ee06,7679,1,true},{0x1ee07,7680,1,true},{0x1ee08,7681,1,true},
+	{0x1ee09,7682,1,true},{0x1ee0a,7683,1,true},{0x1ee0b,7684,1,true},{0x1ee0c,7685,1,true},{0x1ee0d,7686,1,true},{0x1ee0e,7687,1,true},
+	{0x1ee0f,7688,1,true},{0x1ee10,7689,1,true},{0x1ee11,7690,1,true},{0x1ee12,7691,1,true},{0x1ee13,7692,1,true},{0x1ee14,7693,1,true},
+	{0x1ee15,7694,1,true},{0x1ee16,7695,1,true},{0x1ee17,7696,1,true},{0x1ee18,7697,1,true},{0x1ee19,7698,1,true},{0x1ee1a,7699,1,true},
+	{0x1ee1b,7700,1,true},{0x1ee1c,7701,1,true},{0x1ee1d,7702,1,true},{0x1ee1e,7703,1,true},{0x1ee1f,7704,1,true},{0x1ee21,7705,1,true},
+	{0x1ee22,7706,1,true},{0x1ee24,7707,1,true},{0x1ee27,7708,1,true},{0x1ee29,7709,1,true},{0x1ee2a,7710,1,true},{0x1ee2b,7711,1,true},
+	{0x1ee2c,7712,1,true},{0x1ee2d,7713,1,true},{0x1ee2e,7714,1,true},{0x1ee2f,7715,1,true},{0x1ee30,7716,1,true},{0x1ee31,7717,1,true},
+	{0x1ee32,7718,1,true},{0x1ee34,7719,1,true},{0x1ee35,7720,1,true},{0x1ee36,7721,1,true},{0x1ee37,7722,1,true},{0x1ee39,7723,1,true},
+	{0x1ee3b,7724,1,true},{0x1ee42,7725,1,true},{0x1ee47,7726,1,true},{0x1ee49,7727,1,true},{0x1ee4b,7728,1,true},{0x1ee4d,7729,1,true},
+	{0x1ee4e,7730,1,true},{0x1ee4f,7731,1,true},{0x1ee51,7732,1,true},{0x1ee52,7733,1,true},{0x1ee54,7734,1,true},{0x1ee57,7735,1,true},
+	{0x1ee59,7736,1,true},{0x1ee5b,7737,1,true},{0x1ee5d,7738,1,true},{0x1ee5f,7739,1,true},{0x1ee61,7740,1,true},{0x1ee62,7741,1,true},
+	{0x1ee64,7742,1,true},{0x1ee67,7743,1,true},{0x1ee68,7744,1,true},{0x1ee69,7745,1,true},{0x1ee6a,7746,1,true},{0x1ee6c,7747,1,true},
+	{0x1ee6d,7748,1,true},{0x1ee6e,7749,1,true},{0x1ee6f,7750,1,true},{0x1ee70,7751,1,true},{0x1ee71,7752,1,true},{0x1ee72,7753,1,true},
+	{0x1ee74,7754,1,true},{0x1ee75,7755,1,true},{0x1ee76,7756,1,true},{0x1ee77,7757,1,true},{0x1ee79,7758,1,true},{0x1ee7a,7759,1,true},
+	{0x1ee7b,7760,1,true},{0x1ee7c,7761,1,true},{0x1ee7e,7762,1,true},{0x1ee80,7763,1,true},{0x1ee81,7764,1,true},{0x1ee82,7765,1,true},
+	{0x1ee83,7766,1,true},{0x1ee84,7767,1,true},{0x1ee85,7768,1,true},{0x1ee86,7769,1,true},{0x1ee87,7770,1,true},{0x1ee88,7771,1,true},
+	{0x1ee89,7772,1,true},{0x1ee8b,7773,1,true},{0x1ee8c,7774,1,true},{0x1ee8d,7775,1,true},{0x1ee8e,7776,1,true},{0x1ee8f,7777,1,true},
+	{0x1ee90,7778,1,true},{0x1ee91,7779,1,true},{0x1ee92,7780,1,true},{0x1ee93,7781,1,true},{0x1ee94,7782,1,true},{0x1ee95,7783,1,true},
+	{0x1ee96,7784,1,true},{0x1ee97,7785,1,true},{0x1ee98,7786,1,true},{0x1ee99,7787,1,true},{0x1ee9a,7788,1,true},{0x1ee9b,7789,1,true},
+	{0x1eea1,7790,1,true},{0x1eea2,7791,1,true},{0x1eea3,7792,1,true},{0x1eea5,7793,1,true},{0x1eea6,7794,1,true},{0x1eea7,7795,1,true},
+	{0x1eea8,7796,1,true},{0x1eea9,7797,1,true},{0x1eeab,7798,1,true},{0x1eeac,7799,1,true},{0x1eead,7800,1,true},{0x1eeae,7801,1,true},
+	{0x1eeaf,7802,1,true},{0x1eeb0,7803,1,true},{0x1eeb1,7804,1,true},{0x1eeb2,7805,1,true},{0x1eeb3,7806,1,true},{0x1eeb4,7807,1,true},
+	{0x1eeb5,7808,1,true},{0x1eeb6,7809,1,true},{0x1eeb7,7810,1,true},{0x1eeb8,7811,1,true},{0x1eeb9,7812,1,true},{0x1eeba,7813,1,true},
+	{0x1eebb,7814,1,true},{0x1f100,7815,2,true},{0x1f101,7817,2,true},{0x1f102,7819,2,true},{0x1f103,7821,2,true},{0x1f104,7823,2,true},
+	{0x1f105,7825,2,true},{0x1f106,7827,2,true},{0x1f107,7829,2,true},{0x1f108,7831,2,true},{0x1f109,7833,2,true},{0x1f10a,7835,2,true},
+	{0x1f110,7837,3,true},{0x1f111,7840,3,true},{0x1f112,7843,3,true},{0x1f113,7846,3,true},{0x1f114,7849,3,true},{0x1f115,7852,3,true},
+	{0x1f116,7855,3,true},{0x1f117,7858,3,true},{0x1f118,7861,3,true},{0x1f119,7864,3,true},{0x1f11a,7867,3,true},{0x1f11b,7870,3,true},
+	{0x1f11c,7873,3,true},{0x1f11d,7876,3,true},{0x1f11e,7879,3,true},{0x1f11f,7882,3,true},{0x1f120,7885,3,true},{0x1f121,7888,3,true},
+	{0x1f122,7891,3,true},{0x1f123,7894,3,true},{0x1f124,7897,3,true},{0x1f125,7900,3,true},{0x1f126,7903,3,true},{0x1f127,7906,3,true},
+	{0x1f128,7909,3,true},{0x1f129,7912,3,true},{0x1f12a,7915,3,true},{0x1f12b,7918,1,true},{0x1f12c,7919,1,true},{0x1f12d,7920,2,true},
+	{0x1f12e,7922,2,true},{0x1f130,7924,1,true},{0x1f131,7925,1,true},{0x1f132,7926,1,true},{0x1f133,7927,1,true},{0x1f134,7928,1,true},
+	{0x1f135,7929,1,true},{0x1f136,7930,1,true},{0x1f137,7931,1,true},{0x1f138,7932,1,true},{0x1f139,7933,1,true},{0x1f13a,7934,1,true},
+	{0x1f13b,7935,1,true},{0x1f13c,7936,1,true},{0x1f13d,7937,1,true},{0x1f13e,7938,1,true},{0x1f13f,7939,1,true},{0x1f140,7940,1,true},
+	{0x1f141,7941,1,true},{0x1f142,7942,1,true},{0x1f143,7943,1,true},{0x1f144,7944,1,true},{0x1f145,7945,1,true},{0x1f146,7946,1,true},
+	{0x1f147,7947,1,true},{0x1f148,7948,1,true},{0x1f149,7949,1,true},{0x1f14a,7950,2,true},{0x1f14b,7952,2,true},{0x1f14c,7954,2,true},
+	{0x1f14d,7956,2,true},{0x1f14e,7958,3,true},{0x1f14f,7961,2,true},{0x1f16a,7963,2,true},{0x1f16b,7965,2,true},{0x1f16c,7967,2,true},
+	{0x1f190,7969,2,true},{0x1f200,7971,2,true},{0x1f201,7973,2,true},{0x1f202,7975,1,true},{0x1f210,7976,1,true},{0x1f211,7977,1,true},
+	{0x1f212,7978,1,true},{0x1f213,7979,1,true},{0x1f214,7980,1,true},{0x1f215,7981,1,true},{0x1f216,7982,1,true},{0x1f217,7983,1,true},
+	{0x1f218,7984,1,true},{0x1f219,7985,1,true},{0x1f21a,7986,1,true},{0x1f21b,7987,1,true},{0x1f21c,7988,1,true},{0x1f21d,7989,1,true},
+	{0x1f21e,7990,1,true},{0x1f21f,7991,1,true},{0x1f220,7992,1,true},{0x1f221,7993,1,true},{0x1f222,7994,1,true},{0x1f223,7995,1,true},
+	{0x1f224,7996,1,true},{0x1f225,7997,1,true},{0x1f226,7998,1,true},{0x1f227,7999,1,true},{0x1f228,8000,1,true},{0x1f229,8001,1,true},
+	{0x1f22a,8002,1,true},{0x1f22b,8003,1,true},{0x1f22c,8004,1,true},{0x1f22d,8005,1,true},{0x1f22e,8006,1,true},{0x1f22f,8007,1,true},
+	{0x1f230,8008,1,true},{0x1f231,8009,1,true},{0x1f232,8010,1,true},{0x1f233,8011,1,true},{0x1f234,8012,1,true},{0x1f235,8013,1,true},
+	{0x1f236,8014,1,true},{0x1f237,8015,1,true},{0x1f238,8016,1,true},{0x1f239,8017,1,true},{0x1f23a,8018,1,true},{0x1f23b,8019,1,true},
+	{0x1f240,8020,3,true},{0x1f241,8023,3,true},{0x1f242,8026,3,true},{0x1f243,8029,3,true},{0x1f244,8032,3,true},{0x1f245,8035,3,true},
+	{0x1f246,8038,3,true},{0x1f247,8041,3,true},{0x1f248,8044,3,true},{0x1f250,8047,1,true},{0x1f251,8048,1,true},{0x1fbf0,8049,1,true},
+	{0x1fbf1,8050,1,true},{0x1fbf2,8051,1,true},{0x1fbf3,8052,1,true},{0x1fbf4,8053,1,true},{0x1fbf5,8054,1,true},{0x1fbf6,8055,1,true},
+	{0x1fbf7,8056,1,true},{0x1fbf8,8057,1,true},{0x1fbf9,8058,1,true},{0x2f800,8059,1,false},{0x2f801,8060,1,false},{0x2f802,8061,1,false},
+	{0x2f803,8062,1,false},{0x2f804,8063,1,false},{0x2f805,8064,1,false},{0x2f806,8065,1,false},{0x2f807,8066,1,false},{0x2f808,8067,1,false},
+	{0x2f809,8068,1,false},{0x2f80a,8069,1,false},{0x2f80b,8070,1,false},{0x2f80c,8071,1,false},{0x2f80d,8072,1,false},{0x2f80e,8073,1,false},
+	{0x2f80f,8074,1,false},{0x2f810,8075,1,false},{0x2f811,8076,1,false},{0x2f812,8077,1,false},{0x2f813,8078,1,false},{0x2f814,8079,1,false},
+	{0x2f815,8080,1,false},{0x2f816,8081,1,false},{0x2f817,8082,1,false},{0x2f818,8083,1,false},{0x2f819,8084,1,false},{0x2f81a,8085,1,false},
+	{0x2f81b,8086,1,false},{0x2f81c,8087,1,false},{0x2f81d,8088,1,false},{0x2f81e,8089,1,false},{0x2f81f,8090,1,false},{0x2f820,8091,1,false},
+	{0x2f821,8092,1,false},{0x2f822,8093,1,false},{0x2f823,8094,1,false},{0x2f824,8095,1,false},{0x2f825,8096,1,false},{0x2f826,8097,1,false},
+	{0x2f827,8098,1,false},{0x2f828,8099,1,false},{0x2f829,8100,1,false},{0x2f82a,8101,1,false},{0x2f82b,8102,1,false},{0x2f82c,8103,1,false},
+	{0x2f82d,8104,1,false},{0x2f82e,8105,1,false},{0x2f82f,8106,1,false},{0x2f830,8107,1,false},{0x2f831,8108,1,false},{0x2f832,8109,1,false},
+	{0x2f833,8110,1,false},{0x2f834,8111,1,false},{0x2f835,8112,1,false},{0x2f836,8113,1,false},{0x2f837,8114,1,false},{0x2f838,8115,1,false},
+	{0x2f839,8116,1,false},{0x2f83a,8117,1,false},{0x2f83b,8118,1,false},{0x2f83c,8119,1,false},{0x2f83d,8120,1,false},{0x2f83e,8121,1,false},
+	{0x2f83f,8122,1,false},{0x2f840,8123,1,false},{0x2f841,8124,1,false},{0x2f842,8125,1,false},{0x2f843,8126,1,false},{0x2f844,8127,1,false},
+	{0x2f845,8128,1,false},{0x2f846,8129,1,false},{0x2f847,8130,1,false},{0x2f848,8131,1,false},{0x2f849,8132,1,false},{0x2f84a,8133,1,false},
+	{0x2f84b,8134,1,false},{0x2f84c,8135,1,false},{0x2f84d,8136,1,false},{0x2f84e,8137,1,false},{0x2f84f,8138,1,false},{0x2f850,8139,1,false},
+	{0x2f851,8140,1,false},{0x2f852,8141,1,false},{0x2f853,8142,1,false},{0x2f854,8143,1,false},{0x2f855,8144,1,false},{0x2f856,8145,1,false},
+	{0x2f857,8146,1,false},{0x2f858,8147,1,false},{0x2f859,8148,1,false},{0x2f85a,8149,1,false},{0x2f85b,8150,1,false},{0x2f85c,8151,1,false},
+	{0x2f85d,8152,1,false},{0x2f85e,8153,1,false},{0x2f85f,8154,1,false},{0x2f860,8155,1,false},{0x2f861,8156,1,false},{0x2f862,8157,1,false},
+	{0x2f863,8158,1,false},{0x2f864,8159,1,false},{0x2f865,8160,1,false},{0x2f866,8161,1,false},{0x2f867,8162,1,false},{0x2f868,8163,1,false},
+	{0x2f869,8164,1,false},{0x2f86a,8165,1,false},{0x2f86b,8166,1,false},{0x2f86c,8167,1,false},{0x2f86d,8168,1,false},{0x2f86e,8169,1,false},
+	{0x2f86f,8170,1,false},{0x2f870,8171,1,false},{0x2f871,8172,1,false},{0x2f872,8173,1,false},{0x2f873,8174,1,false},{0x2f874,8175,1,false},
+	{0x2f875,8176,1,false},{0x2f876,8177,1,false},{0x2f877,8178,1,false},{0x2f878,8179,1,false},{0x2f879,8180,1,false},{0x2f87a,8181,1,false},
+	{0x2f87b,8182,1,false},{0x2f87c,8183,1,false},{0x2f87d,8184,1,false},{0x2f87e,8185,1,false},{0x2f87f,8186,1,false},{0x2f880,8187,1,false},
+	{0x2f881,8188,1,false},{0x2f882,8189,1,false},{0x2f883,8190,1,false},{0x2f884,8191,1,false},{0x2f885,8192,1,false},{0x2f886,8193,1,false},
+	{0x2f887,8194,1,false},{0x2f888,8195,1,false},{0x2f889,8196,1,false},{0x2f88a,8197,1,false},{0x2f88b,8198,1,false},{0x2f88c,8199,1,false},
+	{0x2f88d,8200,1,false},{0x2f88e,8201,1,false},{0x2f88f,8202,1,false},{0x2f890,8203,1,false},{0x2f891,8204,1,false},{0x2f892,8205,1,false},
+	{0x2f893,8206,1,false},{0x2f894,8207,1,false},{0x2f895,8208,1,false},{0x2f896,8209,1,false},{0x2f897,8210,1,false},{0x2f898,8211,1,false},
+	{0x2f899,8212,1,false},{0x2f89a,8213,1,false},{0x2f89b,8214,1,false},{0x2f89c,8215,1,false},{0x2f89d,8216,1,false},{0x2f89e,8217,1,false},
+	{0x2f89f,8218,1,false},{0x2f8a0,8219,1,false},{0x2f8a1,8220,1,false},{0x2f8a2,8221,1,false},{0x2f8a3,8222,1,false},{0x2f8a4,8223,1,false},
+	{0x2f8a5,8224,1,false},{0x2f8a6,8225,1,false},{0x2f8a7,8226,1,false},{0x2f8a8,8227,1,false},{0x2f8a9,8228,1,false},{0x2f8aa,8229,1,false},
+	{0x2f8ab,8230,1,false},{0x2f8ac,8231,1,false},{0x2f8ad,8232,1,false},{0x2f8ae,8233,1,false},{0x2f8af,8234,1,false},{0x2f8b0,8235,1,false},
+	{0x2f8b1,8236,1,false},{0x2f8b2,8237,1,false},{0x2f8b3,8238,1,false},{0x2f8b4,8239,1,false},{0x2f8b5,8240,1,false},{0x2f8b6,8241,1,false},
+	{0x2f8b7,8242,1,false},{0x2f8b8,8243,1,false},{0x2f8b9,8244,1,false},{0x2f8ba,8245,1,false},{0x2f8bb,8246,1,false},{0x2f8bc,8247,1,false},
+	{0x2f8bd,8248,1,false},{0x2f8be,8249,1,false},{0x2f8bf,8250,1,false},{0x2f8c0,8251,1,false},{0x2f8c1,8252,1,false},{0x2f8c2,8253,1,false},
+	{0x2f8c3,8254,1,false},{0x2f8c4,8255,1,false},{0x2f8c5,8256,1,false},{0x2f8c6,8257,1,false},{0x2f8c7,8258,1,false},{0x2f8c8,8259,1,false},
+	{0x2f8c9,8260,1,false},{0x2f8ca,8261,1,false},{0x2f8cb,8262,1,false},{0x2f8cc,8263,1,false},{0x2f8cd,8264,1,false},{0x2f8ce,8265,1,false},
+	{0x2f8cf,8266,1,false},{0x2f8d0,8267,1,false},{0x2f8d1,8268,1,false},{0x2f8d2,8269,1,false},{0x2f8d3,8270,1,false},{0x2f8d4,8271,1,false},
+	{0x2f8d5,8272,1,false},{0x2f8d6,8273,1,false},{0x2f8d7,8274,1,false},{0x2f8d8,8275,1,false},{0x2f8d9,8276,1,false},{0x2f8da,8277,1,false},
+	{0x2f8db,8278,1,false},{0x2f8dc,8279,1,false},{0x2f8dd,8280,1,false},{0x2f8de,8281,1,false},{0x2f8df,8282,1,false},{0x2f8e0,8283,1,false},
+	{0x2f8e1,8284,1,false},{0x2f8e2,8285,1,false},{0x2f8e3,8286,1,false},{0x2f8e4,8287,1,false},{0x2f8e5,8288,1,false},{0x2f8e6,8289,1,false},
+	{0x2f8e7,8290,1,false},{0x2f8e8,8291,1,false},{0x2f8e9,8292,1,false},{0x2f8ea,8293,1,false},{0x2f8eb,8294,1,false},{0x2f8ec,8295,1,false},
+	{0x2f8ed,8296,1,false},{0x2f8ee,8297,1,false},{0x2f8ef,8298,1,false},{0x2f8f0,8299,1,false},{0x2f8f1,8300,1,false},{0x2f8f2,8301,1,false},
+	{0x2f8f3,8302,1,false},{0x2f8f4,8303,1,false},{0x2f8f5,8304,1,false},{0x2f8f6,8305,1,false},{0x2f8f7,8306,1,false},{0x2f8f8,8307,1,false},
+	{0x2f8f9,8308,1,false},{0x2f8fa,8309,1,false},{0x2f8fb,8310,1,false},{0x2f8fc,8311,1,false},{0x2f8fd,8312,1,false},{0x2f8fe,8313,1,false},
+	{0x2f8ff,8314,1,false},{0x2f900,8315,1,false},{0x2f901,8316,1,false},{0x2f902,8317,1,false},{0x2f903,8318,1,false},{0x2f904,8319,1,false},
+	{0x2f905,8320,1,false},{0x2f906,8321,1,false},{0x2f907,8322,1,false},{0x2f908,8323,1,false},{0x2f909,8324,1,false},{0x2f90a,8325,1,false},
+	{0x2f90b,8326,1,false},{0x2f90c,8327,1,false},{0x2f90d,8328,1,false},{0x2f90e,8329,1,false},{0x2f90f,8330,1,false},{0x2f910,8331,1,false},
+	{0x2f911,8332,1,false},{0x2f912,8333,1,false},{0x2f913,8334,1,false},{0x2f914,8335,1,false},{0x2f915,8336,1,false},{0x2f916,8337,1,false},
+	{0x2f917,8338,1,false},{0x2f918,8339,1,false},{0x2f919,8340,1,false},{0x2f91a,8341,1,false},{0x2f91b,8342,1,false},{0x2f91c,8343,1,false},
+	{0x2f91d,8344,1,false},{0x2f91e,8345,1,false},{0x2f91f,8346,1,false},{0x2f920,8347,1,false},{0x2f921,8348,1,false},{0x2f922,8349,1,false},
+	{0x2f923,8350,1,false},{0x2f924,8351,1,false},{0x2f925,8352,1,false},{0x2f926,8353,1,false},{0x2f927,8354,1,false},{0x2f928,8355,1,false},
+	{0x2f929,8356,1,false},{0x2f92a,8357,1,false},{0x2f92b,8358,1,false},{0x2f92c,8359,1,false},{0x2f92d,8360,1,false},{0x2f92e,8361,1,false},
+	{0x2f92f,8362,1,false},{0x2f930,8363,1,false},{0x2f931,8364,1,false},{0x2f932,8365,1,false},{0x2f933,8366,1,false},{0x2f934,8367,1,false},
+	{0x2f935,8368,1,false},{0x2f936,8369,1,false},{0x2f937,8370,1,false},{0x2f938,8371,1,false},{0x2f939,8372,1,false},{0x2f93a,8373,1,false},
+	{0x2f93b,8374,1,false},{0x2f93c,8375,1,false},{0x2f93d,8376,1,false},{0x2f93e,8377,1,false},{0x2f93f,8378,1,false},{0x2f940,8379,1,false},
+	{0x2f941,8380,1,false},{0x2f942,8381,1,false},{0x2f943,8382,1,false},{0x2f944,8383,1,false},{0x2f945,8384,1,false},{0x2f946,8385,1,false},
+	{0x2f947,8386,1,false},{0x2f948,8387,1,false},{0x2f949,8388,1,false},{0x2f94a,8389,1,false},{0x2f94b,8390,1,false},{0x2f94c,8391,1,false},
+	{0x2f94d,8392,1,false},{0x2f94e,8393,1,false},{0x2f94f,8394,1,false},{0x2f950,8395,1,false},{0x2f951,8396,1,false},{0x2f952,8397,1,false},
+	{0x2f953,8398,1,false},{0x2f954,8399,1,false},{0x2f955,8400,1,false},{0x2f956,8401,1,false},{0x2f957,8402,1,false},{0x2f958,8403,1,false},
+	{0x2f959,8404,1,false},{0x2f95a,8405,1,false},{0x2f95b,8406,1,false},{0x2f95c,8407,1,false},{0x2f95d,8408,1,false},{0x2f95e,8409,1,false},
+	{0x2f95f,8410,1,false},{0x2f960,8411,1,false},{0x2f961,8412,1,false},{0x2f962,8413,1,false},{0x2f963,8414,1,false},{0x2f964,8415,1,false},
+	{0x2f965,8416,1,false},{0x2f966,8417,1,false},{0x2f967,8418,1,false},{0x2f968,8419,1,false},{0x2f969,8420,1,false},{0x2f96a,8421,1,false},
+	{0x2f96b,8422,1,false},{0x2f96c,8423,1,false},{0x2f96d,8424,1,false},{0x2f96e,8425,1,false},{0x2f96f,8426,1,false},{0x2f970,8427,1,false},
+	{0x2f971,8428,1,false},{0x2f972,8429,1,false},{0x2f973,8430,1,false},{0x2f974,8431,1,false},{0x2f975,8432,1,false},{0x2f976,8433,1,false},
+	{0x2f977,8434,1,false},{0x2f978,8435,1,false},{0x2f979,8436,1,false},{0x2f97a,8437,1,false},{0x2f97b,8438,1,false},{0x2f97c,8439,1,false},
+	{0x2f97d,8440,1,false},{0x2f97e,8441,1,false},{0x2f97f,8442,1,false},{0x2f980,8443,1,false},{0x2f981,8444,1,false},{0x2f982,8445,1,false},
+	{0x2f983,8446,1,false},{0x2f984,8447,1,false},{0x2f985,8448,1,false},{0x2f986,8449,1,false},{0x2f987,8450,1,false},{0x2f988,8451,1,false},
+	{0x2f989,8452,1,false},{0x2f98a,8453,1,false},{0x2f98b,8454,1,false},{0x2f98c,8455,1,false},{0x2f98d,8456,1,false},{0x2f98e,8457,1,false},
+	{0x2f98f,8458,1,false},{0x2f990,8459,1,false},{0x2f991,8460,1,false},{0x2f992,8461,1,false},{0x2f993,8462,1,false},{0x2f994,8463,1,false},
+	{0x2f995,8464,1,false},{0x2f996,8465,1,false},{0x2f997,8466,1,false},{0x2f998,8467,1,false},{0x2f999,8468,1,false},{0x2f99a,8469,1,false},
+	{0x2f99b,8470,1,false},{0x2f99c,8471,1,false},{0x2f99d,8472,1,false},{0x2f99e,8473,1,false},{0x2f99f,8474,1,false},{0x2f9a0,8475,1,false},
+	{0x2f9a1,8476,1,false},{0x2f9a2,8477,1,false},{0x2f9a3,8478,1,false},{0x2f9a4,8479,1,false},{0x2f9a5,8480,1,false},{0x2f9a6,8481,1,false},
+	{0x2f9a7,8482,1,false},{0x2f9a8,8483,1,false},{0x2f9a9,8484,1,false},{0x2f9aa,8485,1,false},{0x2f9ab,8486,1,false},{0x2f9ac,8487,1,false},
+	{0x2f9ad,8488,1,false},{0x2f9ae,8489,1,false},{0x2f9af,8490,1,false},{0x2f9b0,8491,1,false},{0x2f9b1,8492,1,false},{0x2f9b2,8493,1,false},
+	{0x2f9b3,8494,1,false},{0x2f9b4,8495,1,false},{0x2f9b5,8496,1,false},{0x2f9b6,8497,1,false},{0x2f9b7,8498,1,false},{0x2f9b8,8499,1,false},
+	{0x2f9b9,8500,1,false},{0x2f9ba,8501,1,false},{0x2f9bb,8502,1,false},{0x2f9bc,8503,1,false},{0x2f9bd,8504,1,false},{0x2f9be,8505,1,false},
+	{0x2f9bf,8506,1,false},{0x2f9c0,8507,1,false},{0x2f9c1,8508,1,false},{0x2f9c2,8509,1,false},{0x2f9c3,8510,1,false},{0x2f9c4,8511,1,false},
+	{0x2f9c5,8512,1,false},{0x2f9c6,8513,1,false},{0x2f9c7,8514,1,false},{0x2f9c8,8515,1,false},{0x2f9c9,8516,1,false},{0x2f9ca,8517,1,false},
+	{0x2f9cb,8518,1,false},{0x2f9cc,8519,1,false},{0x2f9cd,8520,1,false},{0x2f9ce,8521,1,false},{0x2f9cf,8522,1,false},{0x2f9d0,8523,1,false},
+	{0x2f9d1,8524,1,false},{0x2f9d2,8525,1,false},{0x2f9d3,8526,1,false},{0x2f9d4,8527,1,false},{0x2f9d5,8528,1,false},{0x2f9d6,8529,1,false},
+	{0x2f9d7,8530,1,false},{0x2f9d8,8531,1,false},{0x2f9d9,8532,1,false},{0x2f9da,8533,1,false},{0x2f9db,8534,1,false},{0x2f9dc,8535,1,false},
+	{0x2f9dd,8536,1,false},{0x2f9de,8537,1,false},{0x2f9df,8538,1,false},{0x2f9e0,8539,1,false},{0x2f9e1,8540,1,false},{0x2f9e2,8541,1,false},
+	{0x2f9e3,8542,1,false},{0x2f9e4,8543,1,false},{0x2f9e5,8544,1,false},{0x2f9e6,8545,1,false},{0x2f9e7,8546,1,false},{0x2f9e8,8547,1,false},
+	{0x2f9e9,8548,1,false},{0x2f9ea,8549,1,false},{0x2f9eb,8550,1,false},{0x2f9ec,8551,1,false},{0x2f9ed,8552,1,false},{0x2f9ee,8553,1,false},
+	{0x2f9ef,8554,1,false},{0x2f9f0,8555,1,false},{0x2f9f1,8556,1,false},{0x2f9f2,8557,1,false},{0x2f9f3,8558,1,false},{0x2f9f4,8559,1,false},
+	{0x2f9f5,8560,1,false},{0x2f9f6,8561,1,false},{0x2f9f7,8562,1,false},{0x2f9f8,8563,1,false},{0x2f9f9,8564,1,false},{0x2f9fa,8565,1,false},
+	{0x2f9fb,8566,1,false},{0x2f9fc,8567,1,false},{0x2f9fd,8568,1,false},{0x2f9fe,8569,1,false},{0x2f9ff,8570,1,false},{0x2fa00,8571,1,false},
+	{0x2fa01,8572,1,false},{0x2fa02,8573,1,false},{0x2fa03,8574,1,false},{0x2fa04,8575,1,false},{0x2fa05,8576,1,false},{0x2fa06,8577,1,false},
+	{0x2fa07,8578,1,false},{0x2fa08,8579,1,false},{0x2fa09,8580,1,false},{0x2fa0a,8581,1,false},{0x2fa0b,8582,1,false},{0x2fa0c,8583,1,false},
+	{0x2fa0d,8584,1,false},{0x2fa0e,8585,1,false},{0x2fa0f,8586,1,false},{0x2fa10,8587,1,false},{0x2fa11,8588,1,false},{0x2fa12,8589,1,false},
+	{0x2fa13,8590,1,false},{0x2fa14,8591,1,false},{0x2fa15,8592,1,false},{0x2fa16,8593,1,false},{0x2fa17,8594,1,false},{0x2fa18,8595,1,false},
+	{0x2fa19,8596,1,false},{0x2fa1a,8597,1,false},{0x2fa1b,8598,1,false},{0x2fa1c,8599,1,false},{0x2fa1d,8600,1,false},
+};
+
+constexpr char32_t decomposition_data[8601] = {
+	0x20,0x20,0x308,0x61,0x20,0x304,0x32,0x33,0x20,0x301,0x3bc,0x20,0x327,0x31,0x6f,0x31,
+	0x2044,0x34,0x31,0x2044,0x32,0x33,0x2044,0x34,0x41,0x300,0x41,0x301,0x41,0x302,0x41,0x303,
+	0x41,0x308,0x41,0x30a,0x43,0x327,0x45,0x300,0x45,0x301,0x45,0x302,0x45,0x308,0x49,0x300,
+	0x49,0x301,0x49,0x302,0x49,0x308,0x4e,0x303,0x4f,0x300,0x4f,0x301,0x4f,0x302,0x4f,0x303,
+	0x4f,0x308,0x55,0x300,0x55,0x301,0x55,0x302,0x55,0x308,0x59,0x301,0x61,0x300,0x61,0x301,
+	0x61,0x302,0x61,0x303,0x61,0x308,0x61,0x30a,0x63,0x327,0x65,0x300,0x65,0x301,0x65,0x302,
+	0x65,0x308,0x69,0x300,0x69,0x301,0x69,0x302,0x69,0x308,0x6e,0x303,0x6f,0x300,0x6f,0x301,
+	0x6f,0x302,0x6f,0x303,0x6f,0x308,0x75,0x300,0x75,0x301,0x75,0x302,0x75,0x308,0x79,0x301,
+	0x79,0x308,0x41,0x304,0x61,0x304,0x41,0x306,0x61,0x306,0x41,0x328,0x61,0x328,0x43,0x301,
+	0x63,0x301,0x43,0x302,0x63,0x302,0x43,0x307,0x63,0x307,0x43,0x30c,0x63,0x30c,0x44,0x30c,
+	0x64,0x30c,0x45,0x304,0x65,0x304,0x45,0x306,0x65,0x306,0x45,0x307,0x65,0x307,0x45,0x328,
+	0x65,0x328,0x45,0x30c,0x65,0x30c,0x47,0x302,0x67,0x302,0x47,0x306,0x67,0x306,0x47,0x307,
+	0x67,0x307,0x47,0x327,0x67,0x327,0x48,0x302,0x68,0x302,0x49,0x303,0x69,0x303,0x49,0x304,
+	0x69,0x304,0x49,0x306,0x69,0x306,0x49,0x328,0x69,0x328,0x49,0x307,0x49,0x4a,0x69,0x6a,
+	0x4a,0x302,0x6a,0x302,0x4b,0x327,0x6b,0x327,0x4c,0x301,0x6c,0x301,0x4c,0x327,0x6c,0x327,
+	0x4c,0x30c,0x6c,0x30c,0x4c,0xb7,0x6c,0xb7,0x4e,0x301,0x6e,0x301,0x4e,0x327,0x6e,0x327,
+	0x4e,0x30c,0x6e,0x30c,0x2bc,0x6e,0x4f,0x304,0x6f,0x304,0x4f,0x306,0x6f,0x306,0x4f,0x30b,
+	0x6f,0x30b,0x52,0x301,0x72,0x301,0x52,0x327,0x72,0x327,0x52,0x30c,0x72,0x30c,0x53,0x301,
+	0x73,0x301,0x53,0x302,0x73,0x302,0x53,0x327,0x73,0x327,0x53,0x30c,0x73,0x30c,0x54,0x327,
+	0x74,0x327,0x54,0x30c,0x74,0x30c,0x55,0x303,0x75,0x303,0x55,0x304,0x75,0x304,0x55,0x306,
+	0x75,0x306,0x55,0x30a,0x75,0x30a,0x55,0x30b,0x75,0x30b,0x55,0x328,0x75,0x328,0x57,0x302,
+	0x77,0x302,0x59,0x302,0x79,0x302,0x59,0x308,0x5a,0x301,0x7a,0x301,0x5a,0x307,0x7a,0x307,
+	0x5a,0x30c,0x7a,0x30c,0x73,0x4f,0x31b,0x6f,0x31b,0x55,0x31b,0x75,0x31b,0x44,0x17d,0x44,
+	0x17e,0x64,0x17e,0x4c,0x4a,0x4c,0x6a,0x6c,0x6a,0x4e,0x4a,0x4e,0x6a,0x6e,0x6a,0x41,
+	0x30c,0x61,0x30c,0x49,0x30c,0x69,0x30c,0x4f,0x30c,0x6f,0x30c,0x55,0x30c,0x75,0x30c,0xdc,
+	0x304,0xfc,0x304,0xdc,0x301,0xfc,0x301,0xdc,0x30c,0xfc,0x30c,0xdc,0x300,0xfc,0x300,0xc4,
+	0x304,0xe4,0x304,0x226,0x304,0x227,0x304,0xc6,0x304,0xe6,0x304,0x47,0x30c,0x67,0x30c,0x4b,
+	0x30c,0x6b,0x30c,0x4f,0x328,0x6f,0x328,0x1ea,0x304,0x1eb,0x304,0x1b7,0x30c,0x292,0x30c,0x6a,
+	0x30c,0x44,0x5a,0x44,0x7a,0x64,0x7a,0x47,0x301,0x67,0x301,0x4e,0x300,0x6e,0x300,0xc5,
+	0x301,0xe5,0x301,0xc6,0x301,0xe6,0x301,0xd8,0x301,0xf8,0x301,0x41,0x30f,0x61,0x30f,0x41,
+	0x311,0x61,0x311,0x45,0x30f,0x65,0x30f,0x45,0x311,0x65,0x311,0x49,0x30f,0x69,0x30f,0x49,
+	0x311,0x69,0x311,0x4f,0x30f,0x6f,0x30f,0x4f,0x311,0x6f,0x311,0x52,0x30f,0x72,0x30f,0x52,
+	0x311,0x72,0x311,0x55,0x30f,0x75,0x30f,0x55,0x311,0x75,0x311,0x53,0x326,0x73,0x326,0x54,
+	0x326,0x74,0x326,0x48,0x30c,0x68,0x30c,0x41,0x307,0x61,0x307,0x45,0x327,0x65,0x327,0xd6,
+	0x304,0xf6,0x304,0xd5,0x304,0xf5,0x304,0x4f,0x307,0x6f,0x307,0x22e,0x304,0x22f,0x304,0x59,
+	0x304,0x79,0x304,0x68,0x266,0x6a,0x72,0x279,0x27b,0x281,0x77,0x79,0x20,0x306,0x20,0x307,
+	0x20,0x30a,0x20,0x328,0x20,0x303,0x20,0x30b,0x263,0x6c,0x73,0x78,0x295,0x300,0x301,0x313,
+	0x308,0x301,0x2b9,0x20,0x345,0x3b,0x20,0x301,0xa8,0x301,0x391,0x301,0xb7,0x395,0x301,0x397,
+	0x301,0x399,0x301,0x39f,0x301,0x3a5,0x301,0x3a9,0x301,0x3ca,0x301,0x399,0x308,0x3a5,0x308,0x3b1,
+	0x301,0x3b5,0x301,0x3b7,0x301,0x3b9,0x301,0x3cb,0x301,0x3b9,0x308,0x3c5,0x308,0x3bf,0x301,0x3c5,
+	0x301,0x3c9,0x301,0x3b2,0x3b8,0x3a5,0x3d2,0x301,0x3d2,0x308,0x3c6,0x3c0,0x3ba,0x3c1,0x3c2,0x398,
+	0x3b5,0x3a3,0x415,0x300,0x415,0x308,0x413,0x301,0x406,0x308,0x41a,0x301,0x418,0x300,0x423,0x306,
+	0x418,0x306,0x438,0x306,0x435,0x300,0x435,0x308,0x433,0x301,0x456,0x308,0x43a,0x301,0x438,0x300,
+	0x443,0x306,0x474,0x30f,0x475,0x30f,0x416,0x306,0x436,0x306,0x410,0x306,0x430,0x306,0x410,0x308,
+	0x430,0x308,0x415,0x306,0x435,0x306,0x4d8,0x308,0x4d9,0x308,0x416,0x308,0x436,0x308,0x417,0x308,
+	0x437,0x308,0x418,0x304,0x438,0x304,0x418,0x308,0x438,0x308,0x41e,0x308,0x43e,0x308,0x4e8,0x308,
+	0x4e9,0x308,0x42d,0x308,0x44d,0x308,0x423,0x304,0x443,0x304,0x423,0x308,0x443,0x308,0x423,0x30b,
+	0x443,0x30b,0x427,0x308,0x447,0x308,0x42b,0x308,0x44b,0x308,0x565,0x582,0x627,0x653,0x627,0x654,
+	0x648,0x654,0x627,0x655,0x64a,0x654,0x627,0x674,0x648,0x674,0x6c7,0x674,0x64a,0x674,0x6d5,0x654,
+	0x6c1,0x654,0x6d2,0x654,0x928,0x93c,0x930,0x93c,0x933,0x93c,0x915,0x93c,0x916,0x93c,0x917,0x93c,
+	0x91c,0x93c,0x921,0x93c,0x922,0x93c,0x92b,0x93c,0x92f,0x93c,0x9c7,0x9be,0x9c7,0x9d7,0x9a1,0x9bc,
+	0x9a2,0x9bc,0x9af,0x9bc,0xa32,0xa3c,0xa38,0xa3c,0xa16,0xa3c,0xa17,0xa3c,0xa1c,0xa3c,0xa2b,0xa3c,
+	0xb47,0xb56,0xb47,0xb3e,0xb47,0xb57,0xb21,0xb3c,0xb22,0xb3c,0xb92,0xbd7,0xbc6,0xbbe,0xbc7,0xbbe,
+	0xbc6,0xbd7,0xc46,0xc56,0xcbf,0xcd5,0xcc6,0xcd5,0xcc6,0xcd6,0xcc6,0xcc2,0xcca,0xcd5,0xd46,0xd3e,
+	0xd47,0xd3e,0xd46,0xd57,0xdd9,0xdca,0xdd9,0xdcf,0xddc,0xdca,0xdd9,0xddf,0xe4d,0xe32,0xecd,0xeb2,
+	0xeab,0xe99,0xeab,0xea1,0xf0b,0xf42,0xfb7,0xf4c,0xfb7,0xf51,0xfb7,0xf56,0xfb7,0xf5b,0xfb7,0xf40,
+	0xfb5,0xf71,0xf72,0xf71,0xf74,0xfb2,0xf80,0xfb2,0xf81,0xfb3,0xf80,0xfb3,0xf81,0xf71,0xf80,0xf92,
+	0xfb7,0xf9c,0xfb7,0xfa1,0xfb7,0xfa6,0xfb7,0xfab,0xfb7,0xf90,0xfb5,0x1025,0x102e,0x10dc,0x1b05,0x1b35,
+	0x1b07,0x1b35,0x1b09,0x1b35,0x1b0b,0x1b35,0x1b0d,0x1b35,0x1b11,0x1b35,0x1b3a,0x1b35,0x1b3c,0x1b35,0x1b3e,0x1b35,
+	0x1b3f,0x1b35,0x1b42,0x1b35,0x41,0xc6,0x42,0x44,0x45,0x18e,0x47,0x48,0x49,0x4a,0x4b,0x4c,
+	0x4d,0x4e,0x4f,0x222,0x50,0x52,0x54,0x55,0x57,0x61,0x250,0x251,0x1d02,0x62,0x64,0x65,
+	0x259,0x25b,0x25c,0x67,0x6b,0x6d,0x14b,0x6f,0x254,0x1d16,0x1d17,0x70,0x74,0x75,0x1d1d,0x26f,
+	0x76,0x1d25,0x3b2,0x3b3,0x3b4,0x3c6,0x3c7,0x69,0x72,0x75,0x76,0x3b2,0x3b3,0x3c1,0x3c6,0x3c7,
+	0x43d,0x252,0x63,0x255,0xf0,0x25c,0x66,0x25f,0x261,0x265,0x268,0x269,0x26a,0x1d7b,0x29d,0x26d,
+	0x1d85,0x29f,0x271,0x270,0x272,0x273,0x274,0x275,0x278,0x282,0x283,0x1ab,0x289,0x28a,0x1d1c,0x28b,
+	0x28c,0x7a,0x290,0x291,0x292,0x3b8,0x41,0x325,0x61,0x325,0x42,0x307,0x62,0x307,0x42,0x323,
+	0x62,0x323,0x42,0x331,0x62,0x331,0xc7,0x301,0xe7,0x301,0x44,0x307,0x64,0x307,0x44,0x323,
+	0x64,0x323,0x44,0x331,0x64,0x331,0x44,0x327,0x64,0x327,0x44,0x32d,0x64,0x32d,0x112,0x300,
+	0x113,0x300,0x112,0x301,0x113,0x301,0x45,0x32d,0x65,0x32d,0x45,0x330,0x65,0x330,0x228,0x306,
+	0x229,0x306,0x46,0x307,0x66,0x307,0x47,0x304,0x67,0x304,0x48,0x307,0x68,0x307,0x48,0x323,
+	0x68,0x323,0x48,0x308,0x68,0x308,0x48,0x327,0x68,0x327,0x48,0x32e,0x68,0x32e,0x49,0x330,
+	0x69,0x330,0xcf,0x301,0xef,0x301,0x4b,0x301,0x6b,0x301,0x4b,0x323,0x6b,0x323,0x4b,0x331,
+	0x6b,0x331,0x4c,0x323,0x6c,0x323,0x1e36,0x304,0x1e37,0x304,0x4c,0x331,0x6c,0x331,0x4c,0x32d,
+	0x6c,0x32d,0x4d,0x301,0x6d,0x301,0x4d,0x307,0x6d,0x307,0x4d,0x323,0x6d,0x323,0x4e,0x307,
+	0x6e,0x307,0x4e,0x323,0x6e,0x323,0x4e,0x331,0x6e,0x331,0x4e,0x32d,0x6e,0x32d,0xd5,0x301,
+	0xf5,0x301,0xd5,0x308,0xf5,0x308,0x14c,0x300,0x14d,0x300,0x14c,0x301,0x14d,0x301,0x50,0x301,
+	0x70,0x301,0x50,0x307,0x70,0x307,0x52,0x307,0x72,0x307,0x52,0x323,0x72,0x323,0x1e5a,0x304,
+	0x1e5b,0x304,0x52,0x331,0x72,0x331,0x53,0x307,0x73,0x307,0x53,0x323,0x73,0x323,0x15a,0x307,
+	0x15b,0x307,0x160,0x307,0x161,0x307,0x1e62,0x307,0x1e63,0x307,0x54,0x307,0x74,0x307,0x54,0x323,
+	0x74,0x323,0x54,0x331,0x74,0x331,0x54,0x32d,0x74,0x32d,0x55,0x324,0x75,0x324,0x55,0x330,
+	0x75,0x330,0x55,0x32d,0x75,0x32d,0x168,0x301,0x169,0x301,0x16a,0x308,0x16b,0x308,0x56,0x303,
+	0x76,0x303,0x56,0x323,0x76,0x323,0x57,0x300,0x77,0x300,0x57,0x301,0x77,0x301,0x57,0x308,
+	0x77,0x308,0x57,0x307,0x77,0x307,0x57,0x323,0x77,0x323,0x58,0x307,0x78,0x307,0x58,0x308,
+	0x78,0x308,0x59,0x307,0x79,0x307,0x5a,0x302,0x7a,0x302,0x5a,0x323,0x7a,0x323,0x5a,0x331,
+	0x7a,0x331,0x68,0x331,0x74,0x308,0x77,0x30a,0x79,0x30a,0x61,0x2be,0x17f,0x307,0x41,0x323,
+	0x61,0x323,0x41,0x309,0x61,0x309,0xc2,0x301,0xe2,0x301,0xc2,0x300,0xe2,0x300,0xc2,0x309,
+	0xe2,0x309,0xc2,0x303,0xe2,0x303,0x1ea0,0x302,0x1ea1,0x302,0x102,0x301,0x103,0x301,0x102,0x300,
+	0x103,0x300,0x102,0x309,0x103,0x309,0x102,0x303,0x103,0x303,0x1ea0,0x306,0x1ea1,0x306,0x45,0x323,
+	0x65,0x323,0x45,0x309,0x65,0x309,0x45,0x303,0x65,0x303,0xca,0x301,0xea,0x301,0xca,0x300,
+	0xea,0x300,0xca,0x309,0xea,0x309,0xca,0x303,0xea,0x303,0x1eb8,0x302,0x1eb9,0x302,0x49,0x309,
+	0x69,0x309,0x49,0x323,0x69,0x323,0x4f,0x323,0x6f,0x323,0x4f,0x309,0x6f,0x309,0xd4,0x301,
+	0xf4,0x301,0xd4,0x300,0xf4,0x300,0xd4,0x309,0xf4,0x309,0xd4,0x303,0xf4,0x303,0x1ecc,0x302,
+	0x1ecd,0x302,0x1a0,0x301,0x1a1,0x301,0x1a0,0x300,0x1a1,0x300,0x1a0,0x309,0x1a1,0x309,0x1a0,0x303,
+	0x1a1,0x303,0x1a0,0x323,0x1a1,0x323,0x55,0x323,0x75,0x323,0x55,0x309,0x75,0x309,0x1af,0x301,
+	0x1b0,0x301,0x1af,0x300,0x1b0,0x300,0x1af,0x309,0x1b0,0x309,0x1af,0x303,0x1b0,0x303,0x1af,0x323,
+	0x1b0,0x323,0x59,0x300,0x79,0x300,0x59,0x323,0x79,0x323,0x59,0x309,0x79,0x309,0x59,0x303,
+	0x79,0x303,0x3b1,0x313,0x3b1,0x314,0x1f00,0x300,0x1f01,0x300,0x1f00,0x301,0x1f01,0x301,0x1f00,0x342,
+	0x1f01,0x342,0x391,0x313,0x391,0x314,0x1f08,0x300,0x1f09,0x300,0x1f08,0x301,0x1f09,0x301,0x1f08,0x342,
+	0x1f09,0x342,0x3b5,0x313,0x3b5,0x314,0x1f10,0x300,0x1f11,0x300,0x1f10,0x301,0x1f11,0x301,0x395,0x313,
+	0x395,0x314,0x1f18,0x300,0x1f19,0x300,0x1f18,0x301,0x1f19,0x301,0x3b7,0x313,0x3b7,0x314,0x1f20,0x300,
+	0x1f21,0x300,0x1f20,0x301,0x1f21,0x301,0x1f20,0x342,0x1f21,0x342,0x397,0x313,0x397,0x314,0x1f28,0x300,
+	0x1f29,0x300,0x1f28,0x301,0x1f29,0x301,0x1f28,0x342,0x1f29,0x342,0x3b9,0x313,0x3b9,0x314,0x1f30,0x300,
+	0x1f31,0x300,0x1f30,0x301,0x1f31,0x301,0x1f30,0x342,0x1f31,0x342,0x399,0x313,0x399,0x314,0x1f38,0x300,
+	0x1f39,0x300,0x1f38,0x301,0x1f39,0x301,0x1f38,0x342,0x1f39,0x342,0x3bf,0x313,0x3bf,0x314,0x1f40,0x300,
+	0x1f41,0x300,0x1f40,0x301,0x1f41,0x301,0x39f,0x313,0x39f,0x314,0x1f48,0x300,0x1f49,0x300,0x1f48,0x301,
+	0x1f49,0x301,0x3c5,0x313,0x3c5,0x314,0x1f50,0x300,0x1f51,0x300,0x1f50,0x301,0x1f51,0x301,0x1f50,0x342,
+	0x1f51,0x342,0x3a5,0x314,0x1f59,0x300,0x1f59,0x301,0x1f59,0x342,0x3c9,0x313,0x3c9,0x314,0x1f60,0x300,
+	0x1f61,0x300,0x1f60,0x301,0x1f61,0x301,0x1f60,0x342,0x1f61,0x342,0x3a9,0x313,0x3a9,0x314,0x1f68,0x300,
+	0x1f69,0x300,0x1f68,0x301,0x1f69,0x301,0x1f68,0x342,0x1f69,0x342,0x3b1,0x300,0x3ac,0x3b5,0x300,0x3ad,
+	0x3b7,0x300,0x3ae,0x3b9,0x300,0x3af,0x3bf,0x300,0x3cc,0x3c5,0x300,0x3cd,0x3c9,0x300,0x3ce,0x1f00,
+	0x345,0x1f01,0x345,0x1f02,0x345,0x1f03,0x345,0x1f04,0x345,0x1f05,0x345,0x1f06,0x345,0x1f07,0x345,0x1f08,
+	0x345,0x1f09,0x345,0x1f0a,0x345,0x1f0b,0x345,0x1f0c,0x345,0x1f0d,0x345,0x1f0e,0x345,0x1f0f,0x345,0x1f20,
+	0x345,0x1f21,0x345,0x1f22,0x345,0x1f23,0x345,0x1f24,0x345,0x1f25,0x345,0x1f26,0x345,0x1f27,0x345,0x1f28,
+	0x345,0x1f29,0x345,0x1f2a,0x345,0x1f2b,0x345,0x1f2c,0x345,0x1f2d,0x345,0x1f2e,0x345,0x1f2f,0x345,0x1f60,
+	0x345,0x1f61,0x345,0x1f62,0x345,0x1f63,0x345,0x1f64,0x345,0x1f65,0x345,0x1f66,0x345,0x1f67,0x345,0x1f68,
+	0x345,0x1f69,0x345,0x1f6a,0x345,0x1f6b,0x345,0x1f6c,0x345,0x1f6d,0x345,0x1f6e,0x345,0x1f6f,0x345,0x3b1,
+	0x306,0x3b1,0x304,0x1f70,0x345,0x3b1,0x345,0x3ac,0x345,0x3b1,0x342,0x1fb6,0x345,0x391,0x306,0x391,
+	0x304,0x391,0x300,0x386,0x391,0x345,0x20,0x313,0x3b9,0x20,0x313,0x20,0x342,0xa8,0x342,0x1f74,
+	0x345,0x3b7,0x345,0x3ae,0x345,0x3b7,0x342,0x1fc6,0x345,0x395,0x300,0x388,0x397,0x300,0x389,0x397,
+	0x345,0x1fbf,0x300,0x1fbf,0x301,0x1fbf,0x342,0x3b9,0x306,0x3b9,0x304,0x3ca,0x300,0x390,0x3b9,0x342,
+	0x3ca,0x342,0x399,0x306,0x399,0x304,0x399,0x300,0x38a,0x1ffe,0x300,0x1ffe,0x301,0x1ffe,0x342,0x3c5,
+	0x306,0x3c5,0x304,0x3cb,0x300,0x3b0,0x3c1,0x313,0x3c1,0x314,0x3c5,0x342,0x3cb,0x342,0x3a5,0x306,
+	0x3a5,0x304,0x3a5,0x300,0x38e,0x3a1,0x314,0xa8,0x300,0x385,0x60,0x1f7c,0x345,0x3c9,0x345,0x3ce,
+	0x345,0x3c9,0x342,0x1ff6,0x345,0x39f,0x300,0x38c,0x3a9,0x300,0x38f,0x3a9,0x345,0xb4,0x20,0x314,
+	0x2002,0x2003,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x2010,0x20,0x333,0x2e,0x2e,
+	0x2e,0x2e,0x2e,0x2e,0x20,0x2032,0x2032,0x2032,0x2032,0x2032,0x2035,0x2035,0x2035,0x2035,0x2035,0x21,
+	0x21,0x20,0x305,0x3f,0x3f,0x3f,0x21,0x21,0x3f,0x2032,0x2032,0x2032,0x2032,0x20,0x30,0x69,
+	0x34,0x35,0x36,0x37,0x38,0x39,0x2b,0x2212,0x3d,0x28,0x29,0x6e,0x30,0x31,0x32,0x33,
+	0x34,0x35,0x36,0x37,0x38,0x39,0x2b,0x2212,0x3d,0x28,0x29,0x61,0x65,0x6f,0x78,0x259,
+	0x68,0x6b,0x6c,0x6d,0x6e,0x70,0x73,0x74,0x52,0x73,0x61,0x2f,0x63,0x61,0x2f,0x73,
+	0x43,0xb0,0x43,0x63,0x2f,0x6f,0x63,0x2f,0x75,0x190,0xb0,0x46,0x67,0x48,0x48,0x48,
+	0x68,0x127,0x49,0x49,0x4c,0x6c,0x4e,0x4e,0x6f,0x50,0x51,0x52,0x52,0x52,0x53,0x4d,
+	0x54,0x45,0x4c,0x54,0x4d,0x5a,0x3a9,0x5a,0x4b,0xc5,0x42,0x43,0x65,0x45,0x46,0x4d,
+	0x6f,0x5d0,0x5d1,0x5d2,0x5d3,0x69,0x46,0x41,0x58,0x3c0,0x3b3,0x393,0x3a0,0x2211,0x44,0x64,
+	0x65,0x69,0x6a,0x31,0x2044,0x37,0x31,0x2044,0x39,0x31,0x2044,0x31,0x30,0x31,0x2044,0x33,
+	0x32,0x2044,0x33,0x31,0x2044,0x35,0x32,0x2044,0x35,0x33,0x2044,0x35,0x34,0x2044,0x35,0x31,
+	0x2044,0x36,0x35,0x2044,0x36,0x31,0x2044,0x38,0x33,0x2044,0x38,0x35,0x2044,0x38,0x37,0x2044,
+	0x38,0x31,0x2044,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x56,0x56,0x56,0x49,0x56,0x49,
+	0x49,0x56,0x49,0x49,0x49,0x49,0x58,0x58,0x58,0x49,0x58,0x49,0x49,0x4c,0x43,0x44,
+	0x4d,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x76,0x76,0x76,0x69,0x76,0x69,0x69,0x76,
+	0x69,0x69,0x69,0x69,0x78,0x78,0x78,0x69,0x78,0x69,0x69,0x6c,0x63,0x64,0x6d,0x30,
+	0x2044,0x33,0x2190,0x338,0x2192,0x338,0x2194,0x338,0x21d0,0x338,0x21d4,0x338,0x21d2,0x338,0x2203,0x338,
+	0x2208,0x338,0x220b,0x338,0x2223,0x338,0x2225,0x338,0x222b,0x222b,0x222b,0x222b,0x222b,0x222e,0x222e,0x222e,
+	0x222e,0x222e,0x223c,0x338,0x2243,0x338,0x2245,0x338,0x2248,0x338,0x3d,0x338,0x2261,0x338,0x224d,0x338,
+	0x3c,0x338,0x3e,0x338,0x2264,0x338,0x2265,0x338,0x2272,0x338,0x2273,0x338,0x2276,0x338,0x2277,0x338,
+	0x227a,0x338,0x227b,0x338,0x2282,0x338,0x2283,0x338,0x2286,0x338,0x2287,0x338,0x22a2,0x338,0x22a8,0x338,
+	0x22a9,0x338,0x22ab,0x338,0x227c,0x338,0x227d,0x338,0x2291,0x338,0x2292,0x338,0x22b2,0x338,0x22b3,0x338,
+	0x22b4,0x338,0x22b5,0x338,0x3008,0x3009,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x31,
+	0x30,0x31,0x31,0x31,0x32,0x31,0x33,0x31,0x34,0x31,0x35,0x31,0x36,0x31,0x37,0x31,
+	0x38,0x31,0x39,0x32,0x30,0x28,0x31,0x29,0x28,0x32,0x29,0x28,0x33,0x29,0x28,0x34,
+	0x29,0x28,0x35,0x29,0x28,0x36,0x29,0x28,0x37,0x29,0x28,0x38,0x29,0x28,0x39,0x29,
+	0x28,0x31,0x30,0x29,0x28,0x31,0x31,0x29,0x28,0x31,0x32,0x29,0x28,0x31,0x33,0x29,
+	0x28,0x31,0x34,0x29,0x28,0x31,0x35,0x29,0x28,0x31,0x36,0x29,0x28,0x31,0x37,0x29,
+	0x28,0x31,0x38,0x29,0x28,0x31,0x39,0x29,0x28,0x32,0x30,0x29,0x31,0x2e,0x32,0x2e,
+	0x33,0x2e,0x34,0x2e,0x35,0x2e,0x36,0x2e,0x37,0x2e,0x38,0x2e,0x39,0x2e,0x31,0x30,
+	0x2e,0x31,0x31,0x2e,0x31,0x32,0x2e,0x31,0x33,0x2e,0x31,0x34,0x2e,0x31,0x35,0x2e,
+	0x31,0x36,0x2e,0x31,0x37,0x2e,0x31,0x38,0x2e,0x31,0x39,0x2e,0x32,0x30,0x2e,0x28,
+	0x61,0x29,0x28,0x62,0x29,0x28,0x63,0x29,0x28,0x64,0x29,0x28,0x65,0x29,0x28,0x66,
+	0x29,0x28,0x67,0x29,0x28,0x68,0x29,0x28,0x69,0x29,0x28,0x6a,0x29,0x28,0x6b,0x29,
+	0x28,0x6c,0x29,0x28,0x6d,0x29,0x28,0x6e,0x29,0x28,0x6f,0x29,0x28,0x70,0x29,0x28,
+	0x71,0x29,0x28,0x72,0x29,0x28,0x73,0x29,0x28,0x74,0x29,0x28,0x75,0x29,0x28,0x76,
+	0x29,0x28,0x77,0x29,0x28,0x78,0x29,0x28,0x79,0x29,0x28,0x7a,0x29,0x41,0x42,0x43,
+	0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,
+	0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,
+	0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,
+	0x7a,0x30,0x222b,0x222b,0x222b,0x222b,0x3a,0x3a,0x3d,0x3d,0x3d,0x3d,0x3d,0x3d,0x2add,0x338,
+	0x6a,0x56,0x2d61,0x6bcd,0x9f9f,0x4e00,0x4e28,0x4e36,0x4e3f,0x4e59,0x4e85,0x4e8c,0x4ea0,0x4eba,0x513f,0x5165,
+	0x516b,0x5182,0x5196,0x51ab,0x51e0,0x51f5,0x5200,0x529b,0x52f9,0x5315,0x531a,0x5338,0x5341,0x535c,0x5369,0x5382,
+	0x53b6,0x53c8,0x53e3,0x56d7,0x571f,0x58eb,0x5902,0x590a,0x5915,0x5927,0x5973,0x5b50,0x5b80,0x5bf8,0x5c0f,0x5c22,
+	0x5c38,0x5c6e,0x5c71,0x5ddb,0x5de5,0x5df1,0x5dfe,0x5e72,0x5e7a,0x5e7f,0x5ef4,0x5efe,0x5f0b,0x5f13,0x5f50,0x5f61,
+	0x5f73,0x5fc3,0x6208,0x6236,0x624b,0x652f,0x6534,0x6587,0x6597,0x65a4,0x65b9,0x65e0,0x65e5,0x66f0,0x6708,0x6728,
+	0x6b20,0x6b62,0x6b79,0x6bb3,0x6bcb,0x6bd4,0x6bdb,0x6c0f,0x6c14,0x6c34,0x706b,0x722a,0x7236,0x723b,0x723f,0x7247,
+	0x7259,0x725b,0x72ac,0x7384,0x7389,0x74dc,0x74e6,0x7518,0x751f,0x7528,0x7530,0x758b,0x7592,0x7676,0x767d,0x76ae,
+	0x76bf,0x76ee,0x77db,0x77e2,0x77f3,0x793a,0x79b8,0x79be,0x7a74,0x7acb,0x7af9,0x7c73,0x7cf8,0x7f36,0x7f51,0x7f8a,
+	0x7fbd,0x8001,0x800c,0x8012,0x8033,0x807f,0x8089,0x81e3,0x81ea,0x81f3,0x81fc,0x820c,0x821b,0x821f,0x826e,0x8272,
+	0x8278,0x864d,0x866b,0x8840,0x884c,0x8863,0x897e,0x898b,0x89d2,0x8a00,0x8c37,0x8c46,0x8c55,0x8c78,0x8c9d,0x8d64,
+	0x8d70,0x8db3,0x8eab,0x8eca,0x8f9b,0x8fb0,0x8fb5,0x9091,0x9149,0x91c6,0x91cc,0x91d1,0x9577,0x9580,0x961c,0x96b6,
+	0x96b9,0x96e8,0x9751,0x975e,0x9762,0x9769,0x97cb,0x97ed,0x97f3,0x9801,0x98a8,0x98db,0x98df,0x9996,0x9999,0x99ac,
+	0x9aa8,0x9ad8,0x9adf,0x9b25,0x9b2f,0x9b32,0x9b3c,0x9b5a,0x9ce5,0x9e75,0x9e7f,0x9ea5,0x9ebb,0x9ec3,0x9ecd,0x9ed1,
+	0x9ef9,0x9efd,0x9f0e,0x9f13,0x9f20,0x9f3b,0x9f4a,0x9f52,0x9f8d,0x9f9c,0x9fa0,0x20,0x3012,0x5341,0x5344,0x5345,
+	0x304b,0x3099,0x304d,0x3099,0x304f,0x3099,0x3051,0x3099,0x3053,0x3099,0x3055,0x3099,0x3057,0x3099,0x3059,0x3099,
+	0x305b,0x3099,0x305d,0x3099,0x305f,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,0x3099,0x3068,0x3099,0x306f,0x3099,
+	0x306f,0x309a,0x3072,0x3099,0x3072,0x309a,0x3075,0x3099,0x3075,0x309a,0x3078,0x3099,0x3078,0x309a,0x307b,0x3099,
+	0x307b,0x309a,0x3046,0x3099,0x20,0x3099,0x20,0x309a,0x309d,0x3099,0x3088,0x308a,0x30ab,0x3099,0x30ad,0x3099,
+	0x30af,0x3099,0x30b1,0x3099,0x30b3,0x3099,0x30b5,0x3099,0x30b7,0x3099,0x30b9,0x3099,0x30bb,0x3099,0x30bd,0x3099,
+	0x30bf,0x3099,0x30c1,0x3099,0x30c4,0x3099,0x30c6,0x3099,0x30c8,0x3099,0x30cf,0x3099,0x30cf,0x309a,0x30d2,0x3099,
+	0x30d2,0x309a,0x30d5,0x3099,0x30d5,0x309a,0x30d8,0x3099,0x30d8,0x309a,0x30db,0x3099,0x30db,0x309a,0x30a6,0x3099,
+	0x30ef,0x3099,0x30f0,0x3099,0x30f1,0x3099,0x30f2,0x3099,0x30fd,0x3099,0x30b3,0x30c8,0x1100,0x1101,0x11aa,0x1102,
+	0x11ac,0x11ad,0x1103,0x1104,0x1105,0x11b0,0x11b1,0x11b2,0x11b3,0x11b4,0x11b5,0x111a,0x1106,0x1107,0x1108,0x1121,
+	0x1109,0x110a,0x110b,0x110c,0x110d,0x110e,0x110f,0x1110,0x1111,0x1112,0x1161,0x1162,0x1163,0x1164,0x1165,0x1166,
+	0x1167,0x1168,0x1169,0x116a,0x116b,0x116c,0x116d,0x116e,0x116f,0x1170,0x1171,0x1172,0x1173,0x1174,0x1175,0x1160,
+	0x1114,0x1115,0x11c7,0x11c8,0x11cc,0x11ce,0x11d3,0x11d7,0x11d9,0x111c,0x11dd,0x11df,0x111d,0x111e,0x1120,0x1122,
+	0x1123,0x1127,0x1129,0x112b,0x112c,0x112d,0x112e,0x112f,0x1132,0x1136,0x1140,0x1147,0x114c,0x11f1,0x11f2,0x1157,
+	0x1158,0x1159,0x1184,0x1185,0x1188,0x1191,0x1192,0x1194,0x119e,0x11a1,0x4e00,0x4e8c,0x4e09,0x56db,0x4e0a,0x4e2d,
+	0x4e0b,0x7532,0x4e59,0x4e19,0x4e01,0x5929,0x5730,0x4eba,0x28,0x1100,0x29,0x28,0x1102,0x29,0x28,0x1103,
+	0x29,0x28,0x1105,0x29,0x28,0x1106,0x29,0x28,0x1107,0x29,0x28,0x1109,0x29,0x28,0x110b,0x29,
+	0x28,0x110c,0x29,0x28,0x110e,0x29,0x28,0x110f,0x29,0x28,0x1110,0x29,0x28,0x1111,0x29,0x28,
+	0x1112,0x29,0x28,0x1100,0x1161,0x29,0x28,0x1102,0x1161,0x29,0x28,0x1103,0x1161,0x29,0x28,0x1105,
+	0x1161,0x29,0x28,0x1106,0x1161,0x29,0x28,0x1107,0x1161,0x29,0x28,0x1109,0x1161,0x29,0x28,0x110b,
+	0x1161,0x29,0x28,0x110c,0x1161,0x29,0x28,0x110e,0x1161,0x29,0x28,0x110f,0x1161,0x29,0x28,0x1110,
+	0x1161,0x29,0x28,0x1111,0x1161,0x29,0x28,0x1112,0x1161,0x29,0x28,0x110c,0x116e,0x29,0x28,0x110b,
+	0x1169,0x110c,0x1165,0x11ab,0x29,0x28,0x110b,0x1169,0x1112,0x116e,0x29,0x28,0x4e00,0x29,0x28,0x4e8c,
+	0x29,0x28,0x4e09,0x29,0x28,0x56db,0x29,0x28,0x4e94,0x29,0x28,0x516d,0x29,0x28,0x4e03,0x29,
+	0x28,0x516b,0x29,0x28,0x4e5d,0x29,0x28,0x5341,0x29,0x28,0x6708,0x29,0x28,0x706b,0x29,0x28,
+	0x6c34,0x29,0x28,0x6728,0x29,0x28,0x91d1,0x29,0x28,0x571f,0x29,0x28,0x65e5,0x29,0x28,0x682a,
+	0x29,0x28,0x6709,0x29,0x28,0x793e,0x29,0x28,0x540d,0x29,0x28,0x7279,0x29,0x28,0x8ca1,0x29,
+	0x28,0x795d,0x29,0x28,0x52b4,0x29,0x28,0x4ee3,0x29,0x28,0x547c,0x29,0x28,0x5b66,0x29,0x28,
+	0x76e3,0x29,0x28,0x4f01,0x29,0x28,0x8cc7,0x29,0x28,0x5354,0x29,0x28,0x796d,0x29,0x28,0x4f11,
+	0x29,0x28,0x81ea,0x29,0x28,0x81f3,0x29,0x554f,0x5e7c,0x6587,0x7b8f,0x50,0x54,0x45,0x32,0x31,
+	0x32,0x32,0x32,0x33,0x32,0x34,0x32,0x35,0x32,0x36,0x32,0x37,0x32,0x38,0x32,0x39,
+	0x33,0x30,0x33,0x31,0x33,0x32,0x33,0x33,0x33,0x34,0x33,0x35,0x1100,0x1102,0x1103,0x1105,
+	0x1106,0x1107,0x1109,0x110b,0x110c,0x110e,0x110f,0x1110,0x1111,0x1112,0x1100,0x1161,0x1102,0x1161,0x1103,0x1161,
+	0x1105,0x1161,0x1106,0x1161,0x1107,0x1161,0x1109,0x1161,0x110b,0x1161,0x110c,0x1161,0x110e,0x1161,0x110f,0x1161,
+	0x1110,0x1161,0x1111,0x1161,0x1112,0x1161,0x110e,0x1161,0x11b7,0x1100,0x1169,0x110c,0x116e,0x110b,0x1174,0x110b,
+	0x116e,0x4e00,0x4e8c,0x4e09,0x56db,0x4e94,0x516d,0x4e03,0x516b,0x4e5d,0x5341,0x6708,0x706b,0x6c34,0x6728,0x91d1,
+	0x571f,0x65e5,0x682a,0x6709,0x793e,0x540d,0x7279,0x8ca1,0x795d,0x52b4,0x79d8,0x7537,0x5973,0x9069,0x512a,0x5370,
+	0x6ce8,0x9805,0x4f11,0x5199,0x6b63,0x4e0a,0x4e2d,0x4e0b,0x5de6,0x53f3,0x533b,0x5b97,0x5b66,0x76e3,0x4f01,0x8cc7,
+	0x5354,0x591c,0x33,0x36,0x33,0x37,0x33,0x38,0x33,0x39,0x34,0x30,0x34,0x31,0x34,0x32,
+	0x34,0x33,0x34,0x34,0x34,0x35,0x34,0x36,0x34,0x37,0x34,0x38,0x34,0x39,0x35,0x30,
+	0x31,0x6708,0x32,0x6708,0x33,0x6708,0x34,0x6708,0x35,0x6708,0x36,0x6708,0x37,0x6708,0x38,0x6708,
+	0x39,0x6708,0x31,0x30,0x6708,0x31,0x31,0x6708,0x31,0x32,0x6708,0x48,0x67,0x65,0x72,0x67,
+	0x65,0x56,0x4c,0x54,0x44,0x30a2,0x30a4,0x30a6,0x30a8,0x30aa,0x30ab,0x30ad,0x30af,0x30b1,0x30b3,0x30b5,
+	0x30b7,0x30b9,0x30bb,0x30bd,0x30bf,0x30c1,0x30c4,0x30c6,0x30c8,0x30ca,0x30cb,0x30cc,0x30cd,0x30ce,0x30cf,0x30d2,
+	0x30d5,0x30d8,0x30db,0x30de,0x30df,0x30e0,0x30e1,0x30e2,0x30e4,0x30e6,0x30e8,0x30e9,0x30ea,0x30eb,0x30ec,0x30ed,
+	0x30ef,0x30f0,0x30f1,0x30f2,0x4ee4,0x548c,0x30a2,0x30d1,0x30fc,0x30c8,0x30a2,0x30eb,0x30d5,0x30a1,0x30a2,0x30f3,
+	0x30da,0x30a2,0x30a2,0x30fc,0x30eb,0x30a4,0x30cb,0x30f3,0x30b0,0x30a4,0x30f3,0x30c1,0x30a6,0x30a9,0x30f3,0x30a8,
+	0x30b9,0x30af,0x30fc,0x30c9,0x30a8,0x30fc,0x30ab,0x30fc,0x30aa,0x30f3,0x30b9,0x30aa,0x30fc,0x30e0,0x30ab,0x30a4,
+	0x30ea,0x30ab,0x30e9,0x30c3,0x30c8,0x30ab,0x30ed,0x30ea,0x30fc,0x30ac,0x30ed,0x30f3,0x30ac,0x30f3,0x30de,0x30ae,
+	0x30ac,0x30ae,0x30cb,0x30fc,0x30ad,0x30e5,0x30ea,0x30fc,0x30ae,0x30eb,0x30c0,0x30fc,0x30ad,0x30ed,0x30ad,0x30ed,
+	0x30b0,0x30e9,0x30e0,0x30ad,0x30ed,0x30e1,0x30fc,0x30c8,0x30eb,0x30ad,0x30ed,0x30ef,0x30c3,0x30c8,0x30b0,0x30e9,
+	0x30e0,0x30b0,0x30e9,0x30e0,0x30c8,0x30f3,0x30af,0x30eb,0x30bc,0x30a4,0x30ed,0x30af,0x30ed,0x30fc,0x30cd,0x30b1,
+	0x30fc,0x30b9,0x30b3,0x30eb,0x30ca,0x30b3,0x30fc,0x30dd,0x30b5,0x30a4,0x30af,0x30eb,0x30b5,0x30f3,0x30c1,0x30fc,
+	0x30e0,0x30b7,0x30ea,0x30f3,0x30b0,0x30bb,0x30f3,0x30c1,0x30bb,0x30f3,0x30c8,0x30c0,0x30fc,0x30b9,0x30c7,0x30b7,
+	0x30c9,0x30eb,0x30c8,0x30f3,0x30ca,0x30ce,0x30ce,0x30c3,0x30c8,0x30cf,0x30a4,0x30c4,0x30d1,0x30fc,0x30bb,0x30f3,
+	0x30c8,0x30d1,0x30fc,0x30c4,0x30d0,0x30fc,0x30ec,0x30eb,0x30d4,0x30a2,0x30b9,0x30c8,0x30eb,0x30d4,0x30af,0x30eb,
+	0x30d4,0x30b3,0x30d3,0x30eb,0x30d5,0x30a1,0x30e9,0x30c3,0x30c9,0x30d5,0x30a3,0x30fc,0x30c8,0x30d6,0x30c3,0x30b7,
+	0x30a7,0x30eb,0x30d5,0x30e9,0x30f3,0x30d8,0x30af,0x30bf,0x30fc,0x30eb,0x30da,0x30bd,0x30da,0x30cb,0x30d2,0x30d8,
+	0x30eb,0x30c4,0x30da,0x30f3,0x30b9,0x30da,0x30fc,0x30b8,0x30d9,0x30fc,0x30bf,0x30dd,0x30a4,0x30f3,0x30c8,0x30dc,
+	0x30eb,0x30c8,0x30db,0x30f3,0x30dd,0x30f3,0x30c9,0x30db,0x30fc,0x30eb,0x30db,0x30fc,0x30f3,0x30de,0x30a4,0x30af,
+	0x30ed,0x30de,0x30a4,0x30eb,0x30de,0x30c3,0x30cf,0x30de,0x30eb,0x30af,0x30de,0x30f3,0x30b7,0x30e7,0x30f3,0x30df,
+	0x30af,0x30ed,0x30f3,0x30df,0x30ea,0x30df,0x30ea,0x30d0,0x30fc,0x30eb,0x30e1,0x30ac,0x30e1,0x30ac,0x30c8,0x30f3,
+	0x30e1,0x30fc,0x30c8,0x30eb,0x30e4,0x30fc,0x30c9,0x30e4,0x30fc,0x30eb,0x30e6,0x30a2,0x30f3,0x30ea,0x30c3,0x30c8,
+	0x30eb,0x30ea,0x30e9,0x30eb,0x30d4,0x30fc,0x30eb,0x30fc,0x30d6,0x30eb,0x30ec,0x30e0,0x30ec,0x30f3,0x30c8,0x30b2,
+	0x30f3,0x30ef,0x30c3,0x30c8,0x30,0x70b9,0x31,0x70b9,0x32,0x70b9,0x33,0x70b9,0x34,0x70b9,0x35,0x70b9,
+	0x36,0x70b9,0x37,0x70b9,0x38,0x70b9,0x39,0x70b9,0x31,0x30,0x70b9,0x31,0x31,0x70b9,0x31,0x32,
+	0x70b9,0x31,0x33,0x70b9,0x31,0x34,0x70b9,0x31,0x35,0x70b9,0x31,0x36,0x70b9,0x31,0x37,0x70b9,
+	0x31,0x38,0x70b9,0x31,0x39,0x70b9,0x32,0x30,0x70b9,0x32,0x31,0x70b9,0x32,0x32,0x70b9,0x32,
+	0x33,0x70b9,0x32,0x34,0x70b9,0x68,0x50,0x61,0x64,0x61,0x41,0x55,0x62,0x61,0x72,0x6f,
+	0x56,0x70,0x63,0x64,0x6d,0x64,0x6d,0xb2,0x64,0x6d,0xb3,0x49,0x55,0x5e73,0x6210,0x662d,
+	0x548c,0x5927,0x6b63,0x660e,0x6cbb,0x682a,0x5f0f,0x4f1a,0x793e,0x70,0x41,0x6e,0x41,0x3bc,0x41,0x6d,
+	0x41,0x6b,0x41,0x4b,0x42,0x4d,0x42,0x47,0x42,0x63,0x61,0x6c,0x6b,0x63,0x61,0x6c,
+	0x70,0x46,0x6e,0x46,0x3bc,0x46,0x3bc,0x67,0x6d,0x67,0x6b,0x67,0x48,0x7a,0x6b,0x48,
+	0x7a,0x4d,0x48,0x7a,0x47,0x48,0x7a,0x54,0x48,0x7a,0x3bc,0x2113,0x6d,0x2113,0x64,0x2113,
+	0x6b,0x2113,0x66,0x6d,0x6e,0x6d,0x3bc,0x6d,0x6d,0x6d,0x63,0x6d,0x6b,0x6d,0x6d,0x6d,
+	0xb2,0x63,0x6d,0xb2,0x6d,0xb2,0x6b,0x6d,0xb2,0x6d,0x6d,0xb3,0x63,0x6d,0xb3,0x6d,
+	0xb3,0x6b,0x6d,0xb3,0x6d,0x2215,0x73,0x6d,0x2215,0x73,0xb2,0x50,0x61,0x6b,0x50,0x61,
+	0x4d,0x50,0x61,0x47,0x50,0x61,0x72,0x61,0x64,0x72,0x61,0x64,0x2215,0x73,0x72,0x61,
+	0x64,0x2215,0x73,0xb2,0x70,0x73,0x6e,0x73,0x3bc,0x73,0x6d,0x73,0x70,0x56,0x6e,0x56,
+	0x3bc,0x56,0x6d,0x56,0x6b,0x56,0x4d,0x56,0x70,0x57,0x6e,0x57,0x3bc,0x57,0x6d,0x57,
+	0x6b,0x57,0x4d,0x57,0x6b,0x3a9,0x4d,0x3a9,0x61,0x2e,0x6d,0x2e,0x42,0x71,0x63,0x63,
+	0x63,0x64,0x43,0x2215,0x6b,0x67,0x43,0x6f,0x2e,0x64,0x42,0x47,0x79,0x68,0x61,0x48,
+	0x50,0x69,0x6e,0x4b,0x4b,0x4b,0x4d,0x6b,0x74,0x6c,0x6d,0x6c,0x6e,0x6c,0x6f,0x67,
+	0x6c,0x78,0x6d,0x62,0x6d,0x69,0x6c,0x6d,0x6f,0x6c,0x50,0x48,0x70,0x2e,0x6d,0x2e,
+	0x50,0x50,0x4d,0x50,0x52,0x73,0x72,0x53,0x76,0x57,0x62,0x56,0x2215,0x6d,0x41,0x2215,
+	0x6d,0x31,0x65e5,0x32,0x65e5,0x33,0x65e5,0x34,0x65e5,0x35,0x65e5,0x36,0x65e5,0x37,0x65e5,0x38,
+	0x65e5,0x39,0x65e5,0x31,0x30,0x65e5,0x31,0x31,0x65e5,0x31,0x32,0x65e5,0x31,0x33,0x65e5,0x31,
+	0x34,0x65e5,0x31,0x35,0x65e5,0x31,0x36,0x65e5,0x31,0x37,0x65e5,0x31,0x38,0x65e5,0x31,0x39,
+	0x65e5,0x32,0x30,0x65e5,0x32,0x31,0x65e5,0x32,0x32,0x65e5,0x32,0x33,0x65e5,0x32,0x34,0x65e5,
+	0x32,0x35,0x65e5,0x32,0x36,0x65e5,0x32,0x37,0x65e5,0x32,0x38,0x65e5,0x32,0x39,0x65e5,0x33,
+	0x30,0x65e5,0x33,0x31,0x65e5,0x67,0x61,0x6c,0x44a,0x44c,0xa76f,0x43,0x46,0x51,0x126,0x153,
+	0xa727,0xab37,0x26b,0xab52,0x28d,0x8c48,0x66f4,0x8eca,0x8cc8,0x6ed1,0x4e32,0x53e5,0x9f9c,0x9f9c,0x5951,0x91d1,
+	0x5587,0x5948,0x61f6,0x7669,0x7f85,0x863f,0x87ba,0x88f8,0x908f,0x6a02,0x6d1b,0x70d9,0x73de,0x843d,0x916a,0x99f1,
+	0x4e82,0x5375,0x6b04,0x721b,0x862d,0x9e1e,0x5d50,0x6feb,0x85cd,0x8964,0x62c9,0x81d8,0x881f,0x5eca,0x6717,0x6d6a,
+	0x72fc,0x90ce,0x4f86,0x51b7,0x52de,0x64c4,0x6ad3,0x7210,0x76e7,0x8001,0x8606,0x865c,0x8def,0x9732,0x9b6f,0x9dfa,
+	0x788c,0x797f,0x7da0,0x83c9,0x9304,0x9e7f,0x8ad6,0x58df,0x5f04,0x7c60,0x807e,0x7262,0x78ca,0x8cc2,0x96f7,0x58d8,
+	0x5c62,0x6a13,0x6dda,0x6f0f,0x7d2f,0x7e37,0x964b,0x52d2,0x808b,0x51dc,0x51cc,0x7a1c,0x7dbe,0x83f1,0x9675,0x8b80,
+	0x62cf,0x6a02,0x8afe,0x4e39,0x5be7,0x6012,0x7387,0x7570,0x5317,0x78fb,0x4fbf,0x5fa9,0x4e0d,0x6ccc,0x6578,0x7d22,
+	0x53c3,0x585e,0x7701,0x8449,0x8aaa,0x6bba,0x8fb0,0x6c88,0x62fe,0x82e5,0x63a0,0x7565,0x4eae,0x5169,0x51c9,0x6881,
+	0x7ce7,0x826f,0x8ad2,0x91cf,0x52f5,0x5442,0x5973,0x5eec,0x65c5,0x6ffe,0x792a,0x95ad,0x9a6a,0x9e97,0x9ece,0x529b,
+	0x66c6,0x6b77,0x8f62,0x5e74,0x6190,0x6200,0x649a,0x6f23,0x7149,0x7489,0x79ca,0x7df4,0x806f,0x8f26,0x84ee,0x9023,
+	0x934a,0x5217,0x52a3,0x54bd,0x70c8,0x88c2,0x8aaa,0x5ec9,0x5ff5,0x637b,0x6bae,0x7c3e,0x7375,0x4ee4,0x56f9,0x5be7,
+	0x5dba,0x601c,0x73b2,0x7469,0x7f9a,0x8046,0x9234,0x96f6,0x9748,0x9818,0x4f8b,0x79ae,0x91b4,0x96b8,0x60e1,0x4e86,
+	0x50da,0x5bee,0x5c3f,0x6599,0x6a02,0x71ce,0x7642,0x84fc,0x907c,0x9f8d,0x6688,0x962e,0x5289,0x677b,0x67f3,0x6d41,
+	0x6e9c,0x7409,0x7559,0x786b,0x7d10,0x985e,0x516d,0x622e,0x9678,0x502b,0x5d19,0x6dea,0x8f2a,0x5f8b,0x6144,0x6817,
+	0x7387,0x9686,0x5229,0x540f,0x5c65,0x6613,0x674e,0x68a8,0x6ce5,0x7406,0x75e2,0x7f79,0x88cf,0x88e1,0x91cc,0x96e2,
+	0x533f,0x6eba,0x541d,0x71d0,0x7498,0x85fa,0x96a3,0x9c57,0x9e9f,0x6797,0x6dcb,0x81e8,0x7acb,0x7b20,0x7c92,0x72c0,
+	0x7099,0x8b58,0x4ec0,0x8336,0x523a,0x5207,0x5ea6,0x62d3,0x7cd6,0x5b85,0x6d1e,0x66b4,0x8f3b,0x884c,0x964d,0x898b,
+	0x5ed3,0x5140,0x55c0,0x585a,0x6674,0x51de,0x732a,0x76ca,0x793c,0x795e,0x7965,0x798f,0x9756,0x7cbe,0x7fbd,0x8612,
+	0x8af8,0x9038,0x90fd,0x98ef,0x98fc,0x9928,0x9db4,0x90de,0x96b7,0x4fae,0x50e7,0x514d,0x52c9,0x52e4,0x5351,0x559d,
+	0x5606,0x5668,0x5840,0x58a8,0x5c64,0x5c6e,0x6094,0x6168,0x618e,0x61f2,0x654f,0x65e2,0x6691,0x6885,0x6d77,0x6e1a,
+	0x6f22,0x716e,0x722b,0x7422,0x7891,0x793e,0x7949,0x7948,0x7950,0x7956,0x795d,0x798d,0x798e,0x7a40,0x7a81,0x7bc0,
+	0x7df4,0x7e09,0x7e41,0x7f72,0x8005,0x81ed,0x8279,0x8279,0x8457,0x8910,0x8996,0x8b01,0x8b39,0x8cd3,0x8d08,0x8fb6,
+	0x9038,0x96e3,0x97ff,0x983b,0x6075,0x242ee,0x8218,0x4e26,0x51b5,0x5168,0x4f80,0x5145,0x5180,0x52c7,0x52fa,0x559d,
+	0x5555,0x5599,0x55e2,0x585a,0x58b3,0x5944,0x5954,0x5a62,0x5b28,0x5ed2,0x5ed9,0x5f69,0x5fad,0x60d8,0x614e,0x6108,
+	0x618e,0x6160,0x61f2,0x6234,0x63c4,0x641c,0x6452,0x6556,0x6674,0x6717,0x671b,0x6756,0x6b79,0x6bba,0x6d41,0x6edb,
+	0x6ecb,0x6f22,0x701e,0x716e,0x77a7,0x7235,0x72af,0x732a,0x7471,0x7506,0x753b,0x761d,0x761f,0x76ca,0x76db,0x76f4,
+	0x774a,0x7740,0x78cc,0x7ab1,0x7bc0,0x7c7b,0x7d5b,0x7df4,0x7f3e,0x8005,0x8352,0x83ef,0x8779,0x8941,0x8986,0x8996,
+	0x8abf,0x8af8,0x8acb,0x8b01,0x8afe,0x8aed,0x8b39,0x8b8a,0x8d08,0x8f38,0x9072,0x9199,0x9276,0x967c,0x96e3,0x9756,
+	0x97db,0x97ff,0x980b,0x983b,0x9b12,0x9f9c,0x2284a,0x22844,0x233d5,0x3b9d,0x4018,0x4039,0x25249,0x25cd0,0x27ed3,0x9f43,
+	0x9f8e,0x66,0x66,0x66,0x69,0x66,0x6c,0x66,0x66,0x69,0x66,0x66,0x6c,0x17f,0x74,0x73,
+	0x74,0x574,0x576,0x574,0x565,0x574,0x56b,0x57e,0x576,0x574,0x56d,0x5d9,0x5b4,0x5f2,0x5b7,0x5e2,
+	0x5d0,0x5d3,0x5d4,0x5db,0x5dc,0x5dd,0x5e8,0x5ea,0x2b,0x5e9,0x5c1,0x5e9,0x5c2,0xfb49,0x5c1,0xfb49,
+	0x5c2,0x5d0,0x5b7,0x5d0,0x5b8,0x5d0,0x5bc,0x5d1,0x5bc,0x5d2,0x5bc,0x5d3,0x5bc,0x5d4,0x5bc,0x5d5,
+	0x5bc,0x5d6,0x5bc,0x5d8,0x5bc,0x5d9,0x5bc,0x5da,0x5bc,0x5db,0x5bc,0x5dc,0x5bc,0x5de,0x5bc,0x5e0,
+	0x5bc,0x5e1,0x5bc,0x5e3,0x5bc,0x5e4,0x5bc,0x5e6,0x5bc,0x5e7,0x5bc,0x5e8,0x5bc,0x5e9,0x5bc,0x5ea,
+	0x5bc,0x5d5,0x5b9,0x5d1,0x5bf,0x5db,0x5bf,0x5e4,0x5bf,0x5d0,0x5dc,0x671,0x671,0x67b,0x67b,0x67b,
+	0x67b,0x67e,0x67e,0x67e,0x67e,0x680,0x680,0x680,0x680,0x67a,0x67a,0x67a,0x67a,0x67f,0x67f,0x67f,
+	0x67f,0x679,0x679,0x679,0x679,0x6a4,0x6a4,0x6a4,0x6a4,0x6a6,0x6a6,0x6a6,0x6a6,0x684,0x684,0x684,
+	0x684,0x683,0x683,0x683,0x683,0x686,0x686,0x686,0x686,0x687,0x687,0x687,0x687,0x68d,0x68d,0x68c,
+	0x68c,0x68e,0x68e,0x688,0x688,0x698,0x698,0x691,0x691,0x6a9,0x6a9,0x6a9,0x6a9,0x6af,0x6af,0x6af,
+	0x6af,0x6b3,0x6b3,0x6b3,0x6b3,0x6b1,0x6b1,0x6b1,0x6b1,0x6ba,0x6ba,0x6bb,0x6bb,0x6bb,0x6bb,0x6c0,
+	0x6c0,0x6c1,0x6c1,0x6c1,0x6c1,0x6be,0x6be,0x6be,0x6be,0x6d2,0x6d2,0x6d3,0x6d3,0x6ad,0x6ad,0x6ad,
+	0x6ad,0x6c7,0x6c7,0x6c6,0x6c6,0x6c8,0x6c8,0x677,0x6cb,0x6cb,0x6c5,0x6c5,0x6c9,0x6c9,0x6d0,0x6d0,
+	0x6d0,0x6d0,0x649,0x649,0x626,0x627,0x626,0x627,0x626,0x6d5,0x626,0x6d5,0x626,0x648,0x626,0x648,
+	0x626,0x6c7,0x626,0x6c7,0x626,0x6c6,0x626,0x6c6,0x626,0x6c8,0x626,0x6c8,0x626,0x6d0,0x626,0x6d0,
+	0x626,0x6d0,0x626,0x649,0x626,0x649,0x626,0x649,0x6cc,0x6cc,0x6cc,0x6cc,0x626,0x62c,0x626,0x62d,
+	0x626,0x645,0x626,0x649,0x626,0x64a,0x628,0x62c,0x628,0x62d,0x628,0x62e,0x628,0x645,0x628,0x649,
+	0x628,0x64a,0x62a,0x62c,0x62a,0x62d,0x62a,0x62e,0x62a,0x645,0x62a,0x649,0x62a,0x64a,0x62b,0x62c,
+	0x62b,0x645,0x62b,0x649,0x62b,0x64a,0x62c,0x62d,0x62c,0x645,0x62d,0x62c,0x62d,0x645,0x62e,0x62c,
+	0x62e,0x62d,0x62e,0x645,0x633,0x62c,0x633,0x62d,0x633,0x62e,0x633,0x645,0x635,0x62d,0x635,0x645,
+	0x636,0x62c,0x636,0x62d,0x636,0x62e,0x636,0x645,0x637,0x62d,0x637,0x645,0x638,0x645,0x639,0x62c,
+	0x639,0x645,0x63a,0x62c,0x63a,0x645,0x641,0x62c,0x641,0x62d,0x641,0x62e,0x641,0x645,0x641,0x649,
+	0x641,0x64a,0x642,0x62d,0x642,0x645,0x642,0x649,0x642,0x64a,0x643,0x627,0x643,0x62c,0x643,0x62d,
+	0x643,0x62e,0x643,0x644,0x643,0x645,0x643,0x649,0x643,0x64a,0x644,0x62c,0x644,0x62d,0x644,0x62e,
+	0x644,0x645,0x644,0x649,0x644,0x64a,0x645,0x62c,0x645,0x62d,0x645,0x62e,0x645,0x645,0x645,0x649,
+	0x645,0x64a,0x646,0x62c,0x646,0x62d,0x646,0x62e,0x646,0x645,0x646,0x649,0x646,0x64a,0x647,0x62c,
+	0x647,0x645,0x647,0x649,0x647,0x64a,0x64a,0x62c,0x64a,0x62d,0x64a,0x62e,0x64a,0x645,0x64a,0x649,
+	0x64a,0x64a,0x630,0x670,0x631,0x670,0x649,0x670,0x20,0x64c,0x651,0x20,0x64d,0x651,0x20,0x64e,
+	0x651,0x20,0x64f,0x651,0x20,0x650,0x651,0x20,0x651,0x670,0x626,0x631,0x626,0x632,0x626,0x645,
+	0x626,0x646,0x626,0x649,0x626,0x64a,0x628,0x631,0x628,0x632,0x628,0x645,0x628,0x646,0x628,0x649,
+	0x628,0x64a,0x62a,0x631,0x62a,0x632,0x62a,0x645,0x62a,0x646,0x62a,0x649,0x62a,0x64a,0x62b,0x631,
+	0x62b,0x632,0x62b,0x645,0x62b,0x646,0x62b,0x649,0x62b,0x64a,0x641,0x649,0x641,0x64a,0x642,0x649,
+	0x642,0x64a,0x643,0x627,0x643,0x644,0x643,0x645,0x643,0x649,0x643,0x64a,0x644,0x645,0x644,0x649,
+	0x644,0x64a,0x645,0x627,0x645,0x645,0x646,0x631,0x646,0x632,0x646,0x645,0x646,0x646,0x646,0x649,
+	0x646,0x64a,0x649,0x670,0x64a,0x631,0x64a,0x632,0x64a,0x645,0x64a,0x646,0x64a,0x649,0x64a,0x64a,
+	0x626,0x62c,0x626,0x62d,0x626,0x62e,0x626,0x645,0x626,0x647,0x628,0x62c,0x628,0x62d,0x628,0x62e,
+	0x628,0x645,0x628,0x647,0x62a,0x62c,0x62a,0x62d,0x62a,0x62e,0x62a,0x645,0x62a,0x647,0x62b,0x645,
+	0x62c,0x62d,0x62c,0x645,0x62d,0x62c,0x62d,0x645,0x62e,0x62c,0x62e,0x645,0x633,0x62c,0x633,0x62d,
+	0x633,0x62e,0x633,0x645,0x635,0x62d,0x635,0x62e,0x635,0x645,0x636,0x62c,0x636,0x62d,0x636,0x62e,
+	0x636,0x645,0x637,0x62d,0x638,0x645,0x639,0x62c,0x639,0x645,0x63a,0x62c,0x63a,0x645,0x641,0x62c,
+	0x641,0x62d,0x641,0x62e,0x641,0x645,0x642,0x62d,0x642,0x645,0x643,0x62c,0x643,0x62d,0x643,0x62e,
+	0x643,0x644,0x643,0x645,0x644,0x62c,0x644,0x62d,0x644,0x62e,0x644,0x645,0x644,0x647,0x645,0x62c,
+	0x645,0x62d,0x645,0x62e,0x645,0x645,0x646,0x62c,0x646,0x62d,0x646,0x62e,0x646,0x645,0x646,0x647,
+	0x647,0x62c,0x647,0x645,0x647,0x670,0x64a,0x62c,0x64a,0x62d,0x64a,0x62e,0x64a,0x645,0x64a,0x647,
+	0x626,0x645,0x626,0x647,0x628,0x645,0x628,0x647,0x62a,0x645,0x62a,0x647,0x62b,0x645,0x62b,0x647,
+	0x633,0x645,0x633,0x647,0x634,0x645,0x634,0x647,0x643,0x644,0x643,0x645,0x644,0x645,0x646,0x645,
+	0x646,0x647,0x64a,0x645,0x64a,0x647,0x640,0x64e,0x651,0x640,0x64f,0x651,0x640,0x650,0x651,0x637,
+	0x649,0x637,0x64a,0x639,0x649,0x639,0x64a,0x63a,0x649,0x63a,0x64a,0x633,0x649,0x633,0x64a,0x634,
+	0x649,0x634,0x64a,0x62d,0x649,0x62d,0x64a,0x62c,0x649,0x62c,0x64a,0x62e,0x649,0x62e,0x64a,0x635,
+	0x649,0x635,0x64a,0x636,0x649,0x636,0x64a,0x634,0x62c,0x634,0x62d,0x634,0x62e,0x634,0x645,0x634,
+	0x631,0x633,0x631,0x635,0x631,0x636,0x631,0x637,0x649,0x637,0x64a,0x639,0x649,0x639,0x64a,0x63a,
+	0x649,0x63a,0x64a,0x633,0x649,0x633,0x64a,0x634,0x649,0x634,0x64a,0x62d,0x649,0x62d,0x64a,0x62c,
+	0x649,0x62c,0x64a,0x62e,0x649,0x62e,0x64a,0x635,0x649,0x635,0x64a,0x636,0x649,0x636,0x64a,0x634,
+	0x62c,0x634,0x62d,0x634,0x62e,0x634,0x645,0x634,0x631,0x633,0x631,0x635,0x631,0x636,0x631,0x634,
+	0x62c,0x634,0x62d,0x634,0x62e,0x634,0x645,0x633,0x647,0x634,0x647,0x637,0x645,0x633,0x62c,0x633,
+	0x62d,0x633,0x62e,0x634,0x62c,0x634,0x62d,0x634,0x62e,0x637,0x645,0x638,0x645,0x627,0x64b,0x627,
+	0x64b,0x62a,0x62c,0x645,0x62a,0x62d,0x62c,0x62a,0x62d,0x62c,0x62a,0x62d,0x645,0x62a,0x62e,0x645,
+	0x62a,0x645,0x62c,0x62a,0x645,0x62d,0x62a,0x645,0x62e,0x62c,0x645,0x62d,0x62c,0x645,0x62d,0x62d,
+	0x645,0x64a,0x62d,0x645,0x649,0x633,0x62d,0x62c,0x633,0x62c,0x62d,0x633,0x62c,0x649,0x633,0x645,
+	0x62d,0x633,0x645,0x62d,0x633,0x645,0x62c,0x633,0x645,0x645,0x633,0x645,0x645,0x635,0x62d,0x62d,
+	0x635,0x62d,0x62d,0x635,0x645,0x645,0x634,0x62d,0x645,0x634,0x62d,0x645,0x634,0x62c,0x64a,0x634,
+	0x645,0x62e,0x634,0x645,0x62e,0x634,0x645,0x645,0x634,0x645,0x645,0x636,0x62d,0x649,0x636,0x62e,
+	0x645,0x636,0x62e,0x645,0x637,0x645,0x62d,0x637,0x645,0x62d,0x637,0x645,0x645,0x637,0x645,0x64a,
+	0x639,0x62c,0x645,0x639,0x645,0x645,0x639,0x645,0x645,0x639,0x645,0x649,0x63a,0x645,0x645,0x63a,
+	0x645,0x64a,0x63a,0x645,0x649,0x641,0x62e,0x645,0x641,0x62e,0x645,0x642,0x645,0x62d,0x642,0x645,
+	0x645,0x644,0x62d,0x645,0x644,0x62d,0x64a,0x644,0x62d,0x649,0x644,0x62c,0x62c,0x644,0x62c,0x62c,
+	0x644,0x62e,0x645,0x644,0x62e,0x645,0x644,0x645,0x62d,0x644,0x645,0x62d,0x645,0x62d,0x62c,0x645,
+	0x62d,0x645,0x645,0x62d,0x64a,0x645,0x62c,0x62d,0x645,0x62c,0x645,0x645,0x62e,0x62c,0x645,0x62e,
+	0x645,0x645,0x62c,0x62e,0x647,0x645,0x62c,0x647,0x645,0x645,0x646,0x62d,0x645,0x646,0x62d,0x649,
+	0x646,0x62c,0x645,0x646,0x62c,0x645,0x646,0x62c,0x649,0x646,0x645,0x64a,0x646,0x645,0x649,0x64a,
+	0x645,0x645,0x64a,0x645,0x645,0x628,0x62e,0x64a,0x62a,0x62c,0x64a,0x62a,0x62c,0x649,0x62a,0x62e,
+	0x64a,0x62a,0x62e,0x649,0x62a,0x645,0x64a,0x62a,0x645,0x649,0x62c,0x645,0x64a,0x62c,0x62d,0x649,
+	0x62c,0x645,0x649,0x633,0x62e,0x649,0x635,0x62d,0x64a,0x634,0x62d,0x64a,0x636,0x62d,0x64a,0x644,
+	0x62c,0x64a,0x644,0x645,0x64a,0x64a,0x62d,0x64a,0x64a,0x62c,0x64a,0x64a,0x645,0x64a,0x645,0x645,
+	0x64a,0x642,0x645,0x64a,0x646,0x62d,0x64a,0x642,0x645,0x62d,0x644,0x62d,0x645,0x639,0x645,0x64a,
+	0x643,0x645,0x64a,0x646,0x62c,0x62d,0x645,0x62e,0x64a,0x644,0x62c,0x645,0x643,0x645,0x645,0x644,
+	0x62c,0x645,0x646,0x62c,0x62d,0x62c,0x62d,0x64a,0x62d,0x62c,0x64a,0x645,0x62c,0x64a,0x641,0x645,
+	0x64a,0x628,0x62d,0x64a,0x643,0x645,0x645,0x639,0x62c,0x645,0x635,0x645,0x645,0x633,0x62e,0x64a,
+	0x646,0x62c,0x64a,0x635,0x644,0x6d2,0x642,0x644,0x6d2,0x627,0x644,0x644,0x647,0x627,0x643,0x628,
+	0x631,0x645,0x62d,0x645,0x62f,0x635,0x644,0x639,0x645,0x631,0x633,0x648,0x644,0x639,0x644,0x64a,
+	0x647,0x648,0x633,0x644,0x645,0x635,0x644,0x649,0x635,0x644,0x649,0x20,0x627,0x644,0x644,0x647,
+	0x20,0x639,0x644,0x64a,0x647,0x20,0x648,0x633,0x644,0x645,0x62c,0x644,0x20,0x62c,0x644,0x627,
+	0x644,0x647,0x631,0x6cc,0x627,0x644,0x2c,0x3001,0x3002,0x3a,0x3b,0x21,0x3f,0x3016,0x3017,0x2026,
+	0x2025,0x2014,0x2013,0x5f,0x5f,0x28,0x29,0x7b,0x7d,0x3014,0x3015,0x3010,0x3011,0x300a,0x300b,0x3008,
+	0x3009,0x300c,0x300d,0x300e,0x300f,0x5b,0x5d,0x203e,0x203e,0x203e,0x203e,0x5f,0x5f,0x5f,0x2c,0x3001,
+	0x2e,0x3b,0x3a,0x3f,0x21,0x2014,0x28,0x29,0x7b,0x7d,0x3014,0x3015,0x23,0x26,0x2a,0x2b,
+	0x2d,0x3c,0x3e,0x3d,0x5c,0x24,0x25,0x40,0x20,0x64b,0x640,0x64b,0x20,0x64c,0x20,0x64d,
+	0x20,0x64e,0x640,0x64e,0x20,0x64f,0x640,0x64f,0x20,0x650,0x640,0x650,0x20,0x651,0x640,0x651,
+	0x20,0x652,0x640,0x652,0x621,0x622,0x622,0x623,0x623,0x624,0x624,0x625,0x625,0x626,0x626,0x626,
+	0x626,0x627,0x627,0x628,0x628,0x628,0x628,0x629,0x629,0x62a,0x62a,0x62a,0x62a,0x62b,0x62b,0x62b,
+	0x62b,0x62c,0x62c,0x62c,0x62c,0x62d,0x62d,0x62d,0x62d,0x62e,0x62e,0x62e,0x62e,0x62f,0x62f,0x630,
+	0x630,0x631,0x631,0x632,0x632,0x633,0x633,0x633,0x633,0x634,0x634,0x634,0x634,0x635,0x635,0x635,
+	0x635,0x636,0x636,0x636,0x636,0x637,0x637,0x637,0x637,0x638,0x638,0x638,0x638,0x639,0x639,0x639,
+	0x639,0x63a,0x63a,0x63a,0x63a,0x641,0x641,0x641,0x641,0x642,0x642,0x642,0x642,0x643,0x643,0x643,
+	0x643,0x644,0x644,0x644,0x644,0x645,0x645,0x645,0x645,0x646,0x646,0x646,0x646,0x647,0x647,0x647,
+	0x647,0x648,0x648,0x649,0x649,0x64a,0x64a,0x64a,0x64a,0x644,0x622,0x644,0x622,0x644,0x623,0x644,
+	0x623,0x644,0x625,0x644,0x625,0x644,0x627,0x644,0x627,0x21,0x22,0x23,0x24,0x25,0x26,0x27,
+	0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+	0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,
+	0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,
+	0x58,0x59,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x65,0x66,0x67,
+	0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,
+	0x78,0x79,0x7a,0x7b,0x7c,0x7d,0x7e,0x2985,0x2986,0x3002,0x300c,0x300d,0x3001,0x30fb,0x30f2,0x30a1,
+	0x30a3,0x30a5,0x30a7,0x30a9,0x30e3,0x30e5,0x30e7,0x30c3,0x30fc,0x30a2,0x30a4,0x30a6,0x30a8,0x30aa,0x30ab,0x30ad,
+	0x30af,0x30b1,0x30b3,0x30b5,0x30b7,0x30b9,0x30bb,0x30bd,0x30bf,0x30c1,0x30c4,0x30c6,0x30c8,0x30ca,0x30cb,0x30cc,
+	0x30cd,0x30ce,0x30cf,0x30d2,0x30d5,0x30d8,0x30db,0x30de,0x30df,0x30e0,0x30e1,0x30e2,0x30e4,0x30e6,0x30e8,0x30e9,
+	0x30ea,0x30eb,0x30ec,0x30ed,0x30ef,0x30f3,0x3099,0x309a,0x3164,0x3131,0x3132,0x3133,0x3134,0x3135,0x3136,0x3137,
+	0x3138,0x3139,0x313a,0x313b,0x313c,0x313d,0x313e,0x313f,0x3140,0x3141,0x3142,0x3143,0x3144,0x3145,0x3146,0x3147,
+	0x3148,0x3149,0x314a,0x314b,0x314c,0x314d,0x314e,0x314f,0x3150,0x3151,0x3152,0x3153,0x3154,0x3155,0x3156,0x3157,
+	0x3158,0x3159,0x315a,0x315b,0x315c,0x315d,0x315e,0x315f,0x3160,0x3161,0x3162,0x3163,0xa2,0xa3,0xac,0xaf,
+	0xa6,0xa5,0x20a9,0x2502,0x2190,0x2191,0x2192,0x2193,0x25a0,0x25cb,0x2d0,0x2d1,0xe6,0x299,0x253,0x2a3,
+	0xab66,0x2a5,0x2a4,0x256,0x257,0x1d91,0x258,0x25e,0x2a9,0x264,0x262,0x260,0x29b,0x127,0x29c,0x267,
+	0x284,0x2aa,0x2ab,0x26c,0x1df04,0xa78e,0x26e,0x1df05,0x28e,0x1df06,0xf8,0x276,0x277,0x71,0x27a,0x1df08,
+	0x27d,0x27e,0x280,0x2a8,0x2a6,0xab67,0x2a7,0x288,0x2c71,0x28f,0x2a1,0x2a2,0x298,0x1c0,0x1c1,0x1c2,
+	0x1df0a,0x1df1e,0x11099,0x110ba,0x1109b,0x110ba,0x110a5,0x110ba,0x11131,0x11127,0x11132,0x11127,0x11347,0x1133e,0x11347,0x11357,
+	0x114b9,0x114ba,0x114b9,0x114b0,0x114b9,0x114bd,0x115b8,0x115af,0x115b9,0x115af,0x11935,0x11930,0x1d157,0x1d165,0x1d158,0x1d165,
+	0x1d15f,0x1d16e,0x1d15f,0x1d16f,0x1d15f,0x1d170,0x1d15f,0x1d171,0x1d15f,0x1d172,0x1d1b9,0x1d165,0x1d1ba,0x1d165,0x1d1bb,0x1d16e,
+	0x1d1bc,0x1d16e,0x1d1bb,0x1d16f,0x1d1bc,0x1d16f,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,
+	0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,
+	0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,
+	0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x43,0x44,0x45,0x46,
+	0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,
+	0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x69,0x6a,0x6b,0x6c,0x6d,
+	0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x43,
+	0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,
+	0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,
+	0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,
+	0x7a,0x41,0x43,0x44,0x47,0x4a,0x4b,0x4e,0x4f,0x50,0x51,0x53,0x54,0x55,0x56,0x57,
+	0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x66,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x70,
+	0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x43,0x44,0x45,0x46,
+	0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,
+	0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,
+	0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,
+	0x44,0x45,0x46,0x47,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x53,0x54,0x55,0x56,
+	0x57,0x58,0x59,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,
+	0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x44,
+	0x45,0x46,0x47,0x49,0x4a,0x4b,0x4c,0x4d,0x4f,0x53,0x54,0x55,0x56,0x57,0x58,0x59,
+	0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,
+	0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x43,0x44,0x45,0x46,
+	0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,
+	0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,
+	0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,
+	0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,
+	0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,
+	0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,
+	0x79,0x7a,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,
+	0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,
+	0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,
+	0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,
+	0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,
+	0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,
+	0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,0x43,0x44,0x45,0x46,
+	0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,
+	0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,
+	0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x41,0x42,
+	0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,
+	0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,
+	0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,
+	0x79,0x7a,0x131,0x237,0x391,0x392,0x393,0x394,0x395,0x396,0x397,0x398,0x399,0x39a,0x39b,0x39c,
+	0x39d,0x39e,0x39f,0x3a0,0x3a1,0x3f4,0x3a3,0x3a4,0x3a5,0x3a6,0x3a7,0x3a8,0x3a9,0x2207,0x3b1,0x3b2,
+	0x3b3,0x3b4,0x3b5,0x3b6,0x3b7,0x3b8,0x3b9,0x3ba,0x3bb,0x3bc,0x3bd,0x3be,0x3bf,0x3c0,0x3c1,0x3c2,
+	0x3c3,0x3c4,0x3c5,0x3c6,0x3c7,0x3c8,0x3c9,0x2202,0x3f5,0x3d1,0x3f0,0x3d5,0x3f1,0x3d6,0x391,0x392,
+	0x393,0x394,0x395,0x396,0x397,0x398,0x399,0x39a,0x39b,0x39c,0x39d,0x39e,0x39f,0x3a0,0x3a1,0x3f4,
+	0x3a3,0x3a4,0x3a5,0x3a6,0x3a7,0x3a8,0x3a9,0x2207,0x3b1,0x3b2,0x3b3,0x3b4,0x3b5,0x3b6,0x3b7,0x3b8,
+	0x3b9,0x3ba,0x3bb,0x3bc,0x3bd,0x3be,0x3bf,0x3c0,0x3c1,0x3c2,0x3c3,0x3c4,0x3c5,0x3c6,0x3c7,0x3c8,
+	0x3c9,0x2202,0x3f5,0x3d1,0x3f0,0x3d5,0x3f1,0x3d6,0x391,0x392,0x393,0x394,0x395,0x396,0x397,0x398,
+	0x399,0x39a,0x39b,0x39c,0x39d,0x39e,0x39f,0x3a0,0x3a1,0x3f4,0x3a3,0x3a4,0x3a5,0x3a6,0x3a7,0x3a8,
+	0x3a9,0x2207,0x3b1,0x3b2,0x3b3,0x3b4,0x3b5,0x3b6,0x3b7,0x3b8,0x3b9,0x3ba,0x3bb,0x3bc,0x3bd,0x3be,
+	0x3bf,0x3c0,0x3c1,0x3c2,0x3c3,0x3c4,0x3c5,0x3c6,0x3c7,0x3c8,0x3c9,0x2202,0x3f5,0x3d1,0x3f0,0x3d5,
+	0x3f1,0x3d6,0x391,0x392,0x393,0x394,0x395,0x396,0x397,0x398,0x399,0x39a,0x39b,0x39c,0x39d,0x39e,
+	0x39f,0x3a0,0x3a1,0x3f4,0x3a3,0x3a4,0x3a5,0x3a6,0x3a7,0x3a8,0x3a9,0x2207,0x3b1,0x3b2,0x3b3,0x3b4,
+	0x3b5,0x3b6,0x3b7,0x3b8,0x3b9,0x3ba,0x3bb,0x3bc,0x3bd,0x3be,0x3bf,0x3c0,0x3c1,0x3c2,0x3c3,0x3c4,
+	0x3c5,0x3c6,0x3c7,0x3c8,0x3c9,0x2202,0x3f5,0x3d1,0x3f0,0x3d5,0x3f1,0x3d6,0x391,0x392,0x393,0x394,
+	0x395,0x396,0x397,0x398,0x399,0x39a,0x39b,0x39c,0x39d,0x39e,0x39f,0x3a0,0x3a1,0x3f4,0x3a3,0x3a4,
+	0x3a5,0x3a6,0x3a7,0x3a8,0x3a9,0x2207,0x3b1,0x3b2,0x3b3,0x3b4,0x3b5,0x3b6,0x3b7,0x3b8,0x3b9,0x3ba,
+	0x3bb,0x3bc,0x3bd,0x3be,0x3bf,0x3c0,0x3c1,0x3c2,0x3c3,0x3c4,0x3c5,0x3c6,0x3c7,0x3c8,0x3c9,0x2202,
+	0x3f5,0x3d1,0x3f0,0x3d5,0x3f1,0x3d6,0x3dc,0x3dd,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+	0x38,0x39,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x31,0x32,0x33,
+	0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,
+	0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x627,0x628,0x62c,0x62f,0x648,0x632,
+	0x62d,0x637,0x64a,0x643,0x644,0x645,0x646,0x633,0x639,0x641,0x635,0x642,0x631,0x634,0x62a,0x62b,
+	0x62e,0x630,0x636,0x638,0x63a,0x66e,0x6ba,0x6a1,0x66f,0x628,0x62c,0x647,0x62d,0x64a,0x643,0x644,
+	0x645,0x646,0x633,0x639,0x641,0x635,0x642,0x634,0x62a,0x62b,0x62e,0x636,0x63a,0x62c,0x62d,0x64a,
+	0x644,0x646,0x633,0x639,0x635,0x642,0x634,0x62e,0x636,0x63a,0x6ba,0x66f,0x628,0x62c,0x647,0x62d,
+	0x637,0x64a,0x643,0x645,0x646,0x633,0x639,0x641,0x635,0x642,0x634,0x62a,0x62b,0x62e,0x636,0x638,
+	0x63a,0x66e,0x6a1,0x627,0x628,0x62c,0x62f,0x647,0x648,0x632,0x62d,0x637,0x64a,0x644,0x645,0x646,
+	0x633,0x639,0x641,0x635,0x642,0x631,0x634,0x62a,0x62b,0x62e,0x630,0x636,0x638,0x63a,0x628,0x62c,
+	0x62f,0x648,0x632,0x62d,0x637,0x64a,0x644,0x645,0x646,0x633,0x639,0x641,0x635,0x642,0x631,0x634,
+	0x62a,0x62b,0x62e,0x630,0x636,0x638,0x63a,0x30,0x2e,0x30,0x2c,0x31,0x2c,0x32,0x2c,0x33,
+	0x2c,0x34,0x2c,0x35,0x2c,0x36,0x2c,0x37,0x2c,0x38,0x2c,0x39,0x2c,0x28,0x41,0x29,
+	0x28,0x42,0x29,0x28,0x43,0x29,0x28,0x44,0x29,0x28,0x45,0x29,0x28,0x46,0x29,0x28,
+	0x47,0x29,0x28,0x48,0x29,0x28,0x49,0x29,0x28,0x4a,0x29,0x28,0x4b,0x29,0x28,0x4c,
+	0x29,0x28,0x4d,0x29,0x28,0x4e,0x29,0x28,0x4f,0x29,0x28,0x50,0x29,0x28,0x51,0x29,
+	0x28,0x52,0x29,0x28,0x53,0x29,0x28,0x54,0x29,0x28,0x55,0x29,0x28,0x56,0x29,0x28,
+	0x57,0x29,0x28,0x58,0x29,0x28,0x59,0x29,0x28,0x5a,0x29,0x3014,0x53,0x3015,0x43,0x52,
+	0x43,0x44,0x57,0x5a,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,
+	0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x48,0x56,
+	0x4d,0x56,0x53,0x44,0x53,0x53,0x50,0x50,0x56,0x57,0x43,0x4d,0x43,0x4d,0x44,0x4d,
+	0x52,0x44,0x4a,0x307b,0x304b,0x30b3,0x30b3,0x30b5,0x624b,0x5b57,0x53cc,0x30c7,0x4e8c,0x591a,0x89e3,0x5929,
+	0x4ea4,0x6620,0x7121,0x6599,0x524d,0x5f8c,0x518d,0x65b0,0x521d,0x7d42,0x751f,0x8ca9,0x58f0,0x5439,0x6f14,0x6295,
+	0x6355,0x4e00,0x4e09,0x904a,0x5de6,0x4e2d,0x53f3,0x6307,0x8d70,0x6253,0x7981,0x7a7a,0x5408,0x6e80,0x6709,0x6708,
+	0x7533,0x5272,0x55b6,0x914d,0x3014,0x672c,0x3015,0x3014,0x4e09,0x3015,0x3014,0x4e8c,0x3015,0x3014,0x5b89,0x3015,
+	0x3014,0x70b9,0x3015,0x3014,0x6253,0x3015,0x3014,0x76d7,0x3015,0x3014,0x52dd,0x3015,0x3014,0x6557,0x3015,0x5f97,
+	0x53ef,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x4e3d,0x4e38,0x4e41,0x20122,0x4f60,
+	0x4fae,0x4fbb,0x5002,0x507a,0x5099,0x50e7,0x50cf,0x349e,0x2063a,0x514d,0x5154,0x5164,0x5177,0x2051c,0x34b9,0x5167,
+	0x518d,0x2054b,0x5197,0x51a4,0x4ecc,0x51ac,0x51b5,0x291df,0x51f5,0x5203,0x34df,0x523b,0x5246,0x5272,0x5277,0x3515,
+	0x52c7,0x52c9,0x52e4,0x52fa,0x5305,0x5306,0x5317,0x5349,0x5351,0x535a,0x5373,0x537d,0x537f,0x537f,0x537f,0x20a2c,
+	0x7070,0x53ca,0x53df,0x20b63,0x53eb,0x53f1,0x5406,0x549e,0x5438,0x5448,0x5468,0x54a2,0x54f6,0x5510,0x5553,0x5563,
+	0x5584,0x5584,0x5599,0x55ab,0x55b3,0x55c2,0x5716,0x5606,0x5717,0x5651,0x5674,0x5207,0x58ee,0x57ce,0x57f4,0x580d,
+	0x578b,0x5832,0x5831,0x58ac,0x214e4,0x58f2,0x58f7,0x5906,0x591a,0x5922,0x5962,0x216a8,0x216ea,0x59ec,0x5a1b,0x5a27,
+	0x59d8,0x5a66,0x36ee,0x36fc,0x5b08,0x5b3e,0x5b3e,0x219c8,0x5bc3,0x5bd8,0x5be7,0x5bf3,0x21b18,0x5bff,0x5c06,0x5f53,
+	0x5c22,0x3781,0x5c60,0x5c6e,0x5cc0,0x5c8d,0x21de4,0x5d43,0x21de6,0x5d6e,0x5d6b,0x5d7c,0x5de1,0x5de2,0x382f,0x5dfd,
+	0x5e28,0x5e3d,0x5e69,0x3862,0x22183,0x387c,0x5eb0,0x5eb3,0x5eb6,0x5eca,0x2a392,0x5efe,0x22331,0x22331,0x8201,0x5f22,
+	0x5f22,0x38c7,0x232b8,0x261da,0x5f62,0x5f6b,0x38e3,0x5f9a,0x5fcd,0x5fd7,0x5ff9,0x6081,0x393a,0x391c,0x6094,0x226d4,
+	0x60c7,0x6148,0x614c,0x614e,0x614c,0x617a,0x618e,0x61b2,0x61a4,0x61af,0x61de,0x61f2,0x61f6,0x6210,0x621b,0x625d,
+	0x62b1,0x62d4,0x6350,0x22b0c,0x633d,0x62fc,0x6368,0x6383,0x63e4,0x22bf1,0x6422,0x63c5,0x63a9,0x3a2e,0x6469,0x647e,
+	0x649d,0x6477,0x3a6c,0x654f,0x656c,0x2300a,0x65e3,0x66f8,0x6649,0x3b19,0x6691,0x3b08,0x3ae4,0x5192,0x5195,0x6700,
+	0x669c,0x80ad,0x43d9,0x6717,0x671b,0x6721,0x675e,0x6753,0x233c3,0x3b49,0x67fa,0x6785,0x6852,0x6885,0x2346d,0x688e,
+	0x681f,0x6914,0x3b9d,0x6942,0x69a3,0x69ea,0x6aa8,0x236a3,0x6adb,0x3c18,0x6b21,0x238a7,0x6b54,0x3c4e,0x6b72,0x6b9f,
+	0x6bba,0x6bbb,0x23a8d,0x21d0b,0x23afa,0x6c4e,0x23cbc,0x6cbf,0x6ccd,0x6c67,0x6d16,0x6d3e,0x6d77,0x6d41,0x6d69,0x6d78,
+	0x6d85,0x23d1e,0x6d34,0x6e2f,0x6e6e,0x3d33,0x6ecb,0x6ec7,0x23ed1,0x6df9,0x6f6e,0x23f5e,0x23f8e,0x6fc6,0x7039,0x701e,
+	0x701b,0x3d96,0x704a,0x707d,0x7077,0x70ad,0x20525,0x7145,0x24263,0x719c,0x243ab,0x7228,0x7235,0x7250,0x24608,0x7280,
+	0x7295,0x24735,0x24814,0x737a,0x738b,0x3eac,0x73a5,0x3eb8,0x3eb8,0x7447,0x745c,0x7471,0x7485,0x74ca,0x3f1b,0x7524,
+	0x24c36,0x753e,0x24c92,0x7570,0x2219f,0x7610,0x24fa1,0x24fb8,0x25044,0x3ffc,0x4008,0x76f4,0x250f3,0x250f2,0x25119,0x25133,
+	0x771e,0x771f,0x771f,0x774a,0x4039,0x778b,0x4046,0x4096,0x2541d,0x784e,0x788c,0x78cc,0x40e3,0x25626,0x7956,0x2569a,
+	0x256c5,0x798f,0x79eb,0x412f,0x7a40,0x7a4a,0x7a4f,0x2597c,0x25aa7,0x25aa7,0x7aee,0x4202,0x25bab,0x7bc6,0x7bc9,0x4227,
+	0x25c80,0x7cd2,0x42a0,0x7ce8,0x7ce3,0x7d00,0x25f86,0x7d63,0x4301,0x7dc7,0x7e02,0x7e45,0x4334,0x26228,0x26247,0x4359,
+	0x262d9,0x7f7a,0x2633e,0x7f95,0x7ffa,0x8005,0x264da,0x26523,0x8060,0x265a8,0x8070,0x2335f,0x43d5,0x80b2,0x8103,0x440b,
+	0x813e,0x5ab5,0x267a7,0x267b5,0x23393,0x2339c,0x8201,0x8204,0x8f9e,0x446b,0x8291,0x828b,0x829d,0x52b3,0x82b1,0x82b3,
+	0x82bd,0x82e6,0x26b3c,0x82e5,0x831d,0x8363,0x83ad,0x8323,0x83bd,0x83e7,0x8457,0x8353,0x83ca,0x83cc,0x83dc,0x26c36,
+	0x26d6b,0x26cd5,0x452b,0x84f1,0x84f3,0x8516,0x273ca,0x8564,0x26f2c,0x455d,0x4561,0x26fb1,0x270d2,0x456b,0x8650,0x865c,
+	0x8667,0x8669,0x86a9,0x8688,0x870e,0x86e2,0x8779,0x8728,0x876b,0x8786,0x45d7,0x87e1,0x8801,0x45f9,0x8860,0x8863,
+	0x27667,0x88d7,0x88de,0x4635,0x88fa,0x34bb,0x278ae,0x27966,0x46be,0x46c7,0x8aa0,0x8aed,0x8b8a,0x8c55,0x27ca8,0x8cab,
+	0x8cc1,0x8d1b,0x8d77,0x27f2f,0x20804,0x8dcb,0x8dbc,0x8df0,0x208de,0x8ed4,0x8f38,0x285d2,0x285ed,0x9094,0x90f1,0x9111,
+	0x2872e,0x911b,0x9238,0x92d7,0x92d8,0x927c,0x93f9,0x9415,0x28bfa,0x958b,0x4995,0x95b7,0x28d77,0x49e6,0x96c3,0x5db2,
+	0x9723,0x29145,0x2921a,0x4a6e,0x4a76,0x97e0,0x2940a,0x4ab2,0x29496,0x980b,0x980b,0x9829,0x295b6,0x98e2,0x4b33,0x9929,
+	0x99a7,0x99c2,0x99fe,0x4bce,0x29b30,0x9b12,0x9c40,0x9cfd,0x4cce,0x4ced,0x9d67,0x2a0ce,0x4cf8,0x2a105,0x2a20e,0x2a291,
+	0x9ebb,0x4d56,0x9ef9,0x9efe,0x9f05,0x9f0f,0x9f16,0x9f3b,0x2a600,
+};
+
+// primary composites (hangul syllables are composed algorithmically), sorted
+// by first, second
+struct composition {
+	char32_t first;
+	char32_t second;
+	char32_t composite;
+};
+
+constexpr composition compositions[941] = {
+	{0x3c,0x338,0x226e},{0x3d,0x338,0x2260},{0x3e,0x338,0x226f},{0x41,0x300,0xc0},{0x41,0x301,0xc1},{0x41,0x302,0xc2},
+	{0x41,0x303,0xc3},{0x41,0x304,0x100},{0x41,0x306,0x102},{0x41,0x307,0x226},{0x41,0x308,0xc4},{0x41,0x309,0x1ea2},
+	{0x41,0x30a,0xc5},{0x41,0x30c,0x1cd},{0x41,0x30f,0x200},{0x41,0x311,0x202},{0x41,0x323,0x1ea0},{0x41,0x325,0x1e00},
+	{0x41,0x328,0x104},{0x42,0x307,0x1e02},{0x42,0x323,0x1e04},{0x42,0x331,0x1e06},{0x43,0x301,0x106},{0x43,0x302,0x108},
+	{0x43,0x307,0x10a},{0x43,0x30c,0x10c},{0x43,0x327,0xc7},{0x44,0x307,0x1e0a},{0x44,0x30c,0x10e},{0x44,0x323,0x1e0c},
+	{0x44,0x327,0x1e10},{0x44,0x32d,0x1e12},{0x44,0x331,0x1e0e},{0x45,0x300,0xc8},{0x45,0x301,0xc9},{0x45,0x302,0xca},
+	{0x45,0x303,0x1ebc},{0x45,0x304,0x112},{0x45,0x306,0x114},{0x45,0x307,0x116},{0x45,0x308,0xcb},{0x45,0x309,0x1eba},
+	{0x45,0x30c,0x11a},{0x45,0x30f,0x204},{0x45,0x311,0x206},{0x45,0x323,0x1eb8},{0x45,0x327,0x228},{0x45,0x328,0x118},
+	{0x45,0x32d,0x1e18},{0x45,0x330,0x1e1a},{0x46,0x307,0x1e1e},{0x47,0x301,0x1f4},{0x47,0x302,0x11c},{0x47,0x304,0x1e20},
+	{0x47,0x306,0x11e},{0x47,0x307,0x120},{0x47,0x30c,0x1e6},{0x47,0x327,0x122},{0x48,0x302,0x124},{0x48,0x307,0x1e22},
+	{0x48,0x308,0x1e26},{0x48,0x30c,0x21e},{0x48,0x323,0x1e24},{0x48,0x327,0x1e28},{0x48,0x32e,0x1e2a},{0x49,0x300,0xcc},
+	{0x49,0x301,0xcd},{0x49,0x302,0xce},{0x49,0x303,0x128},{0x49,0x304,0x12a},{0x49,0x306,0x12c},{0x49,0x307,0x130},
+	{0x49,0x308,0xcf},{0x49,0x309,0x1ec8},{0x49,0x30c,0x1cf},{0x49,0x30f,0x208},{0x49,0x311,0x20a},{0x49,0x323,0x1eca},
+	{0x49,0x328,0x12e},{0x49,0x330,0x1e2c},{0x4a,0x302,0x134},{0x4b,0x301,0x1e30},{0x4b,0x30c,0x1e8},{0x4b,0x323,0x1e32},
+	{0x4b,0x327,0x136},{0x4b,0x331,0x1e34},{0x4c,0x301,0x139},{0x4c,0x30c,0x13d},{0x4c,0x323,0x1e36},{0x4c,0x327,0x13b},
+	{0x4c,0x32d,0x1e3c},{0x4c,0x331,0x1e3a},{0x4d,0x301,0x1e3e},{0x4d,0x307,0x1e40},{0x4d,0x323,0x1e42},{0x4e,0x300,0x1f8},
+	{0x4e,0x301,0x143},{0x4e,0x303,0xd1},{0x4e,0x307,0x1e44},{0x4e,0x30c,0x147},{0x4e,0x323,0x1e46},{0x4e,0x327,0x145},
+	{0x4e,0x32d,0x1e4a},{0x4e,0x331,0x1e48},{0x4f,0x300,0xd2},{0x4f,0x301,0xd3},{0x4f,0x302,0xd4},{0x4f,0x303,0xd5},
+	{0x4f,0x304,0x14c},{0x4f,0x306,0x14e},{0x4f,0x307,0x22e},{0x4f,0x308,0xd6},{0x4f,0x309,0x1ece},{0x4f,0x30b,0x150},
+	{0x4f,0x30c,0x1d1},{0x4f,0x30f,0x20c},{0x4f,0x311,0x20e},{0x4f,0x31b,0x1a0},{0x4f,0x323,0x1ecc},{0x4f,0x328,0x1ea},
+	{0x50,0x301,0x1e54},{0x50,0x307,0x1e56},{0x52,0x301,0x154},{0x52,0x307,0x1e58},{0x52,0x30c,0x158},{0x52,0x30f,0x210},
+	{0x52,0x311,0x212},{0x52,0x323,0x1e5a},{0x52,0x327,0x156},{0x52,0x331,0x1e5e},{0x53,0x301,0x15a},{0x53,0x302,0x15c},
+	{0x53,0x307,0x1e60},{0x53,0x30c,0x160},{0x53,0x323,0x1e62},{0x53,0x326,0x218},{0x53,0x327,0x15e},{0x54,0x307,0x1e6a},
+	{0x54,0x30c,0x164},{0x54,0x323,0x1e6c},{0x54,0x326,0x21a},{0x54,0x327,0x162},{0x54,0x32d,0x1e70},{0x54,0x331,0x1e6e},
+	{0x55,0x300,0xd9},{0x55,0x301,0xda},{0x55,0x302,0xdb},{0x55,0x303,0x168},{0x55,0x304,0x16a},{0x55,0x306,0x16c},
+	{0x55,0x308,0xdc},{0x55,0x309,0x1ee6},{0x55,0x30a,0x16e},{0x55,0x30b,0x170},{0x55,0x30c,0x1d3},{0x55,0x30f,0x214},
+	{0x55,0x311,0x216},{0x55,0x31b,0x1af},{0x55,0x323,0x1ee4},{0x55,0x324,0x1e72},{0x55,0x328,0x172},{0x55,0x32d,0x1e76},
+	{0x55,0x330,0x1e74},{0x56,0x303,0x1e7c},{0x56,0x323,0x1e7e},{0x57,0x300,0x1e80},{0x57,0x301,0x1e82},{0x57,0x302,0x174},
+	{0x57,0x307,0x1e86},{0x57,0x308,0x1e84},{0x57,0x323,0x1e88},{0x58,0x307,0x1e8a},{0x58,0x308,0x1e8c},{0x59,0x300,0x1ef2},
+	{0x59,0x301,0xdd},{0x59,0x302,0x176},{0x59,0x303,0x1ef8},{0x59,0x304,0x232},{0x59,0x307,0x1e8e},{0x59,0x308,0x178},
+	{0x59,0x309,0x1ef6},{0x59,0x323,0x1ef4},{0x5a,0x301,0x179},{0x5a,0x302,0x1e90},{0x5a,0x307,0x17b},{0x5a,0x30c,0x17d},
+	{0x5a,0x323,0x1e92},{0x5a,0x331,0x1e94},{0x61,0x300,0xe0},{0x61,0x301,0xe1},{0x61,0x302,0xe2},{0x61,0x303,0xe3},
+	{0x61,0x304,0x101},{0x61,0x306,0x103},{0x61,0x307,0x227},{0x61,0x308,0xe4},{0x61,0x309,0x1ea3},{0x61,0x30a,0xe5},
+	{0x61,0x30c,0x1ce},{0x61,0x30f,0x201},{0x61,0x311,0x203},{0x61,0x323,0x1ea1},{0x61,0x325,0x1e01},{0x61,0x328,0x105},
+	{0x62,0x307,0x1e03},{0x62,0x323,0x1e05},{0x62,0x331,0x1e07},{0x63,0x301,0x107},{0x63,0x302,0x109},{0x63,0x307,0x10b},
+	{0x63,0x30c,0x10d},{0x63,0x327,0xe7},{0x64,0x307,0x1e0b},{0x64,0x30c,0x10f},{0x64,0x323,0x1e0d},{0x64,0x327,0x1e11},
+	{0x64,0x32d,0x1e13},{0x64,0x331,0x1e0f},{0x65,0x300,0xe8},{0x65,0x301,0xe9},{0x65,0x302,0xea},{0x65,0x303,0x1ebd},
+	{0x65,0x304,0x113},{0x65,0x306,0x115},{0x65,0x307,0x117},{0x65,0x308,0xeb},{0x65,0x309,0x1ebb},{0x65,0x30c,0x11b},
+	{0x65,0x30f,0x205},{0x65,0x311,0x207},{0x65,0x323,0x1eb9},{0x65,0x327,0x229},{0x65,0x328,0x119},{0x65,0x32d,0x1e19},
+	{0x65,0x330,0x1e1b},{0x66,0x307,0x1e1f},{0x67,0x301,0x1f5},{0x67,0x302,0x11d},{0x67,0x304,0x1e21},{0x67,0x306,0x11f},
+	{0x67,0x307,0x121},{0x67,0x30c,0x1e7},{0x67,0x327,0x123},{0x68,0x302,0x125},{0x68,0x307,0x1e23},{0x68,0x308,0x1e27},
+	{0x68,0x30c,0x21f},{0x68,0x323,0x1e25},{0x68,0x327,0x1e29},{0x68,0x32e,0x1e2b},{0x68,0x331,0x1e96},{0x69,0x300,0xec},
+	{0x69,0x301,0xed},{0x69,0x302,0xee},{0x69,0x303,0x129},{0x69,0x304,0x12b},{0x69,0x306,0x12d},{0x69,0x308,0xef},
+	{0x69,0x309,0x1ec9},{0x69,0x30c,0x1d0},{0x69,0x30f,0x209},{0x69,0x311,0x20b},{0x69,0x323,0x1ecb},{0x69,0x328,0x12f},
+	{0x69,0x330,0x1e2d},{0x6a,0x302,0x135},{0x6a,0x30c,0x1f0},{0x6b,0x301,0x1e31},{0x6b,0x30c,0x1e9},{0x6b,0x323,0x1e33},
+	{0x6b,0x327,0x137},{0x6b,0x331,0x1e35},{0x6c,0x301,0x13a},{0x6c,0x30c,0x13e},{0x6c,0x323,0x1e37},{0x6c,0x327,0x13c},
+	{0x6c,0x32d,0x1e3d},{0x6c,0x331,0x1e3b},{0x6d,0x301,0x1e3f},{0x6d,0x307,0x1e41},{0x6d,0x323,0x1e43},{0x6e,0x300,0x1f9},
+	{0x6e,0x301,0x144},{0x6e,0x303,0xf1},{0x6e,0x307,0x1e45},{0x6e,0x30c,0x148},{0x6e,0x323,0x1e47},{0x6e,0x327,0x146},
+	{0x6e,0x32d,0x1e4b},{0x6e,0x331,0x1e49},{0x6f,0x300,0xf2},{0x6f,0x301,0xf3},{0x6f,0x302,0xf4},{0x6f,0x303,0xf5},
+	{0x6f,0x304,0x14d},{0x6f,0x306,0x14f},{0x6f,0x307,0x22f},{0x6f,0x308,0xf6},{0x6f,0x309,0x1ecf},{0x6f,0x30b,0x151},
+	{0x6f,0x30c,0x1d2},{0x6f,0x30f,0x20d},{0x6f,0x311,0x20f},{0x6f,0x31b,0x1a1},{0x6f,0x323,0x1ecd},{0x6f,0x328,0x1eb},
+	{0x70,0x301,0x1e55},{0x70,0x307,0x1e57},{0x72,0x301,0x155},{0x72,0x307,0x1e59},{0x72,0x30c,0x159},{0x72,0x30f,0x211},
+	{0x72,0x311,0x213},{0x72,0x323,0x1e5b},{0x72,0x327,0x157},{0x72,0x331,0x1e5f},{0x73,0x301,0x15b},{0x73,0x302,0x15d},
+	{0x73,0x307,0x1e61},{0x73,0x30c,0x161},{0x73,0x323,0x1e63},{0x73,0x326,0x219},{0x73,0x327,0x15f},{0x74,0x307,0x1e6b},
+	{0x74,0x308,0x1e97},{0x74,0x30c,0x165},{0x74,0x323,0x1e6d},{0x74,0x326,0x21b},{0x74,0x327,0x163},{0x74,0x32d,0x1e71},
+	{0x74,0x331,0x1e6f},{0x75,0x300,0xf9},{0x75,0x301,0xfa},{0x75,0x302,0xfb},{0x75,0x303,0x169},{0x75,0x304,0x16b},
+	{0x75,0x306,0x16d},{0x75,0x308,0xfc},{0x75,0x309,0x1ee7},{0x75,0x30a,0x16f},{0x75,0x30b,0x171},{0x75,0x30c,0x1d4},
+	{0x75,0x30f,0x215},{0x75,0x311,0x217},{0x75,0x31b,0x1b0},{0x75,0x323,0x1ee5},{0x75,0x324,0x1e73},{0x75,0x328,0x173},
+	{0x75,0x32d,0x1e77},{0x75,0x330,0x1e75},{0x76,0x303,0x1e7d},{0x76,0x323,0x1e7f},{0x77,0x300,0x1e81},{0x77,0x301,0x1e83},
+	{0x77,0x302,0x175},{0x77,0x307,0x1e87},{0x77,0x308,0x1e85},{0x77,0x30a,0x1e98},{0x77,0x323,0x1e89},{0x78,0x307,0x1e8b},
+	{0x78,0x308,0x1e8d},{0x79,0x300,0x1ef3},{0x79,0x301,0xfd},{0x79,0x302,0x177},{0x79,0x303,0x1ef9},{0x79,0x304,0x233},
+	{0x79,0x307,0x1e8f},{0x79,0x308,0xff},{0x79,0x309,0x1ef7},{0x79,0x30a,0x1e99},{0x79,0x323,0x1ef5},{0x7a,0x301,0x17a},
+	{0x7a,0x302,0x1e91},{0x7a,0x307,0x17c},{0x7a,0x30c,0x17e},{0x7a,0x323,0x1e93},{0x7a,0x331,0x1e95},{0xa8,0x300,0x1fed},
+	{0xa8,0x301,0x385},{0xa8,0x342,0x1fc1},{0xc2,0x300,0x1ea6},{0xc2,0x301,0x1ea4},{0xc2,0x303,0x1eaa},{0xc2,0x309,0x1ea8},
+	{0xc4,0x304,0x1de},{0xc5,0x301,0x1fa},{0xc6,0x301,0x1fc},{0xc6,0x304,0x1e2},{0xc7,0x301,0x1e08},{0xca,0x300,0x1ec0},
+	{0xca,0x301,0x1ebe},{0xca,0x303,0x1ec4},{0xca,0x309,0x1ec2},{0xcf,0x301,0x1e2e},{0xd4,0x300,0x1ed2},{0xd4,0x301,0x1ed0},
+	{0xd4,0x303,0x1ed6},{0xd4,0x309,0x1ed4},{0xd5,0x301,0x1e4c},{0xd5,0x304,0x22c},{0xd5,0x308,0x1e4e},{0xd6,0x304,0x22a},
+	{0xd8,0x301,0x1fe},{0xdc,0x300,0x1db},{0xdc,0x301,0x1d7},{0xdc,0x304,0x1d5},{0xdc,0x30c,0x1d9},{0xe2,0x300,0x1ea7},
+	{0xe2,0x301,0x1ea5},{0xe2,0x303,0x1eab},{0xe2,0x309,0x1ea9},{0xe4,0x304,0x1df},{0xe5,0x301,0x1fb},{0xe6,0x301,0x1fd},
+	{0xe6,0x304,0x1e3},{0xe7,0x301,0x1e09},{0xea,0x300,0x1ec1},{0xea,0x301,0x1ebf},{0xea,0x303,0x1ec5},{0xea,0x309,0x1ec3},
+	{0xef,0x301,0x1e2f},{0xf4,0x300,0x1ed3},{0xf4,0x301,0x1ed1},{0xf4,0x303,0x1ed7},{0xf4,0x309,0x1ed5},{0xf5,0x301,0x1e4d},
+	{0xf5,0x304,0x22d},{0xf5,0x308,0x1e4f},{0xf6,0x304,0x22b},{0xf8,0x301,0x1ff},{0xfc,0x300,0x1dc},{0xfc,0x301,0x1d8},
+	{0xfc,0x304,0x1d6},{0xfc,0x30c,0x1da},{0x102,0x300,0x1eb0},{0x102,0x301,0x1eae},{0x102,0x303,0x1eb4},{0x102,0x309,0x1eb2},
+	{0x103,0x300,0x1eb1},{0x103,0x301,0x1eaf},{0x103,0x303,0x1eb5},{0x103,0x309,0x1eb3},{0x112,0x300,0x1e14},{0x112,0x301,0x1e16},
+	{0x113,0x300,0x1e15},{0x113,0x301,0x1e17},{0x14c,0x300,0x1e50},{0x14c,0x301,0x1e52},{0x14d,0x300,0x1e51},{0x14d,0x301,0x1e53},
+	{0x15a,0x307,0x1e64},{0x15b,0x307,0x1e65},{0x160,0x307,0x1e66},{0x161,0x307,0x1e67},{0x168,0x301,0x1e78},{0x169,0x301,0x1e79},
+	{0x16a,0x308,0x1e7a},{0x16b,0x308,0x1e7b},{0x17f,0x307,0x1e9b},{0x1a0,0x300,0x1edc},{0x1a0,0x301,0x1eda},{0x1a0,0x303,0x1ee0},
+	{0x1a0,0x309,0x1ede},{0x1a0,0x323,0x1ee2},{0x1a1,0x300,0x1edd},{0x1a1,0x301,0x1edb},{0x1a1,0x303,0x1ee1},{0x1a1,0x309,0x1edf},
+	{0x1a1,0x323,0x1ee3},{0x1af,0x300,0x1eea},{0x1af,0x301,0x1ee8},{0x1af,0x303,0x1eee},{0x1af,0x309,0x1eec},{0x1af,0x323,0x1ef0},
+	{0x1b0,0x300,0x1eeb},{0x1b0,0x301,0x1ee9},{0x1b0,0x303,0x1eef},{0x1b0,0x309,0x1eed},{0x1b0,0x323,0x1ef1},{0x1b7,0x30c,0x1ee},
+	{0x1ea,0x304,0x1ec},{0x1eb,0x304,0x1ed},{0x226,0x304,0x1e0},{0x227,0x304,0x1e1},{0x228,0x306,0x1e1c},{0x229,0x306,0x1e1d},
+	{0x22e,0x304,0x230},{0x22f,0x304,0x231},{0x292,0x30c,0x1ef},{0x391,0x300,0x1fba},{0x391,0x301,0x386},{0x391,0x304,0x1fb9},
+	{0x391,0x306,0x1fb8},{0x391,0x313,0x1f08},{0x391,0x314,0x1f09},{0x391,0x345,0x1fbc},{0x395,0x300,0x1fc8},{0x395,0x301,0x388},
+	{0x395,0x313,0x1f18},{0x395,0x314,0x1f19},{0x397,0x300,0x1fca},{0x397,0x301,0x389},{0x397,0x313,0x1f28},{0x397,0x314,0x1f29},
+	{0x397,0x345,0x1fcc},{0x399,0x300,0x1fda},{0x399,0x301,0x38a},{0x399,0x304,0x1fd9},{0x399,0x306,0x1fd8},{0x399,0x308,0x3aa},
+	{0x399,0x313,0x1f38},{0x399,0x314,0x1f39},{0x39f,0x300,0x1ff8},{0x39f,0x301,0x38c},{0x39f,0x313,0x1f48},{0x39f,0x314,0x1f49},
+	{0x3a1,0x314,0x1fec},{0x3a5,0x300,0x1fea},{0x3a5,0x301,0x38e},{0x3a5,0x304,0x1fe9},{0x3a5,0x306,0x1fe8},{0x3a5,0x308,0x3ab},
+	{0x3a5,0x314,0x1f59},{0x3a9,0x300,0x1ffa},{0x3a9,0x301,0x38f},{0x3a9,0x313,0x1f68},{0x3a9,0x314,0x1f69},{0x3a9,0x345,0x1ffc},
+	{0x3ac,0x345,0x1fb4},{0x3ae,0x345,0x1fc4},{0x3b1,0x300,0x1f70},{0x3b1,0x301,0x3ac},{0x3b1,0x304,0x1fb1},{0x3b1,0x306,0x1fb0},
+	{0x3b1,0x313,0x1f00},{0x3b1,0x314,0x1f01},{0x3b1,0x342,0x1fb6},{0x3b1,0x345,0x1fb3},{0x3b5,0x300,0x1f72},{0x3b5,0x301,0x3ad},
+	{0x3b5,0x313,0x1f10},{0x3b5,0x314,0x1f11},{0x3b7,0x300,0x1f74},{0x3b7,0x301,0x3ae},{0x3b7,0x313,0x1f20},{0x3b7,0x314,0x1f21},
+	{0x3b7,0x342,0x1fc6},{0x3b7,0x345,0x1fc3},{0x3b9,0x300,0x1f76},{0x3b9,0x301,0x3af},{0x3b9,0x304,0x1fd1},{0x3b9,0x306,0x1fd0},
+	{0x3b9,0x308,0x3ca},{0x3b9,0x313,0x1f30},{0x3b9,0x314,0x1f31},{0x3b9,0x342,0x1fd6},{0x3bf,0x300,0x1f78},{0x3bf,0x301,0x3cc},
+	{0x3bf,0x313,0x1f40},{0x3bf,0x314,0x1f41},{0x3c1,0x313,0x1fe4},{0x3c1,0x314,0x1fe5},{0x3c5,0x300,0x1f7a},{0x3c5,0x301,0x3cd},
+	{0x3c5,0x304,0x1fe1},{0x3c5,0x306,0x1fe0},{0x3c5,0x308,0x3cb},{0x3c5,0x313,0x1f50},{0x3c5,0x314,0x1f51},{0x3c5,0x342,0x1fe6},
+	{0x3c9,0x300,0x1f7c},{0x3c9,0x301,0x3ce},{0x3c9,0x313,0x1f60},{0x3c9,0x314,0x1f61},{0x3c9,0x342,0x1ff6},{0x3c9,0x345,0x1ff3},
+	{0x3ca,0x300,0x1fd2},{0x3ca,0x301,0x390},{0x3ca,0x342,0x1fd7},{0x3cb,0x300,0x1fe2},{0x3cb,0x301,0x3b0},{0x3cb,0x342,0x1fe7},
+	{0x3ce,0x345,0x1ff4},{0x3d2,0x301,0x3d3},{0x3d2,0x308,0x3d4},{0x406,0x308,0x407},{0x410,0x306,0x4d0},{0x410,0x308,0x4d2},
+	{0x413,0x301,0x403},{0x415,0x300,0x400},{0x415,0x306,0x4d6},{0x415,0x308,0x401},{0x416,0x306,0x4c1},{0x416,0x308,0x4dc},
+	{0x417,0x308,0x4de},{0x418,0x300,0x40d},{0x418,0x304,0x4e2},{0x418,0x306,0x419},{0x418,0x308,0x4e4},{0x41a,0x301,0x40c},
+	{0x41e,0x308,0x4e6},{0x423,0x304,0x4ee},{0x423,0x306,0x40e},{0x423,0x308,0x4f0},{0x423,0x30b,0x4f2},{0x427,0x308,0x4f4},
+	{0x42b,0x308,0x4f8},{0x42d,0x308,0x4ec},{0x430,0x306,0x4d1},{0x430,0x308,0x4d3},{0x433,0x301,0x453},{0x435,0x300,0x450},
+	{0x435,0x306,0x4d7},{0x435,0x308,0x451},{0x436,0x306,0x4c2},{0x436,0x308,0x4dd},{0x437,0x308,0x4df},{0x438,0x300,0x45d},
+	{0x438,0x304,0x4e3},{0x438,0x306,0x439},{0x438,0x308,0x4e5},{0x43a,0x301,0x45c},{0x43e,0x308,0x4e7},{0x443,0x304,0x4ef},
+	{0x443,0x306,0x45e},{0x443,0x308,0x4f1},{0x443,0x30b,0x4f3},{0x447,0x308,0x4f5},{0x44b,0x308,0x4f9},{0x44d,0x308,0x4ed},
+	{0x456,0x308,0x457},{0x474,0x30f,0x476},{0x475,0x30f,0x477},{0x4d8,0x308,0x4da},{0x4d9,0x308,0x4db},{0x4e8,0x308,0x4ea},
+	{0x4e9,0x308,0x4eb},{0x627,0x653,0x622},{0x627,0x654,0x623},{0x627,0x655,0x625},{0x648,0x654,0x624},{0x64a,0x654,0x626},
+	{0x6c1,0x654,0x6c2},{0x6d2,0x654,0x6d3},{0x6d5,0x654,0x6c0},{0x928,0x93c,0x929},{0x930,0x93c,0x931},{0x933,0x93c,0x934},
+	{0x9c7,0x9be,0x9cb},{0x9c7,0x9d7,0x9cc},{0xb47,0xb3e,0xb4b},{0xb47,0xb56,0xb48},{0xb47,0xb57,0xb4c},{0xb92,0xbd7,0xb94},
+	{0xbc6,0xbbe,0xbca},{0xbc6,0xbd7,0xbcc},{0xbc7,0xbbe,0xbcb},{0xc46,0xc56,0xc48},{0xcbf,0xcd5,0xcc0},{0xcc6,0xcc2,0xcca},
+	{0xcc6,0xcd5,0xcc7},{0xcc6,0xcd6,0xcc8},{0xcca,0xcd5,0xccb},{0xd46,0xd3e,0xd4a},{0xd46,0xd57,0xd4c},{0xd47,0xd3e,0xd4b},
+	{0xdd9,0xdca,0xdda},{0xdd9,0xdcf,0xddc},{0xdd9,0xddf,0xdde},{0xddc,0xdca,0xddd},{0x1025,0x102e,0x1026},{0x1b05,0x1b35,0x1b06},
+	{0x1b07,0x1b35,0x1b08},{0x1b09,0x1b35,0x1b0a},{0x1b0b,0x1b35,0x1b0c},{0x1b0d,0x1b35,0x1b0e},{0x1b11,0x1b35,0x1b12},{0x1b3a,0x1b35,0x1b3b},
+	{0x1b3c,0x1b35,0x1b3d},{0x1b3e,0x1b35,0x1b40},{0x1b3f,0x1b35,0x1b41},{0x1b42,0x1b35,0x1b43},{0x1e36,0x304,0x1e38},{0x1e37,0x304,0x1e39},
+	{0x1e5a,0x304,0x1e5c},{0x1e5b,0x304,0x1e5d},{0x1e62,0x307,0x1e68},{0x1e63,0x307,0x1e69},{0x1ea0,0x302,0x1eac},{0x1ea0,0x306,0x1eb6},
+	{0x1ea1,0x302,0x1ead},{0x1ea1,0x306,0x1eb7},{0x1eb8,0x302,0x1ec6},{0x1eb9,0x302,0x1ec7},{0x1ecc,0x302,0x1ed8},{0x1ecd,0x302,0x1ed9},
+	{0x1f00,0x300,0x1f02},{0x1f00,0x301,0x1f04},{0x1f00,0x342,0x1f06},{0x1f00,0x345,0x1f80},{0x1f01,0x300,0x1f03},{0x1f01,0x301,0x1f05},
+	{0x1f01,0x342,0x1f07},{0x1f01,0x345,0x1f81},{0x1f02,0x345,0x1f82},{0x1f03,0x345,0x1f83},{0x1f04,0x345,0x1f84},{0x1f05,0x345,0x1f85},
+	{0x1f06,0x345,0x1f86},{0x1f07,0x345,0x1f87},{0x1f08,0x300,0x1f0a},{0x1f08,0x301,0x1f0c},{0x1f08,0x342,0x1f0e},{0x1f08,0x345,0x1f88},
+	{0x1f09,0x300,0x1f0b},{0x1f09,0x301,0x1f0d},{0x1f09,0x342,0x1f0f},{0x1f09,0x345,0x1f89},{0x1f0a,0x345,0x1f8a},{0x1f0b,0x345,0x1f8b},
+	{0x1f0c,0x345,0x1f8c},{0x1f0d,0x345,0x1f8d},{0x1f0e,0x345,0x1f8e},{0x1f0f,0x345,0x1f8f},{0x1f10,0x300,0x1f12},{0x1f10,0x301,0x1f14},
+	{0x1f11,0x300,0x1f13},{0x1f11,0x301,0x1f15},{0x1f18,0x300,0x1f1a},{0x1f18,0x301,0x1f1c},{0x1f19,0x300,0x1f1b},{0x1f19,0x301,0x1f1d},
+	{0x1f20,0x300,0x1f22},{0x1f20,0x301,0x1f24},{0x1f20,0x342,0x1f26},{0x1f20,0x345,0x1f90},{0x1f21,0x300,0x1f23},{0x1f21,0x301,0x1f25},
+	{0x1f21,0x342,0x1f27},{0x1f21,0x345,0x1f91},{0x1f22,0x345,0x1f92},{0x1f23,0x345,0x1f93},{0x1f24,0x345,0x1f94},{0x1f25,0x345,0x1f95},
+	{0x1f26,0x345,0x1f96},{0x1f27,0x345,0x1f97},{0x1f28,0x300,0x1f2a},{0x1f28,0x301,0x1f2c},{0x1f28,0x342,0x1f2e},{0x1f28,0x345,0x1f98},
+	{0x1f29,0x300,0x1f2b},{0x1f29,0x301,0x1f2d},{0x1f29,0x342,0x1f2f},{0x1f29,0x345,0x1f99},{0x1f2a,0x345,0x1f9a},{0x1f2b,0x345,0x1f9b},
+	{0x1f2c,0x345,0x1f9c},{0x1f2d,0x345,0x1f9d},{0x1f2e,0x345,0x1f9e},{0x1f2f,0x345,0x1f9f},{0x1f30,0x300,0x1f32},{0x1f30,0x301,0x1f34},
+	{0x1f30,0x342,0x1f36},{0x1f31,0x300,0x1f33},{0x1f31,0x301,0x1f35},{0x1f31,0x342,0x1f37},{0x1f38,0x300,0x1f3a},{0x1f38,0x301,0x1f3c},
+	{0x1f38,0x342,0x1f3e},{0x1f39,0x300,0x1f3b},{0x1f39,0x301,0x1f3d},{0x1f39,0x342,0x1f3f},{0x1f40,0x300,0x1f42},{0x1f40,0x301,0x1f44},
+	{0x1f41,0x300,0x1f43},{0x1f41,0x301,0x1f45},{0x1f48,0x300,0x1f4a},{0x1f48,0x301,0x1f4c},{0x1f49,0x300,0x1f4b},{0x1f49,0x301,0x1f4d},
+	{0x1f50,0x300,0x1f52},{0x1f50,0x301,0x1f54},{0x1f50,0x342,0x1f56},{0x1f51,0x300,0x1f53},{0x1f51,0x301,0x1f55},{0x1f51,0x342,0x1f57},
+	{0x1f59,0x300,0x1f5b},{0x1f59,0x301,0x1f5d},{0x1f59,0x342,0x1f5f},{0x1f60,0x300,0x1f62},{0x1f60,0x301,0x1f64},{0x1f60,0x342,0x1f66},
+	{0x1f60,0x345,0x1fa0},{0x1f61,0x300,0x1f63},{0x1f61,0x301,0x1f65},{0x1f61,0x342,0x1f67},{0x1f61,0x345,0x1fa1},{0x1f62,0x345,0x1fa2},
+	{0x1f63,0x345,0x1fa3},{0x1f64,0x345,0x1fa4},{0x1f65,0x345,0x1fa5},{0x1f66,0x345,0x1fa6},{0x1f67,0x345,0x1fa7},{0x1f68,0x300,0x1f6a},
+	{0x1f68,0x301,0x1f6c},{0x1f68,0x342,0x1f6e},{0x1f68,0x345,0x1fa8},{0x1f69,0x300,0x1f6b},{0x1f69,0x301,0x1f6d},{0x1f69,0x342,0x1f6f},
+	{0x1f69,0x345,0x1fa9},{0x1f6a,0x345,0x1faa},{0x1f6b,0x345,0x1fab},{0x1f6c,0x345,0x1fac},{0x1f6d,0x345,0x1fad},{0x1f6e,0x345,0x1fae},
+	{0x1f6f,0x345,0x1faf},{0x1f70,0x345,0x1fb2},{0x1f74,0x345,0x1fc2},{0x1f7c,0x345,0x1ff2},{0x1fb6,0x345,0x1fb7},{0x1fbf,0x300,0x1fcd},
+	{0x1fbf,0x301,0x1fce},{0x1fbf,0x342,0x1fcf},{0x1fc6,0x345,0x1fc7},{0x1ff6,0x345,0x1ff7},{0x1ffe,0x300,0x1fdd},{0x1ffe,0x301,0x1fde},
+	{0x1ffe,0x342,0x1fdf},{0x2190,0x338,0x219a},{0x2192,0x338,0x219b},{0x2194,0x338,0x21ae},{0x21d0,0x338,0x21cd},{0x21d2,0x338,0x21cf},
+	{0x21d4,0x338,0x21ce},{0x2203,0x338,0x2204},{0x2208,0x338,0x2209},{0x220b,0x338,0x220c},{0x2223,0x338,0x2224},{0x2225,0x338,0x2226},
+	{0x223c,0x338,0x2241},{0x2243,0x338,0x2244},{0x2245,0x338,0x2247},{0x2248,0x338,0x2249},{0x224d,0x338,0x226d},{0x2261,0x338,0x2262},
+	{0x2264,0x338,0x2270},{0x2265,0x338,0x2271},{0x2272,0x338,0x2274},{0x2273,0x338,0x2275},{0x2276,0x338,0x2278},{0x2277,0x338,0x2279},
+	{0x227a,0x338,0x2280},{0x227b,0x338,0x2281},{0x227c,0x338,0x22e0},{0x227d,0x338,0x22e1},{0x2282,0x338,0x2284},{0x2283,0x338,0x2285},
+	{0x2286,0x338,0x2288},{0x2287,0x338,0x2289},{0x2291,0x338,0x22e2},{0x2292,0x338,0x22e3},{0x22a2,0x338,0x22ac},{0x22a8,0x338,0x22ad},
+	{0x22a9,0x338,0x22ae},{0x22ab,0x338,0x22af},{0x22b2,0x338,0x22ea},{0x22b3,0x338,0x22eb},{0x22b4,0x338,0x22ec},{0x22b5,0x338,0x22ed},
+	{0x3046,0x3099,0x3094},{0x304b,0x3099,0x304c},{0x304d,0x3099,0x304e},{0x304f,0x3099,0x3050},{0x3051,0x3099,0x3052},{0x3053,0x3099,0x3054},
+	{0x3055,0x3099,0x3056},{0x3057,0x3099,0x3058},{0x3059,0x3099,0x305a},{0x305b,0x3099,0x305c},{0x305d,0x3099,0x305e},{0x305f,0x3099,0x3060},
+	{0x3061,0x3099,0x3062},{0x3064,0x3099,0x3065},{0x3066,0x3099,0x3067},{0x3068,0x3099,0x3069},{0x306f,0x3099,0x3070},{0x306f,0x309a,0x3071},
+	{0x3072,0x3099,0x3073},{0x3072,0x309a,0x3074},{0x3075,0x3099,0x3076},{0x3075,0x309a,0x3077},{0x3078,0x3099,0x3079},{0x3078,0x309a,0x307a},
+	{0x307b,0x3099,0x307c},{0x307b,0x309a,0x307d},{0x309d,0x3099,0x309e},{0x30a6,0x3099,0x30f4},{0x30ab,0x3099,0x30ac},{0x30ad,0x3099,0x30ae},
+	{0x30af,0x3099,0x30b0},{0x30b1,0x3099,0x30b2},{0x30b3,0x3099,0x30b4},{0x30b5,0x3099,0x30b6},{0x30b7,0x3099,0x30b8},{0x30b9,0x3099,0x30ba},
+	{0x30bb,0x3099,0x30bc},{0x30bd,0x3099,0x30be},{0x30bf,0x3099,0x30c0},{0x30c1,0x3099,0x30c2},{0x30c4,0x3099,0x30c5},{0x30c6,0x3099,0x30c7},
+	{0x30c8,0x3099,0x30c9},{0x30cf,0x3099,0x30d0},{0x30cf,0x309a,0x30d1},{0x30d2,0x3099,0x30d3},{0x30d2,0x309a,0x30d4},{0x30d5,0x3099,0x30d6},
+	{0x30d5,0x309a,0x30d7},{0x30d8,0x3099,0x30d9},{0x30d8,0x309a,0x30da},{0x30db,0x3099,0x30dc},{0x30db,0x309a,0x30dd},{0x30ef,0x3099,0x30f7},
+	{0x30f0,0x3099,0x30f8},{0x30f1,0x3099,0x30f9},{0x30f2,0x3099,0x30fa},{0x30fd,0x3099,0x30fe},{0x11099,0x110ba,0x1109a},{0x1109b,0x110ba,0x1109c},
+	{0x110a5,0x110ba,0x110ab},{0x11131,0x11127,0x1112e},{0x11132,0x11127,0x1112f},{0x11347,0x1133e,0x1134b},{0x11347,0x11357,0x1134c},{0x114b9,0x114b0,0x114bc},
+	{0x114b9,0x114ba,0x114bb},{0x114b9,0x114bd,0x114be},{0x115b8,0x115af,0x115ba},{0x115b9,0x115af,0x115bb},{0x11935,0x11930,0x11938},
+};
+
+} // namespace strings::detail::normalization
@@ -0,0 +1,302 @@
+#pragma once
+
+#include "join.hpp"
+#include "split.hpp"
+#include <algorithm>
+#include <charconv>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace strings {
+
+namespace detail {
+
+inline auto default_thread_count() -> std::size_t
+{
+    auto const n = std::thread::hardware_concurrency();
+    return n ? n : 1;
+}
+
+// parallel_for calls f(i) for each i in [0, n) on up to the specified number
+// of threads, the calling thread included
+//
+// - indices are handed out in increasing order as the threads become free
+// - the first exception thrown by f is rethrown once all the threads are
+//   joined, the indices that have not started by then are skipped
+//
+template <typename F> void parallel_for(std::size_t n, std::size_t threads, F const& f)
+{
+    threads = std::min(threads ? threads : default_thread_count(), n);
+    if (threads <= 1) {
+        for (auto i = std::size_t{0}; i < n; ++i)
+            f(i);
+        return;
+    }
+
+    auto next = std::atomic<std::size_t>{0};
+    auto failed = std::atomic<bool>{false};
+    auto error = std::exception_ptr{};
+    auto error_mutex = std::mutex{};
+
+    auto fail = [&](std::exception_ptr e) {
+        auto lock = std::lock_guard{error_mutex};
+        if (!error)
+            error = e;
+        failed = true;
+    };
+
+    auto work = [&] {
+        for (auto i = next++; i < n && !failed; i = next++) {
+            try {
+                f(i);
+            }
+            catch (...) {
+                fail(std::current_exception());
+            }
+        }
+    };
+
+    auto pool = std::vector<std::thread>{};
+    pool.reserve(threads - 1);
+    try {
+        while (pool.size() < threads - 1)
+            pool.emplace_back(work);
+    }
+    catch (...) {
+        fail(std::current_exception());
+    }
+    work();
+    for (auto& t : pool)
+        t.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+// min_split_chunk_size is the smallest input portion worth a separate task
+constexpr std::size_t min_split_chunk_size = 256 * 1024;
+
+// has_border returns true if a proper prefix of s is also its suffix, such
+// separators may overlap with themselves ("aa" in "aaa")
+template <typename U> auto has_border(std::basic_string_view<U> s) -> bool
+{
+    for (auto k = std::size_t{1}; k < s.size(); ++k)
+        if (s.substr(0, k) == s.substr(s.size() - k))
+            return true;
+    return false;
+}
+
+// split_chunks partitions the input at the separator occurrences closest to
+// the evenly spaced targets; returns the separators that end the chunks
+// except for the last one
+//
+// every occurrence must be a split point, which is the case for separators
+// that cannot overlap with themselves
+//
+template <typename U, typename Separator>
+auto split_chunks(std::basic_string_view<U> input, Separator const& sep, std::size_t chunks)
+    -> std::vector<separator_match>
+{
+    auto cuts = std::vector<separator_match>{};
+    auto from = std::size_t{0};
+    for (auto k = std::size_t{1}; k < chunks; ++k) {
+        auto const target = std::max(from, input.size() / chunks * k);
+        auto st = typename Separator::state_type{};
+        auto const m = sep.find(input, target, st);
+        if (!m)
+            break;
+        cuts.push_back(*m);
+        from = m->pos + m->size;
+    }
+    return cuts;
+}
+
+template <typename U, typename Separator, typename F>
+auto parallel_split(std::basic_string_view<U> input, Separator const& sep, bool can_partition, F const& f,
+    std::size_t threads) -> std::size_t
+{
+    using view_type = split_view<U, Separator>;
+
+    if (!threads)
+        threads = default_thread_count();
+    auto const chunks = can_partition ? std::min(threads * 4, input.size() / min_split_chunk_size) : 0;
+    if (chunks <= 1 || threads == 1) {
+        auto const n = sep.count(input) + 1;
+        f(std::size_t{0}, view_type{input, sep});
+        return n;
+    }
+
+    auto const cuts = split_chunks(input, sep, chunks);
+    auto chunk = [&](std::size_t k) {
+        auto const first = k ? cuts[k - 1].pos + cuts[k - 1].size : 0;
+        auto const last = k < cuts.size() ? cuts[k].pos : input.size();
+        return input.substr(first, last - first);
+    };
+
+    // the first pass counts the segments of each chunk, the second one hands
+    // the chunks out with the global index of their first segment
+    auto first_index = std::vector<std::size_t>(cuts.size() + 2, 0);
+    parallel_for(cuts.size() + 1, threads, [&](std::size_t k) {
+        first_index[k + 1] = sep.count(chunk(k)) + 1;
+    });
+    for (auto k = std::size_t{1}; k < first_index.size(); ++k)
+        first_index[k] += first_index[k - 1];
+
+    parallel_for(cuts.size() + 1, threads, [&](std::size_t k) { f(first_index[k], view_type{chunk(k), sep}); });
+    return first_index.back();
+}
+
+// min_join_chunk_size is the smallest number of strings worth a separate task
+constexpr std::size_t min_join_chunk_size = 16 * 1024;
+
+// join_chunks splits the strings into evenly sized chunks of elements
+inline auto join_chunks(std::size_t count, std::size_t threads) -> std::size_t
+{
+    return std::max(std::size_t{1}, std::min(threads * 4, count / min_join_chunk_size));
+}
+
+// join_offsets returns the output offset of each chunk of strings, and the
+// total output size as the last element; each string is preceded by the
+// separator except for the first one
+template <typename U, typename R>
+auto join_offsets(R&& strs, std::size_t sep_size, std::size_t chunks, std::size_t threads)
+    -> std::vector<std::size_t>
+{
+    auto const n = std::size_t(std::ranges::size(strs));
+    auto const it = std::ranges::begin(strs);
+    auto offsets = std::vector<std::size_t>(chunks + 1, 0);
+    parallel_for(chunks, threads, [&](std::size_t k) {
+        auto const first = n * k / chunks;
+        auto const last = n * (k + 1) / chunks;
+        auto size = std::size_t{0};
+        for (auto i = first; i != last; ++i)
+            size += std::basic_string_view<U>(it[i]).size();
+        offsets[k + 1] = size + (last - first) * sep_size - (k == 0 && first != last ? sep_size : 0);
+    });
+    for (auto k = std::size_t{1}; k <= chunks; ++k)
+        offsets[k] += offsets[k - 1];
+    return offsets;
+}
+
+// join_copy copies the chunks of strings into the disjoint regions of out
+// given by the offsets
+template <typename U, typename R>
+void join_copy(R&& strs, std::basic_string_view<U> sep, std::vector<std::size_t> const& offsets, U* out,
+    std::size_t threads)
+{
+    auto const n = std::size_t(std::ranges::size(strs));
+    auto const it = std::ranges::begin(strs);
+    auto const chunks = offsets.size() - 1;
+    parallel_for(chunks, threads, [&](std::size_t k) {
+        auto p = out + offsets[k];
+        for (auto i = n * k / chunks, last = n * (k + 1) / chunks; i != last; ++i) {
+            if (i)
+                p = std::copy(sep.begin(), sep.end(), p);
+            auto const sv = std::basic_string_view<U>(it[i]);
+            p = std::copy(sv.begin(), sv.end(), p);
+        }
+    });
+}
+
+} // namespace detail
+
+// parallel_split - splits a large input in chunks processed concurrently
+//
+// - the input is partitioned at separator occurrences into roughly equal
+//   chunks, several per thread; inputs smaller than a few hundred KB, and
+//   separators that may overlap with themselves, are processed as a single
+//   chunk on the calling thread
+// - f(first_index, segments) is called once per chunk, from any thread and
+//   in no particular order; segments is a split_view over the chunk, and
+//   first_index is the global index of its first segment, so that results
+//   can be reassembled in input order
+// - segments are the same as the ones produced by split
+// - threads = 0 uses std::thread::hardware_concurrency()
+// - returns the total number of segments
+// - an exception thrown by f stops handing out chunks and is rethrown
+//
+//   parallel_split(mapped, '\n', [&](std::size_t first, auto lines) {
+//       auto index = first;
+//       for (auto line : lines)
+//           process(index++, line);
+//   });
+//
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto parallel_split(Input const& input, std::type_identity_t<U> separator,
+    std::invocable<std::size_t, split_view<U>> auto&& f, std::size_t threads = 0) -> std::size_t
+{
+    return detail::parallel_split(
+        std::basic_string_view<U>(input), detail::literal_separator<U>{separator}, true, f, threads);
+}
+
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto parallel_split(Input const& input, std::type_identity_t<std::basic_string_view<U>> separator,
+    std::invocable<std::size_t, split_view<U>> auto&& f, std::size_t threads = 0) -> std::size_t
+{
+    return detail::parallel_split(std::basic_string_view<U>(input), detail::literal_separator<U>{separator},
+        !detail::has_border(separator), f, threads);
+}
+
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto parallel_split(Input const& input, any_char_separator<U> const& separator,
+    std::invocable<std::size_t, split_view<U, any_char_separator<U>>> auto&& f, std::size_t threads = 0)
+    -> std::size_t
+{
+    return detail::parallel_split(std::basic_string_view<U>(input), separator, true, f, threads);
+}
+
+// parallel_join - join(strs, sep) that copies the strings on several threads
+//
+// - the sizes of the strings are summed per chunk in parallel, then each
+//   chunk is copied into its own region of the output, so the output is the
+//   same as with join regardless of the scheduling
+// - collections smaller than a few tens of thousands of strings are joined
+//   on the calling thread
+// - threads = 0 uses std::thread::hardware_concurrency()
+//
+template <std::ranges::random_access_range R, typename U = codeunit_type_of<std::ranges::range_value_t<R>>>
+requires std::ranges::sized_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, std::basic_string_view<U>>
+auto parallel_join(R&& strs, std::type_identity_t<std::basic_string_view<U>> sep, std::size_t threads = 0)
+    -> std::basic_string<U>
+{
+    if (!threads)
+        threads = detail::default_thread_count();
+    auto const chunks = detail::join_chunks(std::size_t(std::ranges::size(strs)), threads);
+    auto const offsets = detail::join_offsets<U>(strs, sep.size(), chunks, threads);
+    auto ret = std::basic_string<U>(offsets.back(), U{});
+    detail::join_copy<U>(strs, sep, offsets, ret.data(), threads);
+    return ret;
+}
+
+// parallel_join_to - parallel_join into a preallocated (e.g. memory mapped)
+// buffer [first, last), see joined_size
+//
+// returns std::errc::value_too_large without writing anything if the output
+// does not fit
+//
+template <std::ranges::random_access_range R>
+requires std::ranges::sized_range<R> && std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>
+auto parallel_join_to(char* first, char* last, R&& strs, std::string_view sep, std::size_t threads = 0)
+    -> std::to_chars_result
+{
+    if (!threads)
+        threads = detail::default_thread_count();
+    auto const chunks = detail::join_chunks(std::size_t(std::ranges::size(strs)), threads);
+    auto const offsets = detail::join_offsets<char>(strs, sep.size(), chunks, threads);
+    if (offsets.back() > std::size_t(last - first))
+        return {last, std::errc::value_too_large};
+    detail::join_copy<char>(strs, sep, offsets, first, threads);
+    return {first + offsets.back(), std::errc{}};
+}
+
+} // namespace strings
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "ascii.hpp"
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+namespace strings {
+
+namespace detail {
+
+// is_eight_digits returns true if the 8 bytes packed into v (little-endian) are
+// all in ['0'..'9']
+constexpr auto is_eight_digits(std::uint64_t v) -> bool
+{
+    return ((v & 0xF0F0F0F0F0F0F0F0u) | (((v + 0x0606060606060606u) & 0xF0F0F0F0F0F0F0F0u) >> 4)) ==
+           0x3333333333333333u;
+}
+
+// eight_digits_value converts 8 packed (little-endian) ascii digits into their
+// value with three multiplications, combining adjacent digit pairs, then
+// quads, then octets
+constexpr auto eight_digits_value(std::uint64_t v) -> std::uint32_t
+{
+    v = (v & 0x0F0F0F0F0F0F0F0Fu) * 2561 >> 8;
+    v = (v & 0x00FF00FF00FF00FFu) * 6553601 >> 16;
+    return std::uint32_t((v & 0x0000FFFF0000FFFFu) * 42949672960001u >> 32);
+}
+
+inline auto load_eight(char const* p) -> std::uint64_t
+{
+    auto v = std::uint64_t{};
+    if constexpr (std::endian::native == std::endian::little)
+        std::memcpy(&v, p, sizeof(v));
+    else
+        for (auto i = 8; i--;)
+            v = v << 8 | std::uint8_t(p[i]);
+    return v;
+}
+
+// parse_digits accumulates the decimal digits at [first, last) into v,
+// consuming 8 digits per step while possible; returns the position of the
+// first non-digit, sets overflow if the value does not fit into uint64_t
+inline auto parse_digits(char const* first, char const* last, std::uint64_t& v, bool& overflow) -> char const*
+{
+    constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+    while (last - first >= 8) {
+        auto const w = load_eight(first);
+        if (!is_eight_digits(w))
+            break;
+        auto const d = eight_digits_value(w);
+        if (v > (max - d) / 100000000u)
+            overflow = true;
+        v = v * 100000000u + d;
+        first += 8;
+    }
+    for (; first != last; ++first) {
+        auto const d = ascii::decimal(unsigned(*first));
+        if (d >= 10)
+            break;
+        if (v > (max - d) / 10)
+            overflow = true;
+        v = v * 10 + d;
+    }
+    return first;
+}
+
+} // namespace detail
+
+// parse_integer parses an optionally signed decimal integer at [first, last)
+//
+// - behaves like std::from_chars, but also accepts a leading '+'
+// - digits are converted 8 at a time when the input allows it
+//
+inline auto parse_integer(char const* first, char const* last, std::int64_t& value) -> std::from_chars_result
+{
+    auto p = first;
+    auto neg = false;
+    if (p != last && (*p == '-' || *p == '+'))
+        neg = *p++ == '-';
+
+    auto u = std::uint64_t{0};
+    auto overflow = false;
+    auto const digits_end = detail::parse_digits(p, last, u, overflow);
+    if (digits_end == p)
+        return {first, std::errc::invalid_argument};
+
+    constexpr auto limit = std::uint64_t(std::numeric_limits<std::int64_t>::max());
+    if (overflow || u > limit + neg)
+        return {digits_end, std::errc::result_out_of_range};
+
+    value = neg ? std::int64_t(0 - u) : std::int64_t(u);
+    return {digits_end, std::errc{}};
+}
+
+inline auto parse_integer(std::string_view s, std::int64_t& value) -> std::from_chars_result
+{
+    return parse_integer(s.data(), s.data() + s.size(), value);
+}
+
+struct parse_integers_result {
+    std::size_t count = 0; // number of values written into the output
+    char const* ptr = nullptr; // end of the parsed input, or position of the error
+    std::errc ec = {};
+};
+
+// parse_integers parses a separator-delimited list of decimal integers, such
+// as "12,-5,+7", into out
+//
+// - an empty input produces no values
+// - each field must be a complete integer, empty fields are not allowed
+// - on error, ptr refers to the offending character, and count holds the
+//   number of values parsed so far
+// - returns std::errc::value_too_large with ptr at the start of the next
+//   field if out is exhausted before the input
+//
+inline auto parse_integers(std::string_view s, char separator, std::span<std::int64_t> out)
+    -> parse_integers_result
+{
+    auto first = s.data();
+    auto const last = first + s.size();
+    auto ret = parse_integers_result{0, first, std::errc{}};
+    if (first == last)
+        return ret;
+
+    while (true) {
+        if (ret.count == out.size())
+            return {ret.count, first, std::errc::value_too_large};
+
+        auto r = parse_integer(first, last, out[ret.count]);
+        if (r.ec != std::errc{})
+            return {ret.count, r.ptr, r.ec};
+        ++ret.count;
+
+        if (r.ptr == last)
+            return {ret.count, last, std::errc{}};
+        if (*r.ptr != separator)
+            return {ret.count - 1, r.ptr, std::errc::invalid_argument};
+        first = r.ptr + 1;
+    }
+}
+
+} // namespace strings
@@ -1,8 +1,18 @@
 #pragma once
 
+#include "aho_corasick.hpp"
+#include "builder.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <initializer_list>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <vector>
 
 namespace strings {
 
@@ -22,35 +32,411 @@ struct replacement_pair_view {
     std::string_view new_content;
 };
 
+namespace detail {
+
+// the number of wildcards up to which replace_all searches them one by one
+constexpr std::size_t direct_search_limit = 8;
+
+struct wildcard_match {
+    std::size_t pos;
+    std::size_t size;
+    std::string_view new_content;
+};
+
+// direct_wildcard_finder locates the leftmost of a few wildcards, among the
+// wildcards that start at the same position the one listed first wins
+//
+// each wildcard remembers where it occurs next, and is searched again only
+// once the scan passes that position
+//
+class direct_wildcard_finder {
+public:
+    direct_wildcard_finder(std::string_view input, std::initializer_list<replacement_pair_view> replacements)
+        : input_{input}
+        , replacements_(replacements)
+    {
+        for (auto i = std::size_t{0}; auto const& r : replacements)
+            next_[i++] = r.wildcard.empty() ? npos : input.find(r.wildcard);
+    }
+
+    auto operator()(std::size_t start) -> std::optional<wildcard_match>
+    {
+        auto rep = replacements_.end();
+        auto pos = npos;
+        auto i = std::size_t{0};
+        for (auto it = replacements_.begin(); it != replacements_.end(); ++it, ++i) {
+            if (next_[i] < start)
+                next_[i] = input_.find(it->wildcard, start);
+            if (next_[i] < pos) {
+                rep = it;
+                pos = next_[i];
+            }
+        }
+        if (rep == replacements_.end())
+            return {};
+        return wildcard_match{pos, rep->wildcard.size(), rep->new_content};
+    }
+
+private:
+    static constexpr auto npos = std::string_view::npos;
+
+    std::string_view input_;
+    std::initializer_list<replacement_pair_view> replacements_;
+    std::size_t next_[direct_search_limit];
+};
+
+// replace_matches builds the input with the matches reported by
+// find(start) replaced
+template <typename Find> auto replace_matches(std::string_view input, Find&& find) -> std::string
+{
+    auto ret = std::string{};
+    ret.reserve(input.size());
+    auto start = std::size_t{0};
+    while (auto m = find(start)) {
+        ret.append(input.data() + start, m->pos - start);
+        ret += m->new_content;
+        start = m->pos + m->size;
+    }
+    ret.append(input.data() + start, input.size() - start);
+    return ret;
+}
+
+// replace_matches_in_place replaces the matches in s, returns their number
+//
+// if no content is longer than its wildcard, the content is compacted towards
+// the front in a single pass, the writes stay behind the scanned position;
+// otherwise the result is built in a new string
+//
+template <typename Find>
+auto replace_matches_in_place(std::string& s, bool shrinking, Find&& find) -> std::size_t
+{
+    auto count = std::size_t{0};
+    if (!shrinking) {
+        auto r = replace_matches(s, [&](std::size_t start) {
+            auto m = find(start);
+            count += m.has_value();
+            return m;
+        });
+        if (count)
+            s = std::move(r);
+        return count;
+    }
+
+    auto const data = s.data();
+    auto out = std::size_t{0};
+    auto start = std::size_t{0};
+    while (auto m = find(start)) {
+        std::memmove(data + out, data + start, m->pos - start);
+        out += m->pos - start;
+        std::memmove(data + out, m->new_content.data(), m->new_content.size());
+        out += m->new_content.size();
+        start = m->pos + m->size;
+        ++count;
+    }
+    if (count) {
+        std::memmove(data + out, data + start, s.size() - start);
+        s.resize(out + s.size() - start);
+    }
+    return count;
+}
+
+// write_sliced writes sv in pieces that fit into the writer's storage, so
+// that chunked writers pass long literal runs through without growing
+inline auto write_sliced(writer& w, std::string_view sv) -> std::errc
+{
+    while (!sv.empty()) {
+        auto const n = std::min(sv.size(), std::max({w.remaining(), w.capacity(), std::size_t{1}}));
+        if (auto ec = w.write(sv.substr(0, n)); ec != std::errc{})
+            return ec;
+        sv.remove_prefix(n);
+    }
+    return std::errc{};
+}
+
+// replace_matches_to writes the input with the matches replaced to w
+template <typename Find> auto replace_matches_to(std::string_view input, writer& w, Find&& find) -> std::errc
+{
+    auto start = std::size_t{0};
+    while (auto m = find(start)) {
+        if (auto ec = write_sliced(w, input.substr(start, m->pos - start)); ec != std::errc{})
+            return ec;
+        if (auto ec = write_sliced(w, m->new_content); ec != std::errc{})
+            return ec;
+        start = m->pos + m->size;
+    }
+    return write_sliced(w, input.substr(start));
+}
+
+} // namespace detail
+
+// replace_in_place - replaces the first occurrence of wildcard in s with
+// new_content, returns false if there is none
+//
+// the tail is shifted once, s is reallocated only if the grown content
+// exceeds its capacity
+//
+inline auto replace_in_place(std::string& s, std::string_view wildcard, std::string_view new_content) -> bool
+{
+    auto const pos = s.find(wildcard);
+    if (pos == std::string::npos)
+        return false;
+    s.replace(pos, wildcard.size(), new_content);
+    return true;
+}
+
+// multi_replacer substitutes a set of wildcards in a single pass over the
+// input
+//
+// - compiled once into an aho_corasick automaton, then applied to any number
+//   of inputs in linear time regardless of the number of wildcards
+// - the leftmost wildcard is replaced first, kind selects among the wildcards
+//   that start at the same position
+// - the replacement contents are copied, the wildcards are not retained
+// - empty wildcards never match
+//
+//   auto const r = multi_replacer{{"${name}", name}, {"${host}", host}};
+//   for (auto const& doc : docs)
+//       out.push_back(r.replace_all(doc));
+//
+class multi_replacer {
+public:
+    multi_replacer(std::initializer_list<replacement_pair_view> replacements,
+        match_kind kind = match_kind::leftmost_longest)
+        : multi_replacer{std::ranges::subrange(replacements.begin(), replacements.end()), kind}
+    {
+    }
+
+    template <std::ranges::forward_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, replacement_pair_view>
+    explicit multi_replacer(R const& replacements, match_kind kind = match_kind::leftmost_longest)
+        : ac_{replacements | std::views::transform([](replacement_pair_view const& r) { return r.wildcard; })}
+        , kind_{kind}
+    {
+        for (replacement_pair_view r : replacements) {
+            contents_.emplace_back(r.new_content);
+            shrinking_ = shrinking_ && r.new_content.size() <= r.wildcard.size();
+        }
+    }
+
+    auto replace_all(std::string_view input) const -> std::string
+    {
+        return detail::replace_matches(input, finder{this, input});
+    }
+
+    // replace_all_in_place replaces the wildcards in s, returns the number of
+    // replacements; s is not reallocated if none of the contents is longer
+    // than its wildcard
+    auto replace_all_in_place(std::string& s) const -> std::size_t
+    {
+        return detail::replace_matches_in_place(s, shrinking_, finder{this, s});
+    }
+
+    // replace_all_to writes the input with the wildcards replaced to w,
+    // e.g. to a sink_writer that streams the output in chunks
+    auto replace_all_to(std::string_view input, writer& w) const -> std::errc
+    {
+        return detail::replace_matches_to(input, w, finder{this, input});
+    }
+
+private:
+    // finder adapts find_leftmost to the detail::replace_matches interface
+    struct finder {
+        multi_replacer const* self;
+        std::string_view input;
+        aho_corasick<char>::state_type st = {};
+
+        auto operator()(std::size_t start) -> std::optional<detail::wildcard_match>
+        {
+            if (auto m = self->ac_.find_leftmost(input, start, st, self->kind_))
+                return detail::wildcard_match{m->pos, m->size, self->contents_[m->pattern]};
+            return {};
+        }
+    };
+
+    aho_corasick<char> ac_;
+    std::vector<std::string> contents_;
+    match_kind kind_;
+    bool shrinking_ = true; // no content is longer than its wildcard
+};
+
 // replace_all - replaces all occurences of the wildcards in a string with the
 // matching replacement content
+//
+// - the leftmost wildcard is replaced first, among the wildcards that start at
+//   the same position the one listed first wins
+// - a few wildcards are searched directly, remembering where each one occurs
+//   next; larger sets are compiled into a multi_replacer
+//
 inline auto replace_all(
     std::string_view tmpl, std::initializer_list<replacement_pair_view> replacements) -> std::string
 {
-    auto find = [&](std::size_t start_pos) {
-        auto pair_it = replacements.end();
-        auto best = tmpl.size();
-        for (auto it = replacements.begin(); it != replacements.end(); ++it)
-            if (auto p = tmpl.find(it->wildcard, start_pos); p != std::string_view::npos)
-                if (p < best) {
-                    pair_it = it;
-                    best = p;
-                }
-        return std::make_pair(best, pair_it);
+    if (replacements.size() > detail::direct_search_limit)
+        return multi_replacer{replacements, match_kind::leftmost_first}.replace_all(tmpl);
+    return detail::replace_matches(tmpl, detail::direct_wildcard_finder{tmpl, replacements});
+}
+
+// replace_all_in_place - replace_all that modifies s, returns the number of
+// replacements
+//
+// s is not reallocated if none of the contents is longer than its wildcard
+//
+inline auto replace_all_in_place(std::string& s, std::initializer_list<replacement_pair_view> replacements)
+    -> std::size_t
+{
+    if (replacements.size() > detail::direct_search_limit)
+        return multi_replacer{replacements, match_kind::leftmost_first}.replace_all_in_place(s);
+    auto const shrinking = std::ranges::all_of(
+        replacements, [](auto const& r) { return r.new_content.size() <= r.wildcard.size(); });
+    return detail::replace_matches_in_place(s, shrinking, detail::direct_wildcard_finder{s, replacements});
+}
+
+// replace_all_to - replace_all that writes the output to w
+//
+// the input is passed through in pieces that fit into the writer, so that
+// a large (e.g. memory mapped) input can be rewritten into a file without
+// holding the output in memory:
+//
+//   auto w = sink_writer{[&](std::string_view chunk) { out.write(chunk.data(), chunk.size()); }};
+//   replace_all_to(mapped, {{"${a}", a}, {"${b}", b}}, w);
+//   w.flush();
+//
+inline auto replace_all_to(
+    std::string_view input, std::initializer_list<replacement_pair_view> replacements, writer& w) -> std::errc
+{
+    if (replacements.size() > detail::direct_search_limit)
+        return multi_replacer{replacements, match_kind::leftmost_first}.replace_all_to(input, w);
+    return detail::replace_matches_to(input, w, detail::direct_wildcard_finder{input, replacements});
+}
+
+// compiled_template is a template text that is parsed once into literal and
+// slot segments, and rendered with different values many times
+//
+// - slot i stands for every occurrence of wildcards[i] in the template text,
+//   the occurrences are located with the same rules as replace_all
+// - the template text is copied, the wildcards are not retained
+// - values[i] is substituted for slot i, missing values render as empty
+// - the output size is computed from the values up front, so rendering
+//   allocates at most once
+//
+//   auto const t = compiled_template{"Hello, ${name}! Welcome to ${site}.", {"${name}", "${site}"}};
+//   auto s = t.render({user, site});
+//
+class compiled_template {
+public:
+    using values_type = std::span<std::string_view const>;
+
+    compiled_template(std::string_view tmpl, std::initializer_list<std::string_view> wildcards)
+        : compiled_template{tmpl, std::ranges::subrange(wildcards.begin(), wildcards.end())}
+    {
+    }
+
+    template <std::ranges::forward_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, std::string_view>
+    compiled_template(std::string_view tmpl, R const& wildcards)
+        : text_{tmpl}
+    {
+        auto const ac = aho_corasick<char>{wildcards};
+        counts_.assign(ac.pattern_count(), 0);
+
+        auto st = aho_corasick<char>::state_type{};
+        auto start = std::size_t{0};
+        while (auto m = ac.find_leftmost(tmpl, start, st, match_kind::leftmost_first)) {
+            if (m->pos != start)
+                segments_.push_back({start, m->pos - start, literal});
+            segments_.push_back({0, 0, m->pattern});
+            ++counts_[m->pattern];
+            start = m->pos + m->size;
+        }
+        if (start != tmpl.size())
+            segments_.push_back({start, tmpl.size() - start, literal});
+
+        for (auto const& seg : segments_)
+            literal_size_ += seg.size;
+    }
+
+    auto slot_count() const -> std::size_t { return counts_.size(); }
+
+    // rendered_size returns the exact size of the output rendered with values
+    auto rendered_size(values_type values) const -> std::size_t
+    {
+        auto n = literal_size_;
+        for (auto i = std::size_t{0}; i < counts_.size() && i < values.size(); ++i)
+            n += counts_[i] * values[i].size();
+        return n;
+    }
+
+    auto rendered_size(std::initializer_list<std::string_view> values) const -> std::size_t
+    {
+        return rendered_size(values_type{values.begin(), values.size()});
+    }
+
+    // render_to writes the output into [first, last), nothing is written if
+    // the output does not fit
+    auto render_to(char* first, char* last, values_type values) const -> std::to_chars_result
+    {
+        if (std::size_t(last - first) < rendered_size(values))
+            return {last, std::errc::value_too_large};
+        for (auto const& seg : segments_) {
+            auto const sv = segment_text(seg, values);
+            if (!sv.empty())
+                std::memcpy(first, sv.data(), sv.size());
+            first += sv.size();
+        }
+        return {first, std::errc{}};
+    }
+
+    auto render_to(char* first, char* last, std::initializer_list<std::string_view> values) const
+        -> std::to_chars_result
+    {
+        return render_to(first, last, values_type{values.begin(), values.size()});
+    }
+
+    // render_to overload that appends the output to a writer
+    auto render_to(writer& w, values_type values) const -> std::errc
+    {
+        for (auto const& seg : segments_)
+            if (auto ec = w.write(segment_text(seg, values)); ec != std::errc{})
+                return ec;
+        return std::errc{};
+    }
+
+    auto render_to(writer& w, std::initializer_list<std::string_view> values) const -> std::errc
+    {
+        return render_to(w, values_type{values.begin(), values.size()});
+    }
+
+    auto render(values_type values) const -> std::string
+    {
+        auto s = std::string(rendered_size(values), '\0');
+        render_to(s.data(), s.data() + s.size(), values);
+        return s;
+    }
+
+    auto render(std::initializer_list<std::string_view> values) const -> std::string
+    {
+        return render(values_type{values.begin(), values.size()});
+    }
+
+private:
+    static constexpr auto literal = std::size_t(-1);
+
+    struct segment {
+        std::size_t pos;  // literal text position
+        std::size_t size; // literal text size
+        std::size_t slot; // slot index, or literal
     };
 
-    auto ret = std::string{};
-    auto start = std::size_t(0);
-    while (true) {
-        auto [pos, rep] = find(start);
-        ret += tmpl.substr(start, pos - start);
-        if (rep == replacements.end())
-            break;
-        ret += rep->new_content;
-        start = pos + rep->wildcard.size();
+    auto segment_text(segment const& seg, values_type values) const -> std::string_view
+    {
+        if (seg.slot == literal)
+            return {text_.data() + seg.pos, seg.size};
+        return seg.slot < values.size() ? values[seg.slot] : std::string_view{};
     }
 
-    return ret;
-}
+    std::string text_;
+    std::vector<segment> segments_;
+    std::vector<std::size_t> counts_; // occurrences of each slot
+    std::size_t literal_size_ = 0;
+};
 
 } // namespace strings
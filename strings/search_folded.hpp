@@ -2,6 +2,10 @@
 
 #include "codec.hpp"
 #include "fold.hpp"
+#include "segment.hpp"
+#include "trim.hpp"
+#include "unicode_properties.hpp"
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -71,50 +75,33 @@ inline auto longest_common_substring(
     return max_length;
 }
 
-inline auto is_ctrl_or_space(char32_t codepoint) -> bool
-{
-    return codepoint <= U'\u0020' ||                             // Space
-           codepoint == U'\u007f' ||                             // Delete character
-           codepoint == U'\u00A0' ||                             // No-Break Space
-           codepoint == U'\u1680' ||                             // Ogham Space Mark
-           (codepoint >= U'\u2000' && codepoint <= U'\u200A') || // En Quad to Hair Space
-           codepoint == U'\u202F' ||                             // Narrow No-Break Space
-           codepoint == U'\u205F' ||                             // Medium Mathematical Space
-           codepoint == U'\u3000' ||                             // Ideographic Space
-           codepoint == U'\u200B';                               // Zero Width Space
-}
-
+// is_word_boundary - the separators of the simple word model, kept for
+// compatibility; the searcher uses the UAX #29 word boundaries of
+// is_word_boundary(text, pos)
 inline auto is_word_boundary(char32_t c) -> bool
 {
     return is_ctrl_or_space(c) || c == U',' || c == U'.' || c == U'?' || c == U'!' || c == U'-';
 }
 
+// split_words - the UAX #29 word segments of the text, without the ones made
+// of whitespace and punctuation only, e.g. "can't stop." is "can't", "stop";
+// ideographs are words on their own
 inline auto split_words(std::u32string const& text) -> std::vector<std::u32string>
 {
     auto words = std::vector<std::u32string>{};
-    auto word = std::u32string{};
-
-    for (auto c : text) {
-        if (is_ctrl_or_space(c)) {
-            if (!word.empty()) {
-                words.push_back(word);
-                word.clear();
-            }
-        }
-        else {
-            word += c;
-        }
-    }
-
-    if (!word.empty()) {
-        words.push_back(word);
+    for (auto segment : make_word_view(text)) {
+        auto const is_word = std::ranges::any_of(
+            segment, [](char32_t c) { return !is_ctrl_or_space(c) && !unicode::is_punctuation(c); });
+        if (is_word)
+            words.emplace_back(segment);
     }
-
     return words;
 }
 
 // searcher implements a simple substring search algorithm using unicode case folding
 //
+// matches that start at a UAX #29 word boundary of the haystack score higher
+//
 // returns search score 0..6 (see impl for details)
 //
 struct searcher {
@@ -156,13 +143,18 @@ struct searcher {
             c = dec();
         }
 
+        auto const text = std::u32string_view{hc};
+
         if (nf.length() == 1) {
             auto query_char = nf[0];
             auto best_score = 0.0f;
+            auto boundary = std::size_t{0}; // the first word boundary not before i
             for (std::size_t i = 0; i < hf.size(); ++i) {
                 if (hf[i] == query_char) {
+                    while (boundary < i)
+                        boundary = next_word_break(text, boundary);
                     // Higher score for matches at word boundaries
-                    if (i == 0 || is_word_boundary(hf[i - 1])) {
+                    if (boundary == i) {
                         return 0.9f; // Perfect match at the beginning of a word
                     }
                     best_score = std::max(best_score, 0.8f); // Regular match
@@ -180,7 +172,7 @@ struct searcher {
                     return 0.9f; // Prefix match
             }
             else {
-                if (is_word_boundary(hf[p - 1]))
+                if (is_word_boundary(text, p))
                     return 0.9f; // Word start
                 else
                     return 0.8f; // Partial inner match
@@ -196,7 +188,7 @@ struct searcher {
                     return 0.85f; // Prefix match
             }
             else {
-                if (is_word_boundary(hf[p - 1]))
+                if (is_word_boundary(text, p))
                     return 0.85f; // Word start
                 else
                     return 0.75f; // Partial inner match
@@ -0,0 +1,399 @@
+#pragma once
+
+#include "ascii.hpp"
+#include "codec.hpp"
+#include "codepoint.hpp"
+#include "segment_data.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+namespace strings {
+
+namespace detail::segmentation {
+
+struct decoded {
+    char32_t cp;
+    std::size_t next; // position after the codepoint
+};
+
+// decode_at decodes the codepoint at pos, malformed sequences are decoded as
+// U+FFFD one codeunit at a time
+template <typename U> constexpr auto decode_at(std::basic_string_view<U> s, std::size_t pos) -> decoded
+{
+    using cu = std::make_unsigned_t<U>;
+    if (cu(s[pos]) < 0x80u)
+        return {char32_t(cu(s[pos])), pos + 1};
+    if constexpr (sizeof(U) == 4) {
+        auto const cp = codepoint{char32_t(cu(s[pos]))};
+        return {unicode::is_valid(cp) ? cp.value : unicode::replacement_character.value, pos + 1};
+    }
+    else {
+        auto cp = codepoint{};
+        auto const last = to_codepoint<utf::encoding_of<U>>(s.begin() + pos, s.end(), cp, unexpected_policy::consume_one);
+        auto const next = std::max(std::size_t(last - s.begin()), pos + 1);
+        if ((cp.value & errcp::error_bit.value) || !unicode::is_valid(cp))
+            return {unicode::replacement_character.value, next};
+        return {cp.value, next};
+    }
+}
+
+constexpr auto is_control(grapheme_break g) -> bool
+{
+    return g == grapheme_break::cr || g == grapheme_break::lf || g == grapheme_break::control;
+}
+
+// grapheme_joins applies the rules GB3-GB13 of UAX #29 between the last
+// codepoint of a cluster and the next one
+//
+// - emoji_zwj: the cluster ends with ExtPict Extend* ZWJ
+// - ri: the number of regional indicators the cluster ends with
+//
+constexpr auto grapheme_joins(grapheme_break prev, record const& next, bool emoji_zwj, std::size_t ri) -> bool
+{
+    using enum grapheme_break;
+    auto const g = next.gcb;
+    if (prev == cr && g == lf)
+        return true;
+    if (is_control(prev) || is_control(g))
+        return false;
+    if (prev == l && (g == l || g == v || g == lv || g == lvt))
+        return true;
+    if ((prev == lv || prev == v) && (g == v || g == t))
+        return true;
+    if ((prev == lvt || prev == t) && g == t)
+        return true;
+    if (g == extend || g == zwj || g == spacing_mark || prev == prepend)
+        return true;
+    if (emoji_zwj && next.extended_pictographic)
+        return true;
+    return prev == regional_indicator && g == regional_indicator && ri % 2 == 1;
+}
+
+// next_grapheme_break returns the end of the extended grapheme cluster that
+// starts at pos
+template <typename U> constexpr auto next_grapheme_break(std::basic_string_view<U> s, std::size_t pos) -> std::size_t
+{
+    using cu = std::make_unsigned_t<U>;
+    auto const n = s.size();
+    if (pos >= n)
+        return n;
+
+    // ascii fast path: an ascii codepoint followed by another one is a
+    // cluster on its own, except for CR LF
+    if (cu(s[pos]) < 0x80u && (pos + 1 == n || cu(s[pos + 1]) < 0x80u))
+        return s[pos] == U('\r') && pos + 1 < n && s[pos + 1] == U('\n') ? pos + 2 : pos + 1;
+
+    auto const first = decode_at(s, pos);
+    auto const& r0 = lookup(first.cp);
+    auto prev = r0.gcb;
+    auto emoji = r0.extended_pictographic; // the cluster ends with ExtPict Extend*
+    auto emoji_zwj = false;
+    auto ri = std::size_t{prev == grapheme_break::regional_indicator};
+    auto i = first.next;
+    while (i < n) {
+        auto const d = decode_at(s, i);
+        auto const& r = lookup(d.cp);
+        if (!grapheme_joins(prev, r, emoji_zwj, ri))
+            break;
+        emoji_zwj = emoji && r.gcb == grapheme_break::zwj;
+        emoji = r.extended_pictographic || (emoji && r.gcb == grapheme_break::extend);
+        ri = r.gcb == grapheme_break::regional_indicator ? ri + 1 : 0;
+        prev = r.gcb;
+        i = d.next;
+    }
+    return i;
+}
+
+constexpr auto is_ahletter(word_break w) -> bool { return w == word_break::aletter || w == word_break::hebrew_letter; }
+
+constexpr auto is_mid_num_let_q(word_break w) -> bool
+{
+    return w == word_break::mid_num_let || w == word_break::single_quote;
+}
+
+constexpr auto is_newline(word_break w) -> bool
+{
+    return w == word_break::newline || w == word_break::cr || w == word_break::lf;
+}
+
+// is_ignored - the codepoints that attach to the preceding one (WB4)
+constexpr auto is_ignored(word_break w) -> bool
+{
+    return w == word_break::extend || w == word_break::format || w == word_break::zwj;
+}
+
+// peek_word_break returns the Word_Break value of the first codepoint at or
+// after pos that is not ignored, other at the end of input
+template <typename U> constexpr auto peek_word_break(std::basic_string_view<U> s, std::size_t pos) -> word_break
+{
+    while (pos < s.size()) {
+        auto const d = decode_at(s, pos);
+        auto const w = lookup(d.cp).wb;
+        if (!is_ignored(w))
+            return w;
+        pos = d.next;
+    }
+    return word_break::other;
+}
+
+// word_joins applies the rules WB5-WB16 of UAX #29 between the codepoints
+// of the types prev and next (both not ignored), pprev is the type before
+// prev; peek returns the type after next
+constexpr auto word_joins(word_break pprev, word_break prev, word_break next, auto&& peek, std::size_t ri) -> bool
+{
+    using enum word_break;
+    if (is_ahletter(prev) && is_ahletter(next))
+        return true;
+    if (is_ahletter(prev) && (next == mid_letter || is_mid_num_let_q(next)) && is_ahletter(peek()))
+        return true;
+    if (is_ahletter(pprev) && (prev == mid_letter || is_mid_num_let_q(prev)) && is_ahletter(next))
+        return true;
+    if (prev == hebrew_letter && next == single_quote)
+        return true;
+    if (prev == hebrew_letter && next == double_quote && peek() == hebrew_letter)
+        return true;
+    if (pprev == hebrew_letter && prev == double_quote && next == hebrew_letter)
+        return true;
+    if ((prev == numeric || is_ahletter(prev)) && next == numeric)
+        return true;
+    if (prev == numeric && is_ahletter(next))
+        return true;
+    if (pprev == numeric && (prev == mid_num || is_mid_num_let_q(prev)) && next == numeric)
+        return true;
+    if (prev == numeric && (next == mid_num || is_mid_num_let_q(next)) && peek() == numeric)
+        return true;
+    if (prev == katakana && next == katakana)
+        return true;
+    if ((is_ahletter(prev) || prev == numeric || prev == katakana || prev == extend_num_let) && next == extend_num_let)
+        return true;
+    if (prev == extend_num_let && (is_ahletter(next) || next == numeric || next == katakana))
+        return true;
+    return prev == regional_indicator && next == regional_indicator && ri % 2 == 1;
+}
+
+// next_word_break returns the end of the word segment that starts at pos
+template <typename U> constexpr auto next_word_break(std::basic_string_view<U> s, std::size_t pos) -> std::size_t
+{
+    using cu = std::make_unsigned_t<U>;
+    auto const n = s.size();
+    if (pos >= n)
+        return n;
+
+    // ascii fast path: spaces join spaces only, and the other ascii codepoints
+    // that are not letters, digits, '_', or CR are segments on their own when
+    // followed by another ascii codepoint
+    if (auto const c = cu(s[pos]); c < 0x80u && !ascii::is_alpha(c) && !ascii::is_decimal(c) && c != '_' &&
+                                   c != '\r' && (pos + 1 == n || cu(s[pos + 1]) < 0x80u)) {
+        auto i = pos + 1;
+        if (c == ' ')
+            while (i < n && s[i] == U(' '))
+                ++i;
+        if (i == n || cu(s[i]) < 0x80u)
+            return i;
+    }
+
+    auto const first = decode_at(s, pos);
+    auto raw = lookup(first.cp).wb; // the last codepoint, ignored or not
+    auto prev = raw;                // the last codepoint that is not ignored
+    auto pprev = word_break::other;
+    auto ri = std::size_t{prev == word_break::regional_indicator};
+    auto i = first.next;
+    while (i < n) {
+        // ascii fast path: letters and digits join letters and digits
+        if (is_ahletter(prev) || prev == word_break::numeric) {
+            auto j = i;
+            while (j < n && cu(s[j]) < 0x80u && (ascii::is_alpha(cu(s[j])) || ascii::is_decimal(cu(s[j]))))
+                ++j;
+            if (j != i) {
+                pprev = j - i > 1 ? lookup(cu(s[j - 2])).wb : prev;
+                prev = raw = lookup(cu(s[j - 1])).wb;
+                ri = 0;
+                i = j;
+                if (i == n)
+                    break;
+            }
+        }
+
+        auto const d = decode_at(s, i);
+        auto const& r = lookup(d.cp);
+        auto const w = r.wb;
+        auto joined = false;
+        if (raw == word_break::cr && w == word_break::lf)
+            joined = true;
+        else if (is_newline(raw) || is_newline(w))
+            joined = false;
+        else if ((raw == word_break::zwj && r.extended_pictographic) ||
+                 (raw == word_break::wseg_space && w == word_break::wseg_space))
+            joined = true;
+        else if (is_ignored(w)) {
+            raw = w;
+            i = d.next;
+            continue;
+        }
+        else
+            joined = word_joins(pprev, prev, w, [&] { return peek_word_break(s, d.next); }, ri);
+        if (!joined)
+            break;
+        pprev = prev;
+        prev = raw = w;
+        ri = w == word_break::regional_indicator ? ri + 1 : 0;
+        i = d.next;
+    }
+    return i;
+}
+
+struct grapheme_breaks {
+    template <typename U> static constexpr auto next(std::basic_string_view<U> s, std::size_t pos) -> std::size_t
+    {
+        return next_grapheme_break(s, pos);
+    }
+};
+
+struct word_breaks {
+    template <typename U> static constexpr auto next(std::basic_string_view<U> s, std::size_t pos) -> std::size_t
+    {
+        return next_word_break(s, pos);
+    }
+};
+
+} // namespace detail::segmentation
+
+// segment_view is a lazy range of the subviews between the UAX #29 grapheme
+// cluster or word boundaries of utf8, utf16, or utf32 input
+//
+// - segments are produced without allocation, the view must outlive its
+//   iterators
+// - word segments include the spaces and punctuation between words, e.g.
+//   "can't stop." is "can't", " ", "stop", "."
+// - malformed sequences are segmented as U+FFFD
+//
+template <typename U, typename Breaks>
+class segment_view : public std::ranges::view_interface<segment_view<U, Breaks>> {
+public:
+    using string_view_type = std::basic_string_view<U>;
+
+    segment_view() = default;
+
+    explicit segment_view(string_view_type input)
+        : input_{input}
+    {
+    }
+
+    class iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = string_view_type;
+
+        iterator() = default;
+
+        auto operator*() const -> reference { return input_.substr(cur_, end_ - cur_); }
+
+        auto operator++() -> iterator&
+        {
+            cur_ = end_;
+            end_ = Breaks::next(input_, cur_);
+            return *this;
+        }
+
+        auto operator++(int) -> iterator
+        {
+            auto t = *this;
+            ++*this;
+            return t;
+        }
+
+        friend auto operator==(iterator const& a, iterator const& b) -> bool { return a.cur_ == b.cur_; }
+        friend auto operator==(iterator const& a, std::default_sentinel_t) -> bool
+        {
+            return a.cur_ == a.input_.size();
+        }
+
+    private:
+        friend class segment_view;
+
+        explicit iterator(string_view_type input)
+            : input_{input}
+            , end_{Breaks::next(input, 0)}
+        {
+        }
+
+        string_view_type input_;
+        std::size_t cur_ = 0;
+        std::size_t end_ = 0;
+    };
+
+    auto begin() const -> iterator { return iterator{input_}; }
+    auto end() const -> std::default_sentinel_t { return {}; }
+
+private:
+    string_view_type input_;
+};
+
+template <typename U> using grapheme_view = segment_view<U, detail::segmentation::grapheme_breaks>;
+template <typename U> using word_view = segment_view<U, detail::segmentation::word_breaks>;
+
+// make_grapheme_view - the extended grapheme clusters of the input, e.g. for
+// cursor movement
+//
+//   for (auto g : make_grapheme_view(text))
+//       ...
+//
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto make_grapheme_view(Input const& input) -> grapheme_view<U>
+{
+    return grapheme_view<U>{std::basic_string_view<U>(input)};
+}
+
+// make_word_view - the segments between the word boundaries of the input
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto make_word_view(Input const& input) -> word_view<U>
+{
+    return word_view<U>{std::basic_string_view<U>(input)};
+}
+
+// next_grapheme_break - returns the end of the grapheme cluster that starts at
+// pos, pos must be a grapheme cluster boundary
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+constexpr auto next_grapheme_break(Input const& input, std::size_t pos) -> std::size_t
+{
+    return detail::segmentation::next_grapheme_break(std::basic_string_view<U>(input), pos);
+}
+
+// next_word_break - returns the end of the word segment that starts at pos,
+// pos must be a word boundary
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+constexpr auto next_word_break(Input const& input, std::size_t pos) -> std::size_t
+{
+    return detail::segmentation::next_word_break(std::basic_string_view<U>(input), pos);
+}
+
+// is_word_boundary - returns true if there is a word boundary at pos, the
+// start and the end of the input included
+//
+// the boundaries are found from the start of the input, use a word_view or
+// next_word_break to visit several of them
+//
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+constexpr auto is_word_boundary(Input const& input, std::size_t pos) -> bool
+{
+    auto const s = std::basic_string_view<U>(input);
+    auto b = std::size_t{0};
+    while (b < pos && b < s.size())
+        b = detail::segmentation::next_word_break(s, b);
+    return b == pos;
+}
+
+} // namespace strings
@@ -0,0 +1,714 @@
+#pragma once
+
+// DO NOT EDIT: Generated file
+// clang-format off
+
+#include <cstdint>
+
+namespace strings::detail::segmentation {
+
+enum class grapheme_break : std::uint8_t {
+	other, // Other
+	cr, // CR
+	lf, // LF
+	control, // Control
+	extend, // Extend
+	zwj, // ZWJ
+	regional_indicator, // Regional_Indicator
+	prepend, // Prepend
+	spacing_mark, // SpacingMark
+	l, // L
+	v, // V
+	t, // T
+	lv, // LV
+	lvt, // LVT
+};
+
+enum class word_break : std::uint8_t {
+	other, // Other
+	cr, // CR
+	lf, // LF
+	newline, // Newline
+	extend, // Extend
+	zwj, // ZWJ
+	regional_indicator, // Regional_Indicator
+	format, // Format
+	katakana, // Katakana
+	hebrew_letter, // Hebrew_Letter
+	aletter, // ALetter
+	single_quote, // Single_Quote
+	double_quote, // Double_Quote
+	mid_num_let, // MidNumLet
+	mid_letter, // MidLetter
+	mid_num, // MidNum
+	numeric, // Numeric
+	extend_num_let, // ExtendNumLet
+	wseg_space, // WSegSpace
+};
+
+// Grapheme_Cluster_Break, Word_Break, and Extended_Pictographic per codepoint
+// generated from: unicode.org/Public/14.0.0/ucd/auxiliary/GraphemeBreakProperty.txt, WordBreakProperty.txt, emoji/emoji-data.txt
+// total: 32 records, 15488 bytes
+//
+// codepoint bits [20..9] index stage1, which selects a row of stage2
+// codepoint bits [8..4] index the row, which selects a block of stage3
+// codepoint bits [3..0] index the block, which selects a record
+//
+constexpr unsigned stage2_shift = 9;
+constexpr unsigned stage3_shift = 4;
+
+struct record {
+	grapheme_break gcb;
+	word_break wb;
+	bool extended_pictographic;
+};
+
+constexpr record records[32] = {
+	{grapheme_break::control,word_break::other,false},{grapheme_break::lf,word_break::lf,false},{grapheme_break::control,word_break::newline,false},{grapheme_break::cr,word_break::cr,false},
+	{grapheme_break::other,word_break::wseg_space,false},{grapheme_break::other,word_break::other,false},{grapheme_break::other,word_break::double_quote,false},{grapheme_break::other,word_break::single_quote,false},
+	{grapheme_break::other,word_break::mid_num,false},{grapheme_break::other,word_break::mid_num_let,false},{grapheme_break::other,word_break::numeric,false},{grapheme_break::other,word_break::mid_letter,false},
+	{grapheme_break::other,word_break::aletter,false},{grapheme_break::other,word_break::extend_num_let,false},{grapheme_break::other,word_break::other,true},{grapheme_break::control,word_break::format,false},
+	{grapheme_break::extend,word_break::extend,false},{grapheme_break::other,word_break::hebrew_letter,false},{grapheme_break::prepend,word_break::format,false},{grapheme_break::spacing_mark,word_break::extend,false},
+	{grapheme_break::prepend,word_break::aletter,false},{grapheme_break::spacing_mark,word_break::other,false},{grapheme_break::other,word_break::extend,false},{grapheme_break::l,word_break::aletter,false},
+	{grapheme_break::v,word_break::aletter,false},{grapheme_break::t,word_break::aletter,false},{grapheme_break::zwj,word_break::zwj,false},{grapheme_break::other,word_break::aletter,true},
+	{grapheme_break::other,word_break::katakana,false},{grapheme_break::lv,word_break::aletter,false},{grapheme_break::lvt,word_break::aletter,false},{grapheme_break::regional_indicator,word_break::regional_indicator,false},
+};
+
+constexpr std::uint8_t stage1[2176] = {
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,27,27,28,29,30,31,32,33,34,35,36,37,38,32,33,34,
+	35,36,37,38,32,33,34,35,36,37,38,39,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,40,41,42,
+	43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,27,59,60,26,26,26,26,61,27,27,62,26,26,26,26,26,
+	26,26,27,63,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,27,64,26,65,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,66,67,26,26,26,26,26,68,26,
+	26,26,26,26,26,26,26,69,70,71,72,73,26,74,26,75,76,77,26,78,79,26,26,80,81,82,83,84,85,86,87,88,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	89,90,90,90,90,90,90,90,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+	26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+};
+
+constexpr std::uint16_t stage2[91][32] = {
+	{0,1,2,3,4,5,4,6,7,1,8,9,10,11,10,11,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,12,10,10,13,13,13,13,13,13,13,14,15,10,16,10,10,10,10,17},
+	{10,10,10,10,10,10,10,10,18,10,10,10,10,10,10,10,10,10,10,4,10,19,10,10,20,21,13,22,23,24,25,26},
+	{27,28,10,10,29,13,30,31,10,10,10,10,10,32,33,34,35,36,10,13,37,10,10,10,10,10,38,39,40,10,29,41},
+	{10,42,43,44,10,45,46,10,47,48,10,10,49,13,50,13,51,10,10,52,53,54,55,4,56,57,58,59,60,61,55,62},
+	{63,57,58,64,65,66,67,68,69,16,58,70,71,72,55,73,74,57,58,75,76,77,55,78,79,80,81,82,83,84,67,44},
+	{85,86,58,87,88,89,55,44,90,86,58,91,92,93,55,94,95,86,10,96,97,98,55,99,100,101,10,102,103,104,67,105},
+	{44,44,44,106,107,108,44,44,44,44,44,109,110,108,44,44,72,111,108,112,113,10,114,115,116,117,13,118,119,44,44,44},
+	{44,44,120,121,108,122,123,124,125,126,10,10,127,10,10,128,129,129,129,129,129,129,130,130,130,130,131,132,132,132,132,132},
+	{10,10,10,10,133,134,10,10,133,10,10,135,136,11,10,10,10,136,10,10,10,137,44,44,10,44,10,10,10,10,10,138},
+	{4,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+	{10,10,10,10,10,10,139,10,140,46,10,10,10,10,141,142,10,143,10,144,10,145,146,147,44,44,44,148,149,150,108,44},
+	{151,108,10,10,10,10,10,142,152,10,153,10,10,10,10,154,10,155,156,157,67,44,44,44,44,44,44,44,44,108,44,44},
+	{10,158,44,44,44,159,160,161,108,108,44,13,162,44,44,44,163,10,10,164,165,108,166,167,168,10,169,40,10,10,170,171},
+	{10,10,172,173,174,40,10,175,142,10,10,176,44,177,178,179,10,10,10,10,10,10,10,10,10,10,10,10,13,13,13,13},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,138,10,10,138,180,10,175,10,10,10,181,182,183,114,182},
+	{184,185,186,187,188,189,190,191,44,114,44,44,44,13,13,192,193,194,195,196,197,44,10,10,142,198,199,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,200,201,44,44,44,44,44,201,44,44,44,202,44,203,204},
+	{44,44,44,44,44,44,44,44,44,44,44,205,206,10,207,44,44,44,44,44,44,44,44,44,44,44,200,208,209,44,44,210},
+	{211,212,213,213,213,213,213,213,214,213,213,213,213,213,213,213,215,216,217,218,219,220,221,44,44,222,223,224,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,225,44,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,222,226,44,44,44,227,44,44,44,44,44,44,44,44,44,44},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,228,229,10,10,127,10,10,10,230,231,10,232,233,233,233,233,13,13},
+	{44,44,234,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{235,44,236,237,44,44,44,44,44,238,239,239,239,239,239,240,241,10,10,4,10,10,10,10,155,44,10,10,44,44,44,239},
+	{44,44,44,44,44,44,44,44,44,242,44,44,44,239,239,243,239,239,239,239,239,244,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+	{10,10,10,10,10,10,10,10,114,44,44,44,44,10,10,175,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+	{114,10,245,44,10,10,246,247,10,248,10,10,10,10,10,249,250,10,10,10,10,10,10,10,10,10,10,10,46,251,44,252},
+	{253,10,254,44,10,10,10,255,256,10,10,257,258,108,13,259,40,10,260,10,261,171,129,262,51,10,10,263,264,108,265,108},
+	{10,10,266,267,268,108,44,269,44,44,44,270,271,44,272,273,274,275,233,10,10,10,207,10,10,10,10,10,10,10,276,108},
+	{277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280},
+	{279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277},
+	{278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279},
+	{281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278},
+	{279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281},
+	{279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279},
+	{280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279},
+	{277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,281,279,277,278,279,280,279,282,130,283,132,132,284},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,232,285,286,287,288,10,10,10,10,10,10,289,44,290,10,10},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,175,44,10,10,10,10,252,10,10,291,44,44,292},
+	{13,293,13,294,295,296,44,297,10,10,10,10,10,10,10,298,299,3,4,5,4,46,300,239,239,301,10,155,302,303,44,304},
+	{305,10,11,306,175,175,44,44,10,10,10,10,10,10,10,46,44,44,44,44,10,10,10,307,44,44,44,44,44,44,44,308},
+	{44,44,44,44,44,44,44,44,10,114,10,10,10,72,192,44,10,10,309,10,46,10,10,310,10,175,10,10,311,312,44,44},
+	{10,10,10,10,10,10,10,10,10,175,108,10,10,311,10,292,10,10,291,10,10,10,255,128,128,313,16,314,44,44,44,44},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,232,10,154,291,44,17,10,10,315,44,44,44,44},
+	{316,10,10,317,10,154,10,232,10,155,44,44,44,44,10,318,10,154,10,207,44,44,44,44,10,10,10,12,44,44,44,44},
+	{319,320,10,321,44,44,10,114,10,114,44,44,113,10,322,44,10,10,10,154,10,154,10,323,10,289,44,44,44,44,44,44},
+	{10,10,10,10,142,44,44,44,10,10,10,323,10,10,10,323,10,10,324,108,44,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,10,10,325,289,44,44,44,44,10,114,326,10,38,192,44,10,327,44,44,10,307,44,10,232},
+	{328,10,10,329,330,44,67,331,168,10,10,332,333,10,142,108,334,10,335,336,337,10,10,338,168,10,10,339,340,341,44,44},
+	{10,16,342,343,44,44,44,44,344,345,142,10,10,246,346,108,347,57,58,348,349,350,351,352,44,44,44,44,44,44,44,44},
+	{10,10,10,353,354,355,289,44,10,10,10,356,357,108,44,44,44,44,44,44,44,44,44,44,10,10,246,358,192,359,44,44},
+	{10,10,10,360,361,108,44,44,10,10,362,363,108,44,44,44,44,364,365,108,44,44,44,44,44,44,44,44,44,44,44,44},
+	{10,10,342,366,44,44,44,44,44,44,10,10,10,10,108,234,367,368,10,369,370,108,44,44,44,44,371,10,10,372,373,44},
+	{374,10,10,375,376,377,10,10,378,379,44,10,10,10,10,142,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{58,10,380,381,72,108,44,252,10,382,383,384,44,44,44,44,385,10,10,386,387,108,388,10,389,390,108,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,10,391,44,44,44,44,44,44,44,44,44,44,44,72,44,44,44,44},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,207,44,44,44,44,44,44},
+	{10,10,10,10,10,10,155,44,10,10,10,10,10,10,10,10,10,10,10,10,255,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,10,10,10,10,10,10,72},
+	{10,10,155,392,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{10,10,10,10,232,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{10,10,10,142,10,155,108,10,10,10,10,155,108,10,175,352,10,10,10,330,255,108,290,393,10,44,44,44,44,44,44,44},
+	{44,44,44,44,10,10,10,10,44,44,44,44,44,44,44,44,10,10,10,10,394,395,396,396,397,334,44,44,44,44,398,399},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,400},
+	{401,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,402,44,44,44,403,44,44,44,44,44,44,44,44,44},
+	{10,10,10,10,10,10,46,114,142,404,405,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,13,13,406,13,330,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,407,408,409,44,410,44,44,44,44,44},
+	{44,44,44,44,411,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{10,10,10,10,10,297,10,10,10,146,412,413,414,10,10,10,415,416,10,417,418,86,10,10,10,10,10,10,10,10,10,10},
+	{10,10,10,10,10,10,10,10,10,10,419,10,86,128,10,128,10,297,10,297,155,10,155,10,58,10,58,10,420,421,421,421},
+	{13,13,13,422,13,13,118,265,423,166,21,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,10,155,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{424,425,426,44,44,44,44,44,44,44,44,44,44,44,44,44,10,10,114,427,428,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,10,429,44,10,10,430,108,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,431,155},
+	{10,10,10,10,10,10,10,10,10,10,10,10,307,330,44,44,10,10,10,10,432,108,44,44,44,44,44,44,44,44,44,44},
+	{414,10,433,434,435,436,437,438,439,292,440,292,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44},
+	{213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,441,44,202,10,207,10,442,443,444,445,441,213,213,213,446,447},
+	{448,449,202,450,203,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,451},
+	{213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,452,453,213,213,213,213,213,213,213,213,213,213,213},
+	{213,213,213,213,213,44,44,44,213,213,213,213,213,213,213,213,44,44,44,44,44,44,44,454,44,44,44,44,44,455,213,213},
+	{456,44,44,44,457,458,44,44,457,44,459,213,213,213,213,213,456,213,213,460,211,213,213,213,213,213,213,213,213,213,213,213},
+	{213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,108},
+	{213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213},
+	{213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,452},
+	{461,1,13,13,13,13,13,13,1,1,1,1,1,1,1,1,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,1},
+	{1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+};
+
+constexpr std::uint8_t stage3[462][16] = {
+	{0,0,0,0,0,0,0,0,0,0,1,2,2,3,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{4,5,6,5,5,5,5,7,5,5,5,5,8,5,9,5},
+	{10,10,10,10,10,10,10,10,10,10,11,8,5,5,5,5},
+	{5,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,13},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,0},
+	{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0},
+	{5,5,5,5,5,5,5,5,5,14,12,5,5,15,14,5},
+	{5,5,5,5,5,12,5,11,5,5,12,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,5,5,5,5,5,5,12,12},
+	{16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+	{12,12,12,12,12,5,12,12,5,5,12,12,12,12,8,12},
+	{5,5,5,5,5,5,12,11,12,12,12,5,12,5,12,12},
+	{12,12,5,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,5,12,12,12,12,12,12,12,12,12},
+	{12,12,5,16,16,16,16,16,16,16,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,5,5,12,12,12,12,5,12,11},
+	{12,12,12,12,12,12,12,12,12,8,12,5,5,5,5,5},
+	{5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+	{16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,16},
+	{5,16,16,5,16,16,5,16,5,5,5,5,5,5,5,5},
+	{17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17},
+	{17,17,17,17,17,17,17,17,17,17,17,5,5,5,5,17},
+	{17,17,17,12,11,5,5,5,5,5,5,5,5,5,5,5},
+	{18,18,18,18,18,18,5,5,5,5,5,5,8,8,5,5},
+	{16,16,16,16,16,16,16,16,16,16,16,5,15,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,16,16,16,16,16},
+	{10,10,10,10,10,10,10,10,10,10,5,10,8,5,12,12},
+	{16,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,5,12,16,16,16,16,16,16,16,18,5,16},
+	{16,16,16,16,16,12,12,16,16,5,16,16,16,16,12,12},
+	{10,10,10,10,10,10,10,10,10,10,12,12,12,5,5,12},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,18},
+	{12,16,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{16,16,16,16,16,16,16,16,16,16,16,5,5,12,12,12},
+	{12,12,12,12,12,12,16,16,16,16,16,16,16,16,16,16},
+	{16,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{10,10,10,10,10,10,10,10,10,10,12,12,12,12,12,12},
+	{16,16,16,16,12,12,5,5,8,5,12,5,5,16,5,5},
+	{12,12,12,12,12,12,16,16,16,16,12,16,16,16,16,16},
+	{16,16,16,16,12,16,16,16,12,16,16,16,16,16,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,16,16,16,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,5},
+	{18,18,5,5,5,5,5,5,16,16,16,16,16,16,16,16},
+	{12,12,12,12,12,12,12,12,12,12,16,16,16,16,16,16},
+	{16,16,18,16,16,16,16,16,16,16,16,16,16,16,16,16},
+	{16,16,16,19,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,16,19,16,12,19,19},
+	{19,16,16,16,16,16,16,16,16,19,19,19,19,16,19,19},
+	{12,16,16,16,16,16,16,16,12,12,12,12,12,12,12,12},
+	{12,12,16,16,5,5,10,10,10,10,10,10,10,10,10,10},
+	{12,16,19,19,5,12,12,12,12,12,12,12,12,5,5,12},
+	{12,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,5,12,12,12,12,12,12},
+	{12,5,12,5,5,5,12,12,12,12,5,5,16,12,16,19},
+	{19,16,16,16,16,5,5,19,19,5,5,19,19,16,12,5},
+	{5,5,5,5,5,5,5,16,5,5,5,5,12,12,5,12},
+	{12,12,5,5,5,5,5,5,5,5,5,5,12,5,16,5},
+	{5,16,16,19,5,12,12,12,12,12,12,5,5,5,5,12},
+	{12,5,12,12,5,12,12,5,12,12,5,5,16,5,19,19},
+	{19,16,16,5,5,5,5,16,16,5,5,16,16,16,5,5},
+	{5,16,5,5,5,5,5,5,5,12,12,12,12,5,12,5},
+	{5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10},
+	{16,16,12,12,12,16,5,5,5,5,5,5,5,5,5,5},
+	{5,16,16,19,5,12,12,12,12,12,12,12,12,12,5,12},
+	{12,5,12,12,5,12,12,12,12,12,5,5,16,12,19,19},
+	{19,16,16,16,16,16,5,16,16,19,5,19,19,16,5,5},
+	{12,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,12,16,16,16,16,16,16},
+	{5,16,19,19,5,12,12,12,12,12,12,12,12,5,5,12},
+	{12,5,12,12,5,12,12,12,12,12,5,5,16,12,16,16},
+	{19,16,16,16,16,5,5,19,19,5,5,19,19,16,5,5},
+	{5,5,5,5,5,16,16,16,5,5,5,5,12,12,5,12},
+	{5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,16,12,5,12,12,12,12,12,12,5,5,5,12,12},
+	{12,5,12,12,12,12,5,5,5,12,12,5,12,5,12,12},
+	{5,5,5,12,12,5,5,5,12,12,12,5,5,5,12,12},
+	{12,12,12,12,12,12,12,12,12,12,5,5,5,5,16,19},
+	{16,19,19,5,5,5,19,19,19,5,19,19,19,16,5,5},
+	{12,5,5,5,5,5,5,16,5,5,5,5,5,5,5,5},
+	{16,19,19,19,16,12,12,12,12,12,12,12,12,5,12,12},
+	{12,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,5,5,16,12,16,16},
+	{16,19,19,19,19,5,16,16,16,5,16,16,16,16,5,5},
+	{5,5,5,5,5,16,16,5,12,12,12,5,5,12,5,5},
+	{12,16,19,19,5,12,12,12,12,12,12,12,12,5,12,12},
+	{12,12,12,12,5,12,12,12,12,12,5,5,16,12,19,16},
+	{19,19,16,19,19,5,16,19,19,5,19,19,16,16,5,5},
+	{5,5,5,5,5,16,16,5,5,5,5,5,5,12,12,5},
+	{5,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{16,16,19,19,12,12,12,12,12,12,12,12,12,5,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,16,16,12,16,19},
+	{19,16,16,16,16,5,19,19,19,5,19,19,19,16,20,5},
+	{5,5,5,5,12,12,12,16,5,5,5,5,5,5,5,12},
+	{5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12},
+	{5,16,19,19,5,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,5,5,5,12,12,12,12,12,12},
+	{12,12,5,12,12,12,12,12,12,12,12,12,5,12,5,5},
+	{12,12,12,12,12,12,12,5,5,5,16,5,5,5,5,16},
+	{19,19,16,16,16,5,16,5,19,19,19,19,19,19,19,16},
+	{5,5,19,19,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,16,5,21,16,16,16,16,16,16,16,5,5,5,5,5},
+	{5,5,5,5,5,5,5,16,16,16,16,16,16,16,16,5},
+	{10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5},
+	{5,16,5,21,16,16,16,16,16,16,16,16,16,5,5,5},
+	{5,5,5,5,5,5,5,5,16,16,16,16,16,16,5,5},
+	{5,5,5,5,5,5,5,5,16,16,5,5,5,5,5,5},
+	{5,5,5,5,5,16,5,16,5,16,5,5,5,5,19,19},
+	{12,12,12,12,12,12,12,12,5,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,5},
+	{5,16,16,16,16,16,16,16,16,16,16,16,16,16,16,19},
+	{16,16,16,16,16,5,16,16,12,12,12,12,12,16,16,16},
+	{16,16,16,16,16,16,16,16,5,16,16,16,16,16,16,16},
+	{16,16,16,16,16,16,16,16,16,16,16,16,16,5,5,5},
+	{5,5,5,5,5,5,16,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,22,22,16,16,16},
+	{16,19,16,16,16,16,16,16,22,16,16,19,19,16,16,5},
+	{5,5,5,5,5,5,19,19,16,16,5,5,5,5,16,16},
+	{16,5,22,22,22,5,5,22,22,22,22,22,22,22,5,5},
+	{5,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,16,22,19,16,16,22,22,22,22,22,22,16,5,22},
+	{10,10,10,10,10,10,10,10,10,10,22,22,22,16,5,5},
+	{12,12,12,12,12,12,5,12,5,5,5,5,5,12,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,5,12,12,12,12},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,25,25,25,25,25,25,25,25},
+	{25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25},
+	{12,12,12,12,12,12,12,12,12,5,12,12,12,12,5,5},
+	{12,12,12,12,12,12,12,5,12,5,12,12,12,12,5,5},
+	{12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,5},
+	{12,5,12,12,12,12,5,5,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,16,16,16},
+	{12,12,12,12,12,12,5,5,12,12,12,12,12,12,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,12},
+	{4,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,5,12,12},
+	{12,12,12,12,12,12,12,12,12,5,5,5,5,5,5,5},
+	{12,12,16,16,16,19,5,5,5,5,5,5,5,5,5,12},
+	{12,12,16,16,19,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,16,16,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,5,12,12},
+	{12,5,16,16,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,16,16,19,16,16,16,16,16,16,16,19,19},
+	{19,19,19,19,19,19,16,19,19,16,16,16,16,16,16,16},
+	{16,16,16,16,5,5,5,5,5,5,5,5,5,16,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,16,16,16,15,16},
+	{12,12,12,12,12,16,16,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,16,12,5,5,5,5,5},
+	{12,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,5},
+	{16,16,16,19,19,19,19,16,16,19,19,19,5,5,5,5},
+	{19,19,16,19,19,19,19,19,19,16,16,16,5,5,5,5},
+	{12,12,12,12,12,12,12,16,16,19,19,16,5,5,5,5},
+	{5,5,5,5,5,19,16,19,16,16,16,16,16,16,16,5},
+	{16,22,16,22,22,16,16,16,16,16,16,16,16,19,19,19},
+	{19,19,19,16,16,16,16,16,16,16,16,16,16,5,5,16},
+	{16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,5},
+	{16,16,16,16,19,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,16,16,16,16,16,16,16,19,16,19,19,19},
+	{19,19,16,19,19,12,12,12,12,12,12,12,12,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,16,16,16,16,16},
+	{16,16,16,16,5,5,5,5,5,5,5,5,5,5,5,5},
+	{16,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,19,16,16,16,16,19,19,16,16,19,16,16,16,12,12},
+	{12,12,12,12,12,12,16,19,16,16,19,19,19,16,19,16},
+	{16,16,19,19,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,19,19,19,19,19,19,19,19,16,16,16,16},
+	{16,16,16,16,19,19,16,16,5,5,5,5,5,5,5,5},
+	{10,10,10,10,10,10,10,10,10,10,5,5,5,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,12,12,12},
+	{16,16,16,5,16,16,16,16,16,16,16,16,16,16,16,16},
+	{16,19,16,16,16,16,16,16,16,12,12,12,12,16,12,12},
+	{12,12,12,12,16,12,12,19,16,16,12,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,5,12,5,12,5,12,5,12},
+	{12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,5},
+	{5,5,12,12,12,5,12,12,12,12,12,12,12,5,5,5},
+	{12,12,12,12,5,5,12,12,12,12,12,12,5,5,5,5},
+	{4,4,4,4,4,4,4,5,4,4,4,0,16,26,15,15},
+	{5,5,5,5,5,5,5,5,9,9,5,5,5,5,5,5},
+	{5,5,5,5,9,5,5,11,2,2,15,15,15,15,15,13},
+	{5,5,5,5,5,5,5,5,5,5,5,5,14,5,5,13},
+	{13,5,5,5,8,5,5,5,5,14,5,5,5,5,5,5},
+	{5,5,5,5,13,5,5,5,5,5,5,5,5,5,5,4},
+	{15,15,15,15,15,0,15,15,15,15,15,15,15,15,15,15},
+	{5,12,5,5,5,5,5,5,5,5,5,5,5,5,5,12},
+	{16,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,12,5,5,5,5,12,5,5,12,12,12,12,12,12},
+	{12,12,12,12,5,12,5,5,5,12,12,12,12,12,5,5},
+	{5,5,14,5,12,5,12,5,12,5,12,12,12,12,5,12},
+	{12,12,12,12,12,12,12,12,12,27,5,5,12,12,12,12},
+	{5,5,5,5,5,12,12,12,12,12,5,5,5,5,12,5},
+	{5,5,5,5,14,14,14,14,14,14,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,14,14,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,14,14,5,5,5,5},
+	{5,5,5,5,5,5,5,5,14,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14},
+	{5,5,5,5,5,5,5,5,5,14,14,14,14,14,14,14},
+	{14,14,14,14,5,5,5,5,14,14,14,5,5,5,5,5},
+	{5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12},
+	{12,12,27,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,5,5,5,5,5,5},
+	{5,5,5,5,5,5,14,5,5,5,5,5,5,5,5,5},
+	{14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,14,14,14,14,5},
+	{14,14,14,14,14,14,5,14,14,14,14,14,14,14,14,14},
+	{14,14,14,5,14,14,14,14,14,14,14,14,14,14,14,14},
+	{14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14},
+	{14,14,14,14,14,14,5,5,5,5,5,5,5,5,5,5},
+	{14,14,14,14,14,14,5,5,14,14,14,14,14,14,14,14},
+	{14,14,14,5,14,5,14,5,5,5,5,5,5,14,5,5},
+	{5,14,5,5,5,5,5,5,14,5,5,5,5,5,5,5},
+	{5,5,5,14,14,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,14,5,5,14,5,5,5,5,14,5,14,5},
+	{5,5,5,14,14,14,5,14,5,5,5,5,5,5,5,5},
+	{5,5,5,14,14,14,14,14,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,14,14,14,5,5,5,5,5,5,5,5},
+	{5,14,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{14,5,5,5,5,5,5,5,5,5,5,5,5,5,5,14},
+	{5,5,5,5,14,14,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,14,14,5,5,5},
+	{14,5,5,5,5,14,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,5,5,5,5,5,5,12,12,12,12,16},
+	{16,16,12,12,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,12},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,16},
+	{12,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,5,12,12,12,12,12,12,12,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12},
+	{4,5,5,5,5,12,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,16,16,16,16,16,16},
+	{14,28,28,28,28,28,5,5,5,5,5,12,12,14,5,5},
+	{5,5,5,5,5,5,5,5,5,16,16,28,28,5,5,5},
+	{28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28},
+	{28,28,28,28,28,28,28,28,28,28,28,5,28,28,28,28},
+	{5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,12},
+	{5,5,5,5,5,5,5,14,5,14,5,5,5,5,5,5},
+	{28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,5},
+	{28,28,28,28,28,28,28,28,5,5,5,5,5,5,5,5},
+	{10,10,10,10,10,10,10,10,10,10,12,12,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,16},
+	{16,16,16,5,16,16,16,16,16,16,16,16,16,16,5,12},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,16},
+	{16,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12},
+	{12,12,5,12,5,12,12,12,12,12,5,5,5,5,5,5},
+	{5,5,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,16,12,12,12,16,12,12,12,12,16,12,12,12,12},
+	{12,12,12,19,19,16,16,19,5,5,5,5,16,5,5,5},
+	{12,12,12,12,5,5,5,5,5,5,5,5,5,5,5,5},
+	{19,19,12,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,16,16,5,5,5,5,5,5,5,5,5,5},
+	{16,16,12,12,12,12,12,12,5,5,5,12,5,12,12,16},
+	{12,12,12,12,12,12,16,16,16,16,16,16,16,16,5,5},
+	{12,12,12,12,12,12,12,16,16,16,16,16,16,16,16,16},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,5,5,5},
+	{12,12,12,16,19,19,16,16,16,16,19,19,16,16,19,19},
+	{19,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12},
+	{5,5,5,5,5,16,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,16,16,16,16,16,16,19},
+	{19,16,16,19,19,16,16,5,5,5,5,5,5,5,5,5},
+	{12,12,12,16,12,12,12,12,12,12,12,12,16,19,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,22,16,22,5,5},
+	{16,5,16,16,16,5,5,16,16,5,5,5,5,5,16,16},
+	{5,16,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,19,16,16,19,19},
+	{5,5,12,12,12,19,16,5,5,5,5,5,5,5,5,5},
+	{5,12,12,12,12,12,12,5,5,12,12,12,12,12,12,5},
+	{5,12,12,12,12,12,12,5,5,5,5,5,5,5,5,5},
+	{12,12,12,19,19,16,19,19,16,19,19,5,19,16,5,5},
+	{29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30},
+	{30,30,30,30,30,30,30,30,30,30,30,30,29,30,30,30},
+	{30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30},
+	{30,30,30,30,30,30,30,30,29,30,30,30,30,30,30,30},
+	{30,30,30,30,29,30,30,30,30,30,30,30,30,30,30,30},
+	{30,30,30,30,5,5,5,5,5,5,5,5,5,5,5,5},
+	{24,24,24,24,24,24,24,5,5,5,5,25,25,25,25,25},
+	{25,25,25,25,25,25,25,25,25,25,25,25,5,5,5,5},
+	{5,5,5,12,12,12,12,12,5,5,5,5,5,17,16,17},
+	{17,17,17,17,17,17,17,17,17,5,17,17,17,17,17,17},
+	{17,17,17,17,17,17,17,5,17,17,17,17,17,5,17,5},
+	{17,17,5,17,17,5,17,17,17,17,17,17,17,17,17,17},
+	{12,12,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,5,5,5,5},
+	{8,5,5,11,8,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,13,13,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13},
+	{8,5,9,5,8,11,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,5,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,5,5,15},
+	{5,5,5,5,5,5,5,9,5,5,5,5,8,5,9,5},
+	{5,5,5,5,5,5,28,28,28,28,28,28,28,28,28,28},
+	{28,28,28,28,28,28,28,28,28,28,28,28,28,28,16,16},
+	{5,5,12,12,12,12,12,12,5,5,12,12,12,12,12,12},
+	{5,5,12,12,12,12,12,12,5,5,12,12,12,5,5,5},
+	{0,0,0,0,0,0,0,0,0,15,15,15,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,5,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,5,12,12,5,12},
+	{12,12,12,12,12,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,16,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12},
+	{12,12,12,12,12,12,16,16,16,16,16,5,5,5,5,5},
+	{12,12,12,12,5,5,5,5,12,12,12,12,12,12,12,12},
+	{5,12,12,12,12,12,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,5,12,12,5,12,12,12,12,12,12,12,12,12},
+	{12,12,5,12,12,12,12,12,12,12,5,12,12,5,5,5},
+	{12,5,12,12,12,12,12,12,12,12,12,5,5,5,5,5},
+	{12,12,12,12,12,12,5,5,12,5,12,12,12,12,12,12},
+	{12,12,12,12,12,12,5,12,12,5,5,5,12,5,5,12},
+	{12,12,12,5,12,12,5,5,5,5,5,5,5,5,5,5},
+	{12,16,16,16,5,16,16,5,5,5,5,5,16,16,16,16},
+	{12,12,12,12,5,12,12,12,5,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,5,5,16,16,16,5,5,5,5,16},
+	{12,12,12,12,12,16,16,5,5,5,5,5,5,5,5,5},
+	{12,12,12,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,16,16,16,16,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,5,16,16,5,5,5},
+	{5,5,5,5,5,5,5,12,5,5,5,5,5,5,5,5},
+	{12,12,16,16,16,16,5,5,5,5,5,5,5,5,5,5},
+	{19,16,19,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,16,16,16,16,16,16,16,16},
+	{16,16,16,16,16,16,16,5,5,5,5,5,5,5,5,5},
+	{16,12,12,16,16,12,5,5,5,5,5,5,5,5,5,16},
+	{19,19,19,16,16,16,16,19,19,16,16,5,5,18,5,5},
+	{5,5,16,5,5,5,5,5,5,5,5,5,5,18,5,5},
+	{16,16,16,12,12,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,16,16,16,16,16,19,16,16,16},
+	{16,16,16,16,16,5,10,10,10,10,10,10,10,10,10,10},
+	{5,5,5,5,12,19,19,12,5,5,5,5,5,5,5,5},
+	{12,12,12,16,5,5,12,5,5,5,5,5,5,5,5,5},
+	{12,12,12,19,19,19,16,16,16,16,16,16,16,16,16,19},
+	{19,12,20,20,12,5,5,5,5,16,16,16,16,5,19,16},
+	{10,10,10,10,10,10,10,10,10,10,12,5,12,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,19,19,19,16},
+	{16,16,19,19,16,19,16,16,5,5,5,5,5,5,16,5},
+	{12,12,12,12,12,12,12,5,12,5,12,12,12,12,5,12},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,5,12},
+	{19,19,19,16,16,16,16,16,16,16,16,5,5,5,5,5},
+	{16,16,19,19,5,12,12,12,12,12,12,12,12,5,5,12},
+	{12,5,12,12,5,12,12,12,12,12,5,16,16,12,16,19},
+	{16,19,19,19,19,5,5,19,19,5,5,19,19,19,5,5},
+	{12,5,5,5,5,5,5,16,5,5,5,5,5,12,12,12},
+	{12,12,19,19,5,5,16,16,16,16,16,16,16,5,5,5},
+	{16,16,16,16,16,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,19,19,19,16,16,16,16,16,16,16,16},
+	{19,19,16,16,16,19,16,12,12,12,12,5,5,5,5,5},
+	{10,10,10,10,10,10,10,10,10,10,5,5,5,5,16,12},
+	{16,19,19,16,16,16,16,16,16,19,16,19,19,16,19,16},
+	{16,19,16,16,12,12,5,12,5,5,5,5,5,5,5,5},
+	{19,19,16,16,16,16,5,5,19,19,19,19,16,16,19,16},
+	{5,5,5,5,5,5,5,5,12,12,12,12,16,16,5,5},
+	{19,19,19,16,16,16,16,16,16,16,16,19,19,16,19,16},
+	{16,5,5,5,12,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,16,19,16,19,19},
+	{16,16,16,16,16,16,19,16,12,5,5,5,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,16,16,16},
+	{22,22,16,16,16,16,19,16,16,16,16,16,5,5,5,5},
+	{16,16,16,16,16,16,16,16,19,16,16,5,5,5,5,5},
+	{12,12,12,12,12,12,12,5,5,12,5,5,12,12,12,12},
+	{12,12,12,12,5,12,12,5,12,12,12,12,12,12,12,12},
+	{16,19,19,19,19,19,5,19,19,5,5,16,16,19,16,20},
+	{19,20,19,16,5,5,5,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,5,5,12,12,12,12,12,12},
+	{12,19,19,19,16,16,16,16,5,5,16,16,19,19,19,19},
+	{16,12,5,12,19,5,5,5,5,5,5,5,5,5,5,5},
+	{12,16,16,16,16,16,16,16,16,16,16,12,12,12,12,12},
+	{12,12,12,16,16,16,16,16,16,19,20,16,16,16,16,5},
+	{5,5,5,5,5,5,5,16,5,5,5,5,5,5,5,5},
+	{12,16,16,16,16,16,16,19,19,16,16,16,12,12,12,12},
+	{12,12,12,12,20,20,20,20,20,20,16,16,16,16,16,16},
+	{16,16,16,16,16,16,16,19,16,16,5,5,5,12,5,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,19},
+	{16,16,16,16,16,16,16,5,16,16,16,16,16,16,19,16},
+	{5,5,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+	{16,16,16,16,16,16,16,16,5,19,16,16,16,16,16,16},
+	{16,19,16,16,19,16,16,5,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,5,12,12,5,12,12,12,12,12},
+	{12,16,16,16,16,16,16,5,5,5,16,5,16,16,5,16},
+	{16,16,16,16,16,16,20,16,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,5,12,12,5,12,12,12,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,19,19,19,19,19,5},
+	{16,16,5,19,19,16,19,16,12,5,5,5,5,5,5,5},
+	{12,12,12,16,16,19,19,5,5,5,5,5,5,5,5,5},
+	{15,15,15,15,15,15,15,15,15,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,5,5,5,5,5,12,12,12},
+	{12,12,12,12,12,12,12,12,12,12,12,5,5,5,5,16},
+	{12,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,19,5,5,5,5,5,5,5,16},
+	{12,12,5,12,16,5,5,5,5,5,5,5,5,5,5,5},
+	{19,19,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{28,28,28,28,5,28,28,28,28,28,28,28,5,28,28,5},
+	{28,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{28,28,28,5,5,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,5,5,28,28,28,28,5,5,5,5,5,5,5,5},
+	{12,12,12,12,12,12,12,12,12,12,5,5,5,16,16,5},
+	{15,15,15,15,5,5,5,5,5,5,5,5,5,5,5,5},
+	{16,16,16,16,16,16,16,16,16,16,16,16,16,16,5,5},
+	{5,5,5,5,5,16,19,16,16,16,5,5,5,19,16,16},
+	{16,16,16,15,15,15,15,15,15,15,15,16,16,16,16,16},
+	{16,16,16,5,5,16,16,16,16,16,16,16,5,5,5,5},
+	{5,5,5,5,5,5,5,5,5,5,16,16,16,16,5,5},
+	{5,5,16,16,16,5,5,5,5,5,5,5,5,5,5,5},
+	{5,5,12,5,5,12,12,5,5,12,12,12,12,5,12,12},
+	{12,12,12,12,12,12,12,12,12,12,5,12,5,12,12,12},
+	{12,12,12,12,5,12,12,12,12,12,12,12,12,12,12,12},
+	{12,12,12,12,12,12,5,12,12,12,12,5,5,12,12,12},
+	{12,12,12,12,12,5,12,12,12,12,12,12,12,5,12,12},
+	{12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,5},
+	{12,12,12,12,12,5,12,5,5,5,12,12,12,12,12,12},
+	{12,12,12,12,12,12,5,5,12,12,12,12,12,12,12,12},
+	{12,12,12,5,12,12,12,12,12,12,12,12,5,5,10,10},
+	{10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+	{16,16,16,16,16,16,16,5,5,5,5,16,16,16,16,16},
+	{5,5,5,5,16,5,5,5,5,5,5,5,5,5,5,5},
+	{16,16,16,16,16,16,16,5,16,16,16,16,16,16,16,16},
+	{16,16,16,16,16,16,16,16,16,5,5,16,16,16,16,16},
+	{16,16,5,16,16,5,16,16,16,16,16,5,5,5,5,5},
+	{16,16,16,16,16,16,16,12,12,12,12,12,12,12,5,5},
+	{10,10,10,10,10,10,10,10,10,10,5,5,5,5,12,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,12,12,16,5},
+	{12,12,12,12,12,12,12,12,12,12,12,12,16,16,16,16},
+	{12,12,12,12,12,12,12,5,12,12,12,12,5,12,12,5},
+	{12,12,12,12,16,16,16,16,16,16,16,12,5,5,5,5},
+	{5,12,12,5,12,5,5,12,5,12,12,12,12,12,12,12},
+	{12,12,12,5,12,12,12,12,5,12,5,12,5,5,5,5},
+	{5,5,12,5,5,5,5,12,5,12,5,12,5,12,12,12},
+	{5,12,12,5,12,5,5,12,5,12,5,12,5,12,5,12},
+	{5,12,12,5,12,5,5,12,12,12,12,5,12,12,12,12},
+	{12,12,12,5,12,12,12,12,5,12,12,12,12,5,12,5},
+	{12,12,12,12,12,12,12,12,12,12,5,12,12,12,12,12},
+	{5,12,12,12,5,12,12,12,12,12,5,12,12,12,12,12},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,14,14,14},
+	{12,12,12,12,12,12,12,12,12,12,5,5,14,14,14,14},
+	{27,27,12,12,12,12,12,12,12,12,12,12,12,12,27,27},
+	{12,12,12,12,12,12,12,12,12,12,5,5,5,5,14,5},
+	{5,14,14,14,14,14,14,14,14,14,14,5,5,5,5,5},
+	{14,14,14,14,14,14,31,31,31,31,31,31,31,31,31,31},
+	{31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31},
+	{5,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14},
+	{5,5,5,5,5,5,5,5,5,5,14,5,5,5,5,5},
+	{5,5,14,14,14,14,14,14,14,14,14,5,14,14,14,14},
+	{14,14,14,14,14,14,14,14,14,14,14,16,16,16,16,16},
+	{14,14,14,14,14,14,14,14,14,14,14,14,14,14,5,5},
+	{5,5,5,5,5,5,14,14,14,14,14,14,14,14,14,14},
+	{5,5,5,5,14,14,14,14,14,14,14,14,14,14,14,14},
+	{5,5,5,5,5,14,14,14,14,14,14,14,14,14,14,14},
+	{5,5,5,5,5,5,5,5,5,5,5,5,14,14,14,14},
+	{5,5,5,5,5,5,5,5,14,14,14,14,14,14,14,14},
+	{5,5,5,5,5,5,5,5,5,5,14,14,14,14,14,14},
+	{5,5,5,5,5,5,5,5,5,5,5,5,5,5,14,14},
+	{14,14,14,14,14,14,14,14,14,14,14,5,14,14,14,14},
+	{0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+};
+
+constexpr auto lookup(char32_t c) -> record const& {
+	auto const cp = unsigned(c) < 0x110000u ? unsigned(c) : 0xFFFFFu; // noncharacter
+	auto const row = stage1[cp >> stage2_shift];
+	auto const block = stage2[row][(cp >> stage3_shift) & ((1u << (stage2_shift - stage3_shift)) - 1)];
+	return records[stage3[block][cp & ((1u << stage3_shift) - 1)]];
+}
+
+} // namespace strings::detail::segmentation
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STRINGS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(STRINGS_SSE2) && defined(__SSSE3__)
+#define STRINGS_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#if defined(STRINGS_SSE2) && defined(__AVX2__)
+#define STRINGS_AVX2
+#include <immintrin.h>
+#endif
+
+// block scanning helpers shared by the bulk string kernels
+//
+// - kernels process blocks of 64 codeunits, producing a bitmask where bit i
+//   corresponds to the codeunit at offset i
+// - the SSE2 paths are enabled on all x86-64 targets, the scalar paths are
+//   used elsewhere and for partial blocks
+// - AVX2 paths are only used when the compiler targets AVX2 (e.g. -mavx2)
+//
+namespace strings::detail {
+
+constexpr std::size_t block_size = 64;
+
+// scan_state caches the bitmask of the 64-codeunit block that was scanned
+// last, so that dense matches are found without rescanning
+struct scan_state {
+    std::size_t base = std::size_t(-1);
+    std::uint64_t bits = 0;
+};
+
+// scan_blocks returns the position of the first codeunit at or after from for
+// which mask(base, count) reports a match, or npos
+template <typename BlockMask>
+inline auto scan_blocks(std::size_t size, std::size_t from, scan_state& st, BlockMask&& mask) -> std::size_t
+{
+    while (from < size) {
+        auto const base = from & ~(block_size - 1);
+        if (base != st.base) {
+            st.base = base;
+            st.bits = mask(base, std::min(block_size, size - base));
+        }
+        if (auto const m = st.bits & (~std::uint64_t{0} << (from - base)))
+            return base + std::size_t(std::countr_zero(m));
+        from = base + block_size;
+    }
+    return std::size_t(-1);
+}
+
+// count_blocks returns the total number of bits set by mask over [0, size)
+template <typename BlockMask> inline auto count_blocks(std::size_t size, BlockMask&& mask) -> std::size_t
+{
+    auto n = std::size_t{0};
+    for (auto base = std::size_t{0}; base < size; base += block_size)
+        n += std::size_t(std::popcount(mask(base, std::min(block_size, size - base))));
+    return n;
+}
+
+// block_mask returns the bitmask of positions in [base, base + count) of the
+// buffer [data, data + size) that satisfy a byte predicate, count <= 64
+//
+// - match16 returns the 16-bit match mask of a vector, it is only called when
+//   SSE2 is available
+// - partial vectors at the end of the buffer are loaded so that they end at
+//   the end of the buffer, avoiding the scalar loop unless the buffer is tiny
+//
+template <typename Match16, typename Match>
+inline auto block_mask(char const* data, std::size_t size, std::size_t base, std::size_t count,
+    [[maybe_unused]] Match16&& match16, Match&& match) -> std::uint64_t
+{
+    auto m = std::uint64_t{0};
+    auto i = std::size_t{0};
+#ifdef STRINGS_SSE2
+    auto at = [&](std::size_t pos) {
+        return std::uint64_t(match16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + pos))));
+    };
+    for (; i + 16 <= count; i += 16)
+        m |= at(base + i) << i;
+    if (i != count && size >= 16) {
+        auto const rem = count - i;
+        return m | (at(base + count - 16) >> (16 - rem)) << i;
+    }
+#endif
+    for (; i < count; ++i)
+        m |= std::uint64_t(match(data[base + i])) << i;
+    return m;
+}
+
+// eq_mask is the block_mask of codeunits equal to c
+inline auto eq_mask(char const* data, std::size_t size, std::size_t base, std::size_t count, char c)
+    -> std::uint64_t
+{
+#ifdef STRINGS_SSE2
+    auto const v = _mm_set1_epi8(c);
+    auto match16 = [v](__m128i b) { return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(b, v))); };
+#else
+    auto match16 = [](auto) { return 0u; };
+#endif
+    return block_mask(data, size, base, count, match16, [c](char x) { return x == c; });
+}
+
+// byte_class is a set of byte values, precompiled for block classification
+//
+// - a 256-bit bitmap for the scalar path
+// - up to 16 distinct values are compared directly with SSE2
+// - with SSSE3, sets that span at most 8 distinct high nibbles are
+//   classified with two pshufb nibble lookups, regardless of their size
+//
+class byte_class {
+public:
+    constexpr byte_class() = default;
+
+    constexpr explicit byte_class(std::string_view chars)
+    {
+        for (auto c : chars)
+            add(static_cast<unsigned char>(c));
+    }
+
+    template <typename Pred>
+    requires requires(Pred p, unsigned c) { { p(c) } -> std::convertible_to<bool>; }
+    constexpr explicit byte_class(Pred pred)
+    {
+        for (auto c = 0u; c < 256u; ++c)
+            if (pred(c))
+                add(c);
+    }
+
+    constexpr auto contains(unsigned char c) const -> bool { return (bits_[c >> 6] >> (c & 63)) & 1; }
+    constexpr auto empty() const -> bool { return !(bits_[0] | bits_[1] | bits_[2] | bits_[3]); }
+
+    // mask is the block_mask of codeunits that belong to the class
+    auto mask(char const* data, std::size_t size, std::size_t base, std::size_t count) const -> std::uint64_t
+    {
+        auto match = [this](char c) { return contains(static_cast<unsigned char>(c)); };
+#ifdef STRINGS_SSSE3
+        if (nibble_ok_) {
+            auto const lo_t = _mm_loadu_si128(reinterpret_cast<__m128i const*>(lo_.data()));
+            auto const hi_t = _mm_loadu_si128(reinterpret_cast<__m128i const*>(hi_.data()));
+            auto const low4 = _mm_set1_epi8(0x0f);
+            auto match16 = [&](__m128i b) {
+                auto const lo = _mm_shuffle_epi8(lo_t, _mm_and_si128(b, low4));
+                auto const hi = _mm_shuffle_epi8(hi_t, _mm_and_si128(_mm_srli_epi16(b, 4), low4));
+                auto const hit = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+                return unsigned(_mm_movemask_epi8(hit)) ^ 0xffffu;
+            };
+            return block_mask(data, size, base, count, match16, match);
+        }
+#endif
+#ifdef STRINGS_SSE2
+        if (n_ && n_ <= 4) {
+            // small sets, e.g. delimiters: four fixed compares, unused slots
+            // repeat the first value
+            auto const v0 = _mm_set1_epi8(static_cast<char>(values_[0]));
+            auto const v1 = _mm_set1_epi8(static_cast<char>(values_[n_ > 1 ? 1 : 0]));
+            auto const v2 = _mm_set1_epi8(static_cast<char>(values_[n_ > 2 ? 2 : 0]));
+            auto const v3 = _mm_set1_epi8(static_cast<char>(values_[n_ > 3 ? 3 : 0]));
+            auto match16 = [&](__m128i b) {
+                auto const r = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(b, v0), _mm_cmpeq_epi8(b, v1)),
+                    _mm_or_si128(_mm_cmpeq_epi8(b, v2), _mm_cmpeq_epi8(b, v3)));
+                return unsigned(_mm_movemask_epi8(r));
+            };
+            return block_mask(data, size, base, count, match16, match);
+        }
+        if (n_ <= max_direct) {
+            __m128i v[max_direct];
+            for (auto i = 0u; i < n_; ++i)
+                v[i] = _mm_set1_epi8(static_cast<char>(values_[i]));
+            auto match16 = [&](__m128i b) {
+                auto r = _mm_setzero_si128();
+                for (auto i = 0u; i < n_; ++i)
+                    r = _mm_or_si128(r, _mm_cmpeq_epi8(b, v[i]));
+                return unsigned(_mm_movemask_epi8(r));
+            };
+            return block_mask(data, size, base, count, match16, match);
+        }
+#endif
+        auto m = std::uint64_t{0};
+        for (auto i = std::size_t{0}; i < count; ++i)
+            m |= std::uint64_t(match(data[base + i])) << i;
+        return m;
+    }
+
+    constexpr void add(unsigned c)
+    {
+        if (contains(static_cast<unsigned char>(c)))
+            return;
+        bits_[c >> 6] |= std::uint64_t{1} << (c & 63);
+        if (n_ < max_direct)
+            values_[n_] = static_cast<std::uint8_t>(c);
+        ++n_;
+
+        // nibble tables: one bit per distinct high nibble
+        auto const h = c >> 4;
+        if (!hi_[h]) {
+            if (hi_count_ == 8) {
+                nibble_ok_ = false;
+                return;
+            }
+            hi_[h] = static_cast<std::uint8_t>(1u << hi_count_++);
+        }
+        lo_[c & 15] |= hi_[h];
+    }
+
+private:
+    static constexpr unsigned max_direct = 16;
+
+    std::array<std::uint64_t, 4> bits_ = {};
+    std::array<std::uint8_t, max_direct> values_ = {};
+    unsigned n_ = 0;
+    std::array<std::uint8_t, 16> lo_ = {};
+    std::array<std::uint8_t, 16> hi_ = {};
+    unsigned hi_count_ = 0;
+    bool nibble_ok_ = true;
+};
+
+// sse2_ops and avx2_ops wrap the byte vector operations of the kernels that
+// are written once for both vector widths
+#ifdef STRINGS_SSE2
+struct sse2_ops {
+    using vec = __m128i;
+    static constexpr std::size_t width = 16;
+    static constexpr std::uint32_t all = 0xffff;
+
+    static auto load(char const* p) -> vec { return _mm_loadu_si128(reinterpret_cast<vec const*>(p)); }
+    static void store(char* p, vec v) { _mm_storeu_si128(reinterpret_cast<vec*>(p), v); }
+    static auto set1(char c) -> vec { return _mm_set1_epi8(c); }
+    static auto sub(vec a, vec b) -> vec { return _mm_sub_epi8(a, b); }
+    static auto and_(vec a, vec b) -> vec { return _mm_and_si128(a, b); }
+    static auto or_(vec a, vec b) -> vec { return _mm_or_si128(a, b); }
+    static auto xor_(vec a, vec b) -> vec { return _mm_xor_si128(a, b); }
+    // le returns the lanes where a <= b as unsigned bytes
+    static auto le(vec a, vec b) -> vec { return _mm_cmpeq_epi8(_mm_min_epu8(a, b), a); }
+    static auto bits(vec m) -> std::uint32_t { return std::uint32_t(_mm_movemask_epi8(m)); }
+};
+#endif
+
+#ifdef STRINGS_AVX2
+struct avx2_ops {
+    using vec = __m256i;
+    static constexpr std::size_t width = 32;
+    static constexpr std::uint32_t all = 0xffffffff;
+
+    static auto load(char const* p) -> vec { return _mm256_loadu_si256(reinterpret_cast<vec const*>(p)); }
+    static void store(char* p, vec v) { _mm256_storeu_si256(reinterpret_cast<vec*>(p), v); }
+    static auto set1(char c) -> vec { return _mm256_set1_epi8(c); }
+    static auto sub(vec a, vec b) -> vec { return _mm256_sub_epi8(a, b); }
+    static auto and_(vec a, vec b) -> vec { return _mm256_and_si256(a, b); }
+    static auto or_(vec a, vec b) -> vec { return _mm256_or_si256(a, b); }
+    static auto xor_(vec a, vec b) -> vec { return _mm256_xor_si256(a, b); }
+    static auto le(vec a, vec b) -> vec { return _mm256_cmpeq_epi8(_mm256_min_epu8(a, b), a); }
+    static auto bits(vec m) -> std::uint32_t { return std::uint32_t(_mm256_movemask_epi8(m)); }
+};
+#endif
+
+} // namespace strings::detail
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "aho_corasick.hpp"
 #include "ascii.hpp"
 #include "codec.hpp"
+#include "simd.hpp"
 #include "trim.hpp"
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 
 namespace strings {
@@ -10,7 +18,7 @@ namespace strings {
 // split - calls SegmentHandler for each of subviews while splitting the input
 // string with the specified separator
 template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
-requires(std::convertible_to<Input, std::basic_string_view<U>> && std::convertible_to<Input, std::basic_string_view<U>>)
+requires(std::convertible_to<Input, std::basic_string_view<U>> && std::convertible_to<Separator, std::basic_string_view<U>>)
 void split(Input const& input, Separator const& separator, std::invocable<std::basic_string_view<U>> auto&& f)
 {
     using string_view_type = typename std::basic_string_view<U>;
@@ -28,6 +36,7 @@ void split(Input const& input, Separator const& separator, std::invocable<std::b
 }
 
 template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Separator, std::basic_string_view<U>>
 void split(Input const& input, Separator const& separator, trimming_predicate auto tr, trim_side side,
     std::invocable<std::basic_string_view<U>> auto&& f)
 {
@@ -46,6 +55,7 @@ void split(Input const& input, Separator const& separator, trimming_predicate au
 }
 
 template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Separator, std::basic_string_view<U>>
 void split(Input const& input, Separator const& separator, trimming_predicate auto tr,
     std::invocable<std::basic_string_view<U>> auto&& f)
 {
@@ -53,6 +63,441 @@ void split(Input const& input, Separator const& separator, trimming_predicate au
     split<Input, Separator, U>(input, separator, tr, trim_side::front_and_back, std::forward<ft&&>(f));
 }
 
+namespace detail {
+
+struct separator_match {
+    std::size_t pos;
+    std::size_t size;
+};
+
+// literal_separator finds occurrences of a separator string
+//
+// - the separator string is not owned, except for single codeunit separators
+// - single codeunit separators, and the first codeunit of short ones, are
+//   located with block scans
+// - longer separators use a precomputed boyer_moore_horspool_searcher
+// - an empty separator never matches
+//
+template <typename U> class literal_separator {
+public:
+    using string_view_type = std::basic_string_view<U>;
+    using state_type = scan_state;
+
+    explicit literal_separator(U sep)
+        : first_{sep}
+        , size_{1}
+    {
+    }
+
+    explicit literal_separator(string_view_type sep)
+        : sep_{sep}
+        , first_{sep.empty() ? U{} : sep[0]}
+        , size_{sep.size()}
+    {
+        if (size_ >= searcher_threshold)
+            searcher_ = std::make_shared<searcher_type const>(sep_.data(), sep_.data() + sep_.size());
+    }
+
+    auto find(string_view_type sv, std::size_t from, state_type& st) const -> std::optional<separator_match>
+    {
+        // fast path: the next single codeunit separator is in the cached block
+        if constexpr (sizeof(U) == 1)
+            if (size_ == 1 && from - st.base < block_size)
+                if (auto const m = st.bits & (~std::uint64_t{0} << (from - st.base)))
+                    return separator_match{st.base + std::size_t(std::countr_zero(m)), 1};
+        return find_scan(sv, from, st);
+    }
+
+    // count returns the number of separators that split finds in sv
+    auto count(string_view_type sv) const -> std::size_t
+    {
+        if constexpr (sizeof(U) == 1)
+            if (size_ == 1) {
+                auto const data = reinterpret_cast<char const*>(sv.data());
+                auto const c = char(first_);
+                return count_blocks(sv.size(),
+                    [=](std::size_t base, std::size_t count) { return eq_mask(data, sv.size(), base, count, c); });
+            }
+        auto n = std::size_t{0};
+        auto st = state_type{};
+        auto from = std::size_t{0};
+        while (auto m = find(sv, from, st)) {
+            from = m->pos + m->size;
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    using searcher_type = std::boyer_moore_horspool_searcher<U const*>;
+    static constexpr std::size_t searcher_threshold = 8;
+
+    auto find_scan(string_view_type sv, std::size_t from, state_type& st) const -> std::optional<separator_match>
+    {
+        auto const n = size_;
+        if (!n || from > sv.size())
+            return {};
+        if (searcher_)
+            return find_with_searcher(sv, from);
+
+        while (true) {
+            auto const pos = find_first(sv, from, st);
+            if (pos == std::size_t(-1) || pos + n > sv.size())
+                return {};
+            if (n == 1 || sv.compare(pos, n, sep_) == 0)
+                return separator_match{pos, n};
+            from = pos + 1;
+        }
+    }
+
+    auto find_first(string_view_type sv, std::size_t from, state_type& st) const -> std::size_t
+    {
+        if constexpr (sizeof(U) == 1) {
+            auto const data = reinterpret_cast<char const*>(sv.data());
+            auto const c = char(first_);
+            return scan_blocks(sv.size(), from, st,
+                [=](std::size_t base, std::size_t count) { return eq_mask(data, sv.size(), base, count, c); });
+        }
+        else
+            return sv.find(first_, from);
+    }
+
+    auto find_with_searcher(string_view_type sv, std::size_t from) const -> std::optional<separator_match>
+    {
+        auto const last = sv.data() + sv.size();
+        auto const p = (*searcher_)(sv.data() + from, last).first;
+        if (p == last)
+            return {};
+        return separator_match{std::size_t(p - sv.data()), size_};
+    }
+
+    string_view_type sep_;
+    U first_;
+    std::size_t size_;
+    std::shared_ptr<searcher_type const> searcher_; // shared, the searcher tables are large
+};
+
+// no_trimming is the split_view trimming predicate for untrimmed segments
+struct no_trimming {
+    constexpr auto operator()(unsigned) const -> bool { return false; }
+};
+
+} // namespace detail
+
+// separator_finder matches the separator types that can be used with
+// split_view and with the callback split overloads below
+template <typename S, typename U>
+concept separator_finder = requires(
+    S const& s, std::basic_string_view<U> sv, std::size_t from, typename S::state_type& st) {
+    { s.find(sv, from, st) } -> std::same_as<std::optional<detail::separator_match>>;
+};
+
+// any_char_separator matches any single codeunit from a set, see any_char_of
+//
+// single byte codeunits are classified in blocks with a precompiled
+// detail::byte_class
+//
+template <typename U> class any_char_separator {
+public:
+    using string_view_type = std::basic_string_view<U>;
+    using state_type = detail::scan_state;
+
+    explicit any_char_separator(string_view_type chars)
+    {
+        if constexpr (sizeof(U) == 1)
+            for (auto c : chars)
+                class_.add(static_cast<std::uint8_t>(c));
+        else
+            chars_ = chars;
+    }
+
+    auto find(string_view_type sv, std::size_t from, state_type& st) const -> std::optional<detail::separator_match>
+    {
+        if constexpr (sizeof(U) == 1) {
+            if (from - st.base < detail::block_size)
+                if (auto const m = st.bits & (~std::uint64_t{0} << (from - st.base)))
+                    return detail::separator_match{st.base + std::size_t(std::countr_zero(m)), 1};
+            auto const data = reinterpret_cast<char const*>(sv.data());
+            auto const pos = detail::scan_blocks(sv.size(), from, st,
+                [&](std::size_t base, std::size_t count) { return class_.mask(data, sv.size(), base, count); });
+            if (pos == std::size_t(-1))
+                return {};
+            return detail::separator_match{pos, 1};
+        }
+        else {
+            auto const pos = sv.find_first_of(chars_, from);
+            if (pos == string_view_type::npos)
+                return {};
+            return detail::separator_match{pos, 1};
+        }
+    }
+
+    // count returns the number of separators that split finds in sv
+    auto count(string_view_type sv) const -> std::size_t
+    {
+        if constexpr (sizeof(U) == 1) {
+            auto const data = reinterpret_cast<char const*>(sv.data());
+            return detail::count_blocks(sv.size(),
+                [&](std::size_t base, std::size_t count) { return class_.mask(data, sv.size(), base, count); });
+        }
+        else {
+            auto n = std::size_t{0};
+            for (auto pos = sv.find_first_of(chars_); pos != string_view_type::npos;
+                 pos = sv.find_first_of(chars_, pos + 1))
+                ++n;
+            return n;
+        }
+    }
+
+private:
+    detail::byte_class class_;
+    std::basic_string<U> chars_;
+};
+
+// any_string_separator matches any of several separator strings, see
+// any_string_of
+//
+// - matching uses a shared aho_corasick automaton
+// - the leftmost separator wins, and among the separators that start at the
+//   same position, the longest one, as with multi_replacer; e.g. {"\r\n",
+//   "\n"} splits lines with either line ending
+//
+template <typename U> class any_string_separator {
+public:
+    using string_view_type = std::basic_string_view<U>;
+    using state_type = detail::scan_state;
+
+    template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, string_view_type>
+    explicit any_string_separator(R const& separators)
+        : ac_{std::make_shared<aho_corasick<U> const>(separators)}
+    {
+    }
+
+    auto find(string_view_type sv, std::size_t from, state_type& st) const -> std::optional<detail::separator_match>
+    {
+        if (auto m = ac_->find_leftmost(sv, from, st, match_kind::leftmost_longest))
+            return detail::separator_match{m->pos, m->size};
+        return {};
+    }
+
+private:
+    std::shared_ptr<aho_corasick<U> const> ac_;
+};
+
+// any_char_of - separator that matches any of the specified codeunits
+//
+//   split(input, any_char_of(",;\t"), f);
+//
+template <typename Chars, typename U = codeunit_type_of<Chars>>
+requires std::convertible_to<Chars, std::basic_string_view<U>>
+auto any_char_of(Chars const& chars)
+{
+    return any_char_separator<U>{std::basic_string_view<U>(chars)};
+}
+
+// any_string_of - separator that matches any of the specified strings
+//
+//   split(input, any_string_of({"\r\n", "\n"}), f);
+//
+template <typename U = char>
+auto any_string_of(std::initializer_list<std::type_identity_t<std::basic_string_view<U>>> separators)
+{
+    return any_string_separator<U>{std::ranges::subrange(separators.begin(), separators.end())};
+}
+
+template <std::ranges::input_range R, typename U = codeunit_type_of<std::ranges::range_value_t<R>>>
+requires std::convertible_to<std::ranges::range_reference_t<R>, std::basic_string_view<U>>
+auto any_string_of(R const& separators)
+{
+    return any_string_separator<U>{separators};
+}
+
+// split_view is a lazy forward range of segments produced by splitting the
+// input with a separator
+//
+// - segments are subviews of the input, the input and the separator string
+//   must outlive the view
+// - the view must outlive its iterators
+// - segments are trimmed with the optional trimming predicate as they are
+//   produced
+//
+template <typename U, typename Separator = detail::literal_separator<U>, typename Trim = detail::no_trimming>
+class split_view : public std::ranges::view_interface<split_view<U, Separator, Trim>> {
+public:
+    using string_view_type = std::basic_string_view<U>;
+
+    split_view() = default;
+
+    split_view(string_view_type input, Separator sep, Trim tr = {}, trim_side side = trim_side::front_and_back)
+        : input_{input}
+        , sep_{std::move(sep)}
+        , tr_{tr}
+        , side_{side}
+    {
+    }
+
+    class iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = string_view_type;
+
+        iterator() = default;
+
+        auto operator*() const -> reference
+        {
+            auto const seg = parent_->input_.substr(cur_, end_ - cur_);
+            if constexpr (std::same_as<Trim, detail::no_trimming>)
+                return seg;
+            else
+                return trim(seg, parent_->tr_, parent_->side_);
+        }
+
+        auto operator++() -> iterator&
+        {
+            if (next_ == npos)
+                cur_ = npos;
+            else {
+                cur_ = next_;
+                advance();
+            }
+            return *this;
+        }
+
+        auto operator++(int) -> iterator
+        {
+            auto t = *this;
+            ++*this;
+            return t;
+        }
+
+        friend auto operator==(iterator const& a, iterator const& b) -> bool { return a.cur_ == b.cur_; }
+        friend auto operator==(iterator const& a, std::default_sentinel_t) -> bool { return a.cur_ == npos; }
+
+    private:
+        friend class split_view;
+        static constexpr auto npos = std::size_t(-1);
+
+        explicit iterator(split_view const* parent)
+            : parent_{parent}
+            , cur_{0}
+        {
+            advance();
+        }
+
+        void advance()
+        {
+            if (auto m = parent_->sep_.find(parent_->input_, cur_, state_)) {
+                end_ = m->pos;
+                next_ = m->pos + m->size;
+            }
+            else {
+                end_ = parent_->input_.size();
+                next_ = npos;
+            }
+        }
+
+        split_view const* parent_ = nullptr;
+        std::size_t cur_ = npos;
+        std::size_t end_ = npos;
+        std::size_t next_ = npos;
+        typename Separator::state_type state_ = {};
+    };
+
+    auto begin() const -> iterator { return iterator{this}; }
+    auto end() const -> std::default_sentinel_t { return {}; }
+
+private:
+    string_view_type input_;
+    Separator sep_;
+    [[no_unique_address]] Trim tr_;
+    trim_side side_ = trim_side::front_and_back;
+};
+
+// make_split_view - produces a lazy split_view over the input string
+//
+//   for (auto line : make_split_view(text, '\n'))
+//       for (auto field : make_split_view(line, '\t', trim_spaces_only))
+//           ...
+//
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto make_split_view(Input const& input, std::type_identity_t<std::basic_string_view<U>> separator)
+{
+    return split_view<U>{std::basic_string_view<U>(input), detail::literal_separator<U>{separator}};
+}
+
+template <typename Input, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto make_split_view(Input const& input, std::type_identity_t<U> separator)
+{
+    return split_view<U>{std::basic_string_view<U>(input), detail::literal_separator<U>{separator}};
+}
+
+template <typename Input, typename U = codeunit_type_of<Input>, trimming_predicate Trim>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto make_split_view(
+    Input const& input, std::type_identity_t<std::basic_string_view<U>> separator, Trim tr,
+    trim_side side = trim_side::front_and_back)
+{
+    using sep_type = detail::literal_separator<U>;
+    return split_view<U, sep_type, Trim>{std::basic_string_view<U>(input), sep_type{separator}, tr, side};
+}
+
+template <typename Input, typename U = codeunit_type_of<Input>, trimming_predicate Trim>
+requires std::convertible_to<Input, std::basic_string_view<U>>
+auto make_split_view(Input const& input, std::type_identity_t<U> separator, Trim tr, trim_side side = trim_side::front_and_back)
+{
+    using sep_type = detail::literal_separator<U>;
+    return split_view<U, sep_type, Trim>{std::basic_string_view<U>(input), sep_type{separator}, tr, side};
+}
+
+template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>> && separator_finder<Separator, U>
+auto make_split_view(Input const& input, Separator const& separator)
+{
+    return split_view<U, Separator>{std::basic_string_view<U>(input), separator};
+}
+
+template <typename Input, typename Separator, typename U = codeunit_type_of<Input>, trimming_predicate Trim>
+requires std::convertible_to<Input, std::basic_string_view<U>> && separator_finder<Separator, U>
+auto make_split_view(Input const& input, Separator const& separator, Trim tr, trim_side side = trim_side::front_and_back)
+{
+    return split_view<U, Separator, Trim>{std::basic_string_view<U>(input), separator, tr, side};
+}
+
+// split overloads for any_char_of, any_string_of, and other separator_finder
+// separators
+template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>> && separator_finder<Separator, U>
+void split(Input const& input, Separator const& separator, std::invocable<std::basic_string_view<U>> auto&& f)
+{
+    for (auto s : split_view<U, Separator>{std::basic_string_view<U>(input), separator})
+        f(s);
+}
+
+template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>> && separator_finder<Separator, U>
+void split(Input const& input, Separator const& separator, trimming_predicate auto tr, trim_side side,
+    std::invocable<std::basic_string_view<U>> auto&& f)
+{
+    using trim_type = decltype(tr);
+    for (auto s : split_view<U, Separator, trim_type>{std::basic_string_view<U>(input), separator, tr, side})
+        f(s);
+}
+
+template <typename Input, typename Separator, typename U = codeunit_type_of<Input>>
+requires std::convertible_to<Input, std::basic_string_view<U>> && separator_finder<Separator, U>
+void split(Input const& input, Separator const& separator, trimming_predicate auto tr,
+    std::invocable<std::basic_string_view<U>> auto&& f)
+{
+    split(input, separator, tr, trim_side::front_and_back, f);
+}
+
 struct numeric_section_result {
     using size_type = std::string_view::size_type;
     size_type pos = 0;
@@ -1,20 +1,114 @@
 #pragma once
 
 #include "codec.hpp"
+#include "simd.hpp"
+#include <bit>
+#include <concepts>
+#include <cstdint>
 #include <string_view>
+#include <type_traits>
 
 namespace strings {
 
+// is_ctrl_or_space - ascii control characters and unicode whitespace
+constexpr auto is_ctrl_or_space(char32_t codepoint) -> bool
+{
+    return codepoint <= U'\u0020' ||                             // Space
+           codepoint == U'\u007f' ||                             // Delete character
+           codepoint == U'\u00A0' ||                             // No-Break Space
+           codepoint == U'\u1680' ||                             // Ogham Space Mark
+           (codepoint >= U'\u2000' && codepoint <= U'\u200A') || // En Quad to Hair Space
+           codepoint == U'\u202F' ||                             // Narrow No-Break Space
+           codepoint == U'\u205F' ||                             // Medium Mathematical Space
+           codepoint == U'\u3000' ||                             // Ideographic Space
+           codepoint == U'\u200B';                               // Zero Width Space
+}
+
 namespace trim_detail {
 constexpr auto is_space(unsigned c) -> bool { return c == ' '; }
 constexpr auto is_space_or_tab(unsigned c) -> bool { return c == '\t' || c == ' '; }
 constexpr auto is_non_printable(unsigned c) -> bool { return c <= 32; }
+
+// the predicates of the trim_xxx aliases, with SSE2 the match16 members
+// classify 16 byte codeunits at once for the vectorized trim of long padding
+struct spaces_only {
+    constexpr auto operator()(unsigned c) const -> bool { return is_space(c); }
+#ifdef STRINGS_SSE2
+    static auto match16(__m128i v) -> unsigned
+    {
+        return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(' '))));
+    }
+#endif
+};
+
+struct spaces_and_tabs {
+    constexpr auto operator()(unsigned c) const -> bool { return is_space_or_tab(c); }
+#ifdef STRINGS_SSE2
+    static auto match16(__m128i v) -> unsigned
+    {
+        auto const m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+        return unsigned(_mm_movemask_epi8(m));
+    }
+#endif
+};
+
+struct non_printables {
+    constexpr auto operator()(unsigned c) const -> bool { return is_non_printable(c); }
+#ifdef STRINGS_SSE2
+    static auto match16(__m128i v) -> unsigned
+    {
+        // unsigned v <= 32
+        return unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(32)), v)));
+    }
+#endif
+};
+
+// skip_front returns the position of the first codeunit in [b, e) that does
+// not satisfy tr
+template <typename U, typename F> constexpr auto skip_front(U const* p, std::size_t b, std::size_t e, F const& tr)
+{
+    using cu = std::make_unsigned_t<U>;
+#ifdef STRINGS_SSE2
+    if constexpr (sizeof(U) == 1 && requires(__m128i v) { F::match16(v); })
+        if (!std::is_constant_evaluated())
+            while (e - b >= 16) {
+                auto const m = F::match16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + b)));
+                if (m != 0xffff)
+                    return b + std::size_t(std::countr_one(m));
+                b += 16;
+            }
+#endif
+    while (b != e && tr(cu(p[b])))
+        ++b;
+    return b;
+}
+
+// skip_back returns the end of [b, e) without the trailing codeunits that
+// satisfy tr
+template <typename U, typename F> constexpr auto skip_back(U const* p, std::size_t b, std::size_t e, F const& tr)
+{
+    using cu = std::make_unsigned_t<U>;
+#ifdef STRINGS_SSE2
+    if constexpr (sizeof(U) == 1 && requires(__m128i v) { F::match16(v); })
+        if (!std::is_constant_evaluated())
+            while (e - b >= 16) {
+                auto const m = F::match16(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + e - 16)));
+                if (m != 0xffff)
+                    return e - std::size_t(std::countl_one(std::uint16_t(m)));
+                e -= 16;
+            }
+#endif
+    while (b != e && tr(cu(p[e - 1])))
+        --e;
+    return e;
+}
+
 } // namespace trim_detail
 
 // aliases to use in trim-like functions (to make the code look nicer)
-constexpr auto trim_spaces_only(unsigned c) { return trim_detail::is_space(c); }
-constexpr auto trim_spaces_and_tabs(unsigned c) { return trim_detail::is_space_or_tab(c); }
-constexpr auto trim_non_printables(unsigned c) { return trim_detail::is_non_printable(c); }
+inline constexpr auto trim_spaces_only = trim_detail::spaces_only{};
+inline constexpr auto trim_spaces_and_tabs = trim_detail::spaces_and_tabs{};
+inline constexpr auto trim_non_printables = trim_detail::non_printables{};
 
 template <typename F>
 concept trimming_predicate = requires(F&& f, unsigned c) {
@@ -30,25 +124,89 @@ enum class trim_side {
 };
 
 // trim - produces a subview int the Intput string with content trimmed at the specified sides
+//
+// byte strings trimmed with trim_spaces_only, trim_spaces_and_tabs, or
+// trim_non_printables are scanned 16 codeunits at a time
+//
 [[nodiscard]] constexpr auto trim(convertible_to_string_view_input auto const& s, trimming_predicate auto tr,
     trim_side side = trim_side::front_and_back)
 {
     using string_view_type = string_view_type_of<decltype(s)>;
+
+    auto sv = string_view_type(s);
+
+    auto b = std::size_t{0};
+    auto e = sv.size();
+    if (side != trim_side::back)
+        b = trim_detail::skip_front(sv.data(), b, e, tr);
+
+    if (side != trim_side::front)
+        e = trim_detail::skip_back(sv.data(), b, e, tr);
+    return sv.substr(b, e - b);
+}
+
+// trim_codepoints - trim with a predicate over codepoints, e.g.
+// is_ctrl_or_space
+//
+// - utf8 and utf16 input is decoded only at the trimmed edges, ascii
+//   codeunits are tested without decoding
+// - malformed sequences are never trimmed
+//
+[[nodiscard]] constexpr auto trim_codepoints(convertible_to_string_view_input auto const& s,
+    std::predicate<char32_t> auto pred, trim_side side = trim_side::front_and_back)
+{
+    using string_view_type = string_view_type_of<decltype(s)>;
     using ct = typename string_view_type::value_type;
     using cu = std::make_unsigned_t<ct>;
-    
+    constexpr auto enc = utf::encoding_of<ct>;
+
     auto sv = string_view_type(s);
 
+    // decoded returns the end of the codepoint at [i, e) if it satisfies pred
+    auto decoded = [&](std::size_t i, std::size_t e) -> std::size_t {
+        if (cu(sv[i]) < 0x80u)
+            return pred(char32_t(cu(sv[i]))) ? i + 1 : i;
+        auto cp = codepoint{};
+        auto const last = to_codepoint<enc>(sv.begin() + i, sv.begin() + e, cp, unexpected_policy::consume_one);
+        if (!unicode::is_valid(cp) || !pred(char32_t(cp.value)))
+            return i;
+        return std::size_t(last - sv.begin());
+    };
+
     auto b = std::size_t{0};
     auto e = sv.size();
     if (side != trim_side::back)
-        while (b != e && tr(cu(sv[b])))
-            ++b;
+        while (b != e) {
+            auto const next = decoded(b, e);
+            if (next == b)
+                break;
+            b = next;
+        }
 
     if (side != trim_side::front)
-        while (b != e && tr(cu(sv[e - 1])))
-            --e;
+        while (b != e) {
+            // step back to the start of the last codepoint
+            auto i = e - 1;
+            if constexpr (enc == encoding::utf8)
+                while (i != b && e - i < 4 && (cu(sv[i]) & 0xC0u) == 0x80u)
+                    --i;
+            else if constexpr (enc == encoding::utf16)
+                if (i != b && unicode::is_low_surrogate(codepoint{cu(sv[i])}) &&
+                    unicode::is_high_surrogate(codepoint{cu(sv[i - 1])}))
+                    --i;
+            if (decoded(i, e) != e)
+                break;
+            e = i;
+        }
     return sv.substr(b, e - b);
 }
 
-} // namespace strings
\ No newline at end of file
+// trim_unicode_spaces - trims ascii control characters and unicode whitespace
+// (is_ctrl_or_space) from utf8, utf16, or utf32 input
+[[nodiscard]] constexpr auto trim_unicode_spaces(
+    convertible_to_string_view_input auto const& s, trim_side side = trim_side::front_and_back)
+{
+    return trim_codepoints(s, is_ctrl_or_space, side);
+}
+
+} // namespace strings
@@ -0,0 +1,1137 @@
+#pragma once
+
+// DO NOT EDIT: Generated file
+// clang-format off
+
+#include <cstdint>
+#include <optional>
+
+namespace strings::unicode {
+
+// general_category - the Unicode General_Category property values, grouped by
+// major class
+enum class general_category : std::uint8_t {
+	uppercase_letter, // Lu
+	lowercase_letter, // Ll
+	titlecase_letter, // Lt
+	modifier_letter, // Lm
+	other_letter, // Lo
+	nonspacing_mark, // Mn
+	spacing_mark, // Mc
+	enclosing_mark, // Me
+	decimal_number, // Nd
+	letter_number, // Nl
+	other_number, // No
+	connector_punctuation, // Pc
+	dash_punctuation, // Pd
+	open_punctuation, // Ps
+	close_punctuation, // Pe
+	initial_punctuation, // Pi
+	final_punctuation, // Pf
+	other_punctuation, // Po
+	math_symbol, // Sm
+	currency_symbol, // Sc
+	modifier_symbol, // Sk
+	other_symbol, // So
+	space_separator, // Zs
+	line_separator, // Zl
+	paragraph_separator, // Zp
+	control, // Cc
+	format, // Cf
+	surrogate, // Cs
+	private_use, // Co
+	unassigned, // Cn
+};
+
+namespace detail::properties {
+
+// general category, White_Space, and numeric value per codepoint
+// generated from: unicode.org/Public/14.0.0/ucd/UnicodeData.txt, PropList.txt, DerivedNumericValues.txt
+// total: 236 records, 143 numeric values, 24664 bytes
+//
+// codepoint bits [20..9] index stage1, which selects a row of stage2
+// codepoint bits [8..4] index the row, which selects a block of stage3
+// codepoint bits [3..0] index the block, which selects a record
+//
+constexpr unsigned stage2_shift = 9;
+constexpr unsigned stage3_shift = 4;
+
+struct record {
+	general_category category;
+	bool white_space;
+	std::uint8_t numeric; // index in numeric_values, 0: not numeric
+};
+
+struct numeric_fraction {
+	std::int64_t numerator;
+	std::int32_t denominator;
+};
+
+constexpr numeric_fraction numeric_values[143] = {
+	{0,1},{0,1},{1,1},{2,1},{3,1},{4,1},{5,1},{6,1},{7,1},{8,1},{9,1},{1,4},
+	{1,2},{3,4},{1,16},{1,8},{3,16},{16,1},{10,1},{100,1},{1000,1},{1,160},{1,40},{3,80},
+	{1,20},{1,10},{3,20},{1,5},{3,2},{5,2},{7,2},{9,2},{11,2},{13,2},{15,2},{17,2},
+	{-1,2},{20,1},{30,1},{40,1},{50,1},{60,1},{70,1},{80,1},{90,1},{10000,1},{17,1},{18,1},
+	{19,1},{1,7},{1,9},{1,3},{2,3},{2,5},{3,5},{4,5},{1,6},{5,6},{3,8},{5,8},
+	{7,8},{11,1},{12,1},{500,1},{5000,1},{50000,1},{100000,1},{13,1},{14,1},{15,1},{21,1},{22,1},
+	{23,1},{24,1},{25,1},{26,1},{27,1},{28,1},{29,1},{31,1},{32,1},{33,1},{34,1},{35,1},
+	{36,1},{37,1},{38,1},{39,1},{41,1},{42,1},{43,1},{44,1},{45,1},{46,1},{47,1},{48,1},
+	{49,1},{100000000,1},{1000000000000,1},{200,1},{300,1},{400,1},{600,1},{700,1},{800,1},{900,1},{2000,1},{3000,1},
+	{4000,1},{6000,1},{7000,1},{8000,1},{9000,1},{20000,1},{30000,1},{40000,1},{60000,1},{70000,1},{80000,1},{90000,1},
+	{11,12},{200000,1},{300000,1},{400000,1},{500000,1},{600000,1},{700000,1},{800000,1},{900000,1},{1,12},{5,12},{7,12},
+	{1,320},{1,80},{1,64},{1,32},{3,64},{216000,1},{432000,1},{1000000,1},{10000000000,1},{10000000,1},{20000000,1},
+};
+
+constexpr record records[236] = {
+	{general_category(25),false,0},{general_category(25),true,0},{general_category(22),true,0},{general_category(17),false,0},{general_category(19),false,0},{general_category(13),false,0},{general_category(14),false,0},{general_category(18),false,0},
+	{general_category(12),false,0},{general_category(8),false,1},{general_category(8),false,2},{general_category(8),false,3},{general_category(8),false,4},{general_category(8),false,5},{general_category(8),false,6},{general_category(8),false,7},
+	{general_category(8),false,8},{general_category(8),false,9},{general_category(8),false,10},{general_category(0),false,0},{general_category(20),false,0},{general_category(11),false,0},{general_category(1),false,0},{general_category(21),false,0},
+	{general_category(4),false,0},{general_category(15),false,0},{general_category(26),false,0},{general_category(10),false,3},{general_category(10),false,4},{general_category(10),false,2},{general_category(16),false,0},{general_category(10),false,11},
+	{general_category(10),false,12},{general_category(10),false,13},{general_category(2),false,0},{general_category(3),false,0},{general_category(5),false,0},{general_category(29),false,0},{general_category(7),false,0},{general_category(6),false,0},
+	{general_category(10),false,14},{general_category(10),false,15},{general_category(10),false,16},{general_category(10),false,17},{general_category(10),false,18},{general_category(10),false,19},{general_category(10),false,20},{general_category(10),false,1},
+	{general_category(10),false,21},{general_category(10),false,22},{general_category(10),false,23},{general_category(10),false,24},{general_category(10),false,25},{general_category(10),false,26},{general_category(10),false,27},{general_category(10),false,28},
+	{general_category(10),false,29},{general_category(10),false,30},{general_category(10),false,31},{general_category(10),false,32},{general_category(10),false,33},{general_category(10),false,34},{general_category(10),false,35},{general_category(10),false,36},
+	{general_category(10),false,5},{general_category(10),false,6},{general_category(10),false,7},{general_category(10),false,8},{general_category(10),false,9},{general_category(10),false,10},{general_category(10),false,37},{general_category(10),false,38},
+	{general_category(10),false,39},{general_category(10),false,40},{general_category(10),false,41},{general_category(10),false,42},{general_category(10),false,43},{general_category(10),false,44},{general_category(10),false,45},{general_category(9),false,46},
+	{general_category(9),false,47},{general_category(9),false,48},{general_category(23),true,0},{general_category(24),true,0},{general_category(10),false,49},{general_category(10),false,50},{general_category(10),false,51},{general_category(10),false,52},
+	{general_category(10),false,53},{general_category(10),false,54},{general_category(10),false,55},{general_category(10),false,56},{general_category(10),false,57},{general_category(10),false,58},{general_category(10),false,59},{general_category(10),false,60},
+	{general_category(9),false,2},{general_category(9),false,3},{general_category(9),false,4},{general_category(9),false,5},{general_category(9),false,6},{general_category(9),false,7},{general_category(9),false,8},{general_category(9),false,9},
+	{general_category(9),false,10},{general_category(9),false,18},{general_category(9),false,61},{general_category(9),false,62},{general_category(9),false,40},{general_category(9),false,19},{general_category(9),false,63},{general_category(9),false,20},
+	{general_category(9),false,64},{general_category(9),false,45},{general_category(9),false,65},{general_category(9),false,66},{general_category(10),false,61},{general_category(10),false,62},{general_category(10),false,67},{general_category(10),false,68},
+	{general_category(10),false,69},{general_category(10),false,46},{general_category(10),false,47},{general_category(10),false,48},{general_category(9),false,1},{general_category(9),false,37},{general_category(9),false,38},{general_category(10),false,70},
+	{general_category(10),false,71},{general_category(10),false,72},{general_category(10),false,73},{general_category(10),false,74},{general_category(10),false,75},{general_category(10),false,76},{general_category(10),false,77},{general_category(10),false,78},
+	{general_category(10),false,79},{general_category(10),false,80},{general_category(10),false,81},{general_category(10),false,82},{general_category(10),false,83},{general_category(10),false,84},{general_category(10),false,85},{general_category(10),false,86},
+	{general_category(10),false,87},{general_category(10),false,88},{general_category(10),false,89},{general_category(10),false,90},{general_category(10),false,91},{general_category(10),false,92},{general_category(10),false,93},{general_category(10),false,94},
+	{general_category(10),false,95},{general_category(10),false,96},{general_category(4),false,6},{general_category(4),false,3},{general_category(4),false,8},{general_category(4),false,2},{general_category(4),false,45},{general_category(4),false,4},
+	{general_category(4),false,10},{general_category(4),false,5},{general_category(4),false,97},{general_category(4),false,18},{general_category(4),false,20},{general_category(4),false,19},{general_category(4),false,98},{general_category(4),false,9},
+	{general_category(4),false,7},{general_category(4),false,37},{general_category(4),false,38},{general_category(4),false,39},{general_category(4),false,1},{general_category(27),false,0},{general_category(28),false,0},{general_category(10),false,99},
+	{general_category(10),false,100},{general_category(10),false,101},{general_category(10),false,63},{general_category(10),false,102},{general_category(10),false,103},{general_category(10),false,104},{general_category(10),false,105},{general_category(10),false,106},
+	{general_category(10),false,107},{general_category(10),false,108},{general_category(10),false,64},{general_category(10),false,109},{general_category(10),false,110},{general_category(10),false,111},{general_category(10),false,112},{general_category(10),false,113},
+	{general_category(10),false,114},{general_category(10),false,115},{general_category(10),false,65},{general_category(10),false,116},{general_category(10),false,117},{general_category(10),false,118},{general_category(10),false,119},{general_category(9),false,11},
+	{general_category(9),false,12},{general_category(9),false,100},{general_category(9),false,44},{general_category(9),false,105},{general_category(10),false,120},{general_category(10),false,66},{general_category(10),false,121},{general_category(10),false,122},
+	{general_category(10),false,123},{general_category(10),false,124},{general_category(10),false,125},{general_category(10),false,126},{general_category(10),false,127},{general_category(10),false,128},{general_category(10),false,129},{general_category(10),false,130},
+	{general_category(10),false,131},{general_category(10),false,132},{general_category(10),false,133},{general_category(10),false,134},{general_category(10),false,135},{general_category(10),false,136},{general_category(9),false,137},{general_category(9),false,138},
+	{general_category(9),false,51},{general_category(9),false,52},{general_category(9),false,57},{general_category(9),false,15},{general_category(9),false,56},{general_category(9),false,39},{general_category(10),false,139},{general_category(10),false,97},
+	{general_category(10),false,140},{general_category(10),false,98},{general_category(10),false,141},{general_category(10),false,142},
+};
+
+constexpr std::uint8_t stage1[2176] = {
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,27,27,
+	27,27,27,27,27,27,30,31,32,33,27,34,35,27,27,36,27,37,27,38,27,27,27,39,27,40,27,41,27,27,27,27,
+	42,27,43,27,27,27,44,27,27,27,27,45,27,27,27,27,46,27,47,48,49,50,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,51,52,52,52,52,53,53,53,53,53,53,53,53,53,53,53,53,54,55,56,57,
+	58,59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,27,74,75,76,76,76,76,77,27,27,78,76,76,76,76,76,
+	76,76,27,79,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,27,80,76,81,27,27,27,27,27,27,27,27,
+	27,27,27,82,27,27,83,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,84,85,86,76,76,76,76,87,76,
+	76,76,76,76,76,76,76,88,89,90,91,92,93,94,76,95,96,97,76,98,99,76,100,101,102,103,93,104,105,106,76,76,
+	107,27,27,27,108,109,27,27,27,27,27,27,27,27,27,27,27,110,27,27,111,27,27,27,27,27,27,27,27,112,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,113,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+	27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,114,27,27,27,27,27,27,27,115,116,27,27,27,
+	27,27,27,27,27,27,27,117,27,27,27,27,27,27,27,27,27,27,27,27,27,118,76,76,76,76,76,76,119,120,76,76,
+	27,27,27,27,27,27,27,27,27,121,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	122,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,123,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+	53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,123,
+};
+
+constexpr std::uint16_t stage2[124][32] = {
+	{0,1,2,3,4,5,6,7,8,1,9,10,11,12,13,14,15,15,15,16,17,15,15,18,19,20,21,22,23,24,15,25},
+	{15,15,15,26,27,13,13,13,13,28,13,29,30,31,32,33,34,34,34,34,34,34,34,35,36,37,38,13,39,40,15,41},
+	{11,11,11,13,13,13,15,15,42,15,15,15,43,15,15,15,15,15,15,44,11,45,13,13,46,47,34,48,49,50,51,52},
+	{53,54,50,50,55,34,56,57,50,50,50,50,50,58,59,60,61,62,50,34,63,50,50,50,50,50,64,65,66,50,67,68},
+	{50,69,70,71,50,72,73,50,74,75,50,50,76,34,77,34,78,50,50,79,80,81,82,83,84,85,86,87,88,89,90,91},
+	{92,85,86,93,94,95,96,97,98,99,86,100,101,102,90,103,104,85,86,105,106,107,90,108,109,110,111,112,113,114,96,115},
+	{116,117,86,118,119,120,90,121,122,117,86,123,124,125,90,126,127,117,50,128,129,130,90,131,132,133,50,134,135,136,96,137},
+	{138,50,50,139,140,141,142,142,143,50,144,145,146,147,142,142,148,149,150,151,152,50,153,154,155,156,34,157,158,159,142,142},
+	{50,50,160,161,162,163,164,165,166,167,11,11,168,13,13,169,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,170,171,50,50,170,50,50,172,173,174,50,50,50,173,50,50,50,175,176,177,50,178,11,11,11,11,11,179},
+	{180,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,181,50,182,183,50,50,50,50,184,185,50,186,50,187,50,188,189,190,50,50,50,191,192,193,194,195},
+	{196,194,50,50,197,50,50,198,199,50,200,50,50,50,50,201,50,202,203,204,205,50,206,207,50,50,208,50,209,210,211,211},
+	{50,212,50,50,50,213,214,215,194,194,216,217,218,142,142,142,219,50,50,220,221,162,222,223,224,50,225,66,50,50,226,227},
+	{50,50,228,229,230,66,50,231,232,11,11,233,234,235,236,237,13,13,238,29,29,29,239,240,13,241,29,29,34,34,34,34},
+	{15,15,15,15,15,15,15,15,15,242,15,15,15,15,15,15,243,244,243,243,244,245,243,246,247,247,247,248,249,250,251,252},
+	{253,254,255,256,257,258,259,260,261,262,263,263,264,265,266,267,268,269,270,271,272,273,274,274,275,276,277,211,278,279,211,280},
+	{281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,282,211,283,211,211,211,211,284,211,285,281,286,211,287,288,211},
+	{211,211,289,142,290,142,291,292,293,294,211,211,211,211,295,296,211,211,211,211,211,211,211,211,211,211,211,297,298,211,211,299},
+	{211,211,211,211,211,211,300,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,301,302,303,304,211,211,305,281,306,281},
+	{211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,281,281,281,281,281,281,281,281,307,308,281,281,281,309,281,310},
+	{281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,281,211,211,211,281,311,211,211,312,211,313,211,211,211,211,211,211},
+	{11,11,11,13,13,13,314,315,15,15,15,15,15,15,316,317,13,13,318,50,50,50,319,320,50,321,322,322,322,322,34,34},
+	{323,324,325,326,327,328,142,142,211,329,211,211,211,211,211,330,211,211,211,211,211,211,211,211,211,211,211,211,211,331,142,332},
+	{333,334,335,336,138,50,50,50,50,337,180,50,50,50,50,338,339,50,50,138,50,50,50,50,202,340,50,50,211,211,330,50},
+	{211,341,342,211,343,344,211,211,342,211,211,345,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211},
+	{346,50,50,50,50,50,50,50,347,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,348,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,349,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,211,211,211,211},
+	{350,50,50,50,50,351,50,50,352,353,50,354,355,356,357,50,358,50,50,50,50,50,50,359,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,360,50,50,50,361,50,362,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,363,50,50,50,50,50,50,50,364,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,365,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,366,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,367,50,50,50,50,50,50,50,368,369,370,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,371,50,50,50,50,372,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,373,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,374,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,375,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,376,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,377,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,378,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,379,347,50,50,50,50,50,50,50,370,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,380,50,381,50,50,382,50,50,50,50,50,50,50,383,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,384,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,153,211,211,211,289,50,50,231,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{385,50,386,142,15,15,387,388,15,389,50,50,50,50,390,391,33,392,393,394,15,15,15,395,396,397,398,399,400,401,142,402},
+	{403,50,404,405,50,50,50,406,407,50,50,408,409,194,34,410,66,50,411,50,412,413,50,153,78,50,50,414,415,416,417,418},
+	{50,50,419,420,421,422,50,423,50,50,50,424,425,426,427,428,429,430,322,13,13,431,432,13,13,13,13,13,50,50,433,194},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,434,50,435,50,50,208},
+	{436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436,436},
+	{437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437},
+	{437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,50,50,50,50,50,50,438,439,50,50,50,440,50,441,50,442},
+	{50,50,50,50,50,50,206,50,50,50,50,50,50,209,142,142,443,444,445,446,447,50,50,50,50,50,50,448,449,450,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,451,211,50,50,50,50,452,50,50,453,142,142,454},
+	{34,455,34,456,457,458,459,460,50,50,50,50,50,50,50,461,462,3,4,5,6,463,464,465,50,466,50,202,467,468,469,470},
+	{471,50,174,472,206,206,142,142,50,50,50,50,50,50,50,73,473,474,475,476,477,478,479,480,481,482,483,142,142,211,211,484},
+	{142,142,142,142,142,142,142,142,50,153,50,50,50,102,485,486,50,50,487,50,488,50,50,489,50,490,50,50,491,492,142,142},
+	{11,11,493,13,13,50,50,50,50,206,194,11,11,494,13,495,50,50,496,50,50,50,497,498,498,499,500,501,142,142,142,142},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,321,50,201,496,142,502,29,29,503,142,142,142,142},
+	{504,50,50,505,50,506,50,507,50,202,508,142,142,142,50,509,50,510,50,511,142,142,142,142,50,50,50,512,513,514,515,516},
+	{517,518,50,519,520,521,50,522,50,523,142,142,524,50,525,526,50,50,50,527,50,528,50,529,50,530,531,142,142,142,142,142},
+	{50,50,50,50,198,142,142,142,11,11,11,532,13,13,13,533,50,50,534,194,142,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,513,535,50,50,536,537,142,142,142,142,50,538,539,50,64,540,142,50,541,142,142,50,542,142,50,321},
+	{543,50,50,544,545,546,547,548,224,50,50,549,550,50,198,194,551,50,552,553,554,50,50,555,224,50,50,556,557,558,559,560},
+	{50,99,561,562,142,142,142,142,563,564,565,50,50,566,567,194,568,85,86,569,570,571,572,573,142,142,142,142,142,142,142,142},
+	{50,50,50,574,575,576,537,142,50,50,50,577,578,194,142,142,142,142,142,142,142,142,142,142,50,50,579,580,581,582,142,142},
+	{50,50,50,583,584,194,585,142,50,50,586,587,194,142,142,142,50,175,588,589,321,142,142,142,142,142,142,142,142,142,142,142},
+	{50,50,561,590,142,142,142,142,142,142,11,11,13,13,591,592,593,594,50,595,596,194,142,142,142,142,597,50,50,598,599,142},
+	{600,50,50,601,602,603,50,50,604,605,606,50,50,50,50,198,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{86,50,579,607,608,609,610,611,50,612,613,614,142,142,142,142,615,50,50,616,617,194,618,50,619,620,194,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,50,621,142,142,142,142,142,142,142,142,142,142,142,102,622,623,624,625},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,209,142,142,142,142,142,142},
+	{626,627,628,629,630,631,632,633,50,50,50,50,50,50,50,50,50,50,50,50,434,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,50,50,50,50,50,50,634},
+	{50,50,202,635,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{50,50,50,50,321,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{50,50,50,198,50,202,416,50,50,50,50,202,194,50,206,636,50,50,50,637,638,639,640,641,50,142,142,142,142,142,142,142},
+	{142,142,142,142,11,11,13,13,642,643,142,142,142,142,142,142,50,50,50,50,644,645,646,646,647,648,142,142,142,142,649,650},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,496},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,201,142,142,198,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,651},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,652,142,142,652,653,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,208,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{50,50,50,50,50,50,73,153,198,654,655,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,34,34,656,34,657,211,211,211,211,211,211,211,330,142,142,142},
+	{211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,331,211,211,658,211,211,211,659,660,661,211,662,211,211,211,290,142},
+	{211,211,211,211,663,142,142,142,142,142,142,142,142,142,642,664,211,211,211,211,211,289,513,665,142,142,142,142,142,142,142,142},
+	{11,666,13,667,668,669,243,11,670,671,672,673,674,11,666,13,675,676,13,677,678,679,680,11,681,13,11,666,13,667,668,13},
+	{243,11,670,680,11,681,13,11,666,13,682,11,683,684,685,686,13,687,11,688,689,690,691,13,692,11,693,13,694,695,696,697},
+	{211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211},
+	{34,34,34,698,34,34,699,700,701,702,47,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,703,704,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{705,706,707,142,142,142,142,142,142,142,142,142,142,142,142,142,50,50,153,708,709,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,50,710,142,50,50,711,712,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,713,202},
+	{50,50,50,50,50,50,50,50,50,50,50,50,714,657,142,142,11,11,670,13,715,416,142,142,142,142,142,142,142,142,142,142},
+	{142,142,142,142,142,142,142,559,716,717,718,719,142,142,142,142,559,716,720,721,142,142,142,142,142,142,142,142,142,142,142,142},
+	{722,50,723,724,725,726,727,728,729,208,730,208,142,142,142,731,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{211,211,332,211,211,211,211,211,211,330,341,732,732,732,211,331,733,211,211,211,211,211,211,211,211,211,734,142,142,142,735,211},
+	{736,211,211,332,737,738,331,142,142,142,142,142,142,142,142,142,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,739},
+	{211,211,211,211,211,211,211,211,211,211,211,211,211,740,482,482,211,211,211,211,211,211,211,330,211,211,211,211,211,737,332,483},
+	{332,211,211,211,741,178,211,211,741,211,734,738,142,142,142,142,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211,211},
+	{211,211,211,211,211,330,734,742,289,211,482,290,331,178,741,289,211,211,211,211,211,211,211,211,211,743,211,211,290,142,142,194},
+	{744,50,50,50,50,50,745,50,50,50,50,50,50,50,746,50,50,50,747,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,367,50,50,50,50,50,748,749,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,750,751,50,752,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,370,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,357,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,438,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,753,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,142,142,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,198,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,206,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,537,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,102,142},
+	{50,50,50,50,50,50,50,50,50,754,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50},
+	{50,206,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142},
+	{50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,73,142,142,142,142,142,142,142,142,142,142,142},
+	{755,142,756,756,756,756,756,756,142,142,142,142,142,142,142,142,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,142},
+	{437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,437,757},
+};
+
+constexpr std::uint8_t stage3[758][16] = {
+	{0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,0},
+	{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+	{2,3,3,3,4,3,3,3,5,6,3,7,3,8,3,3},
+	{9,10,11,12,13,14,15,16,17,18,3,3,7,7,7,3},
+	{3,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,19,19,19,19,5,3,6,20,21},
+	{20,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,5,7,6,7,0},
+	{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0},
+	{2,3,4,4,4,4,23,3,20,23,24,25,7,26,23,20},
+	{23,7,27,28,20,22,3,3,20,29,24,30,31,32,33,3},
+	{19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,7,19,19,19,19,19,19,19,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,7,22,22,22,22,22,22,22,22},
+	{19,22,19,22,19,22,19,22,19,22,19,22,19,22,19,22},
+	{19,22,19,22,19,22,19,22,22,19,22,19,22,19,22,19},
+	{22,19,22,19,22,19,22,19,22,22,19,22,19,22,19,22},
+	{19,22,19,22,19,22,19,22,19,19,22,19,22,19,22,22},
+	{22,19,19,22,19,22,19,19,22,19,19,19,22,22,19,19},
+	{19,19,22,19,19,22,19,19,19,22,22,22,19,19,22,19},
+	{19,22,19,22,19,22,19,19,22,19,22,22,19,22,19,19},
+	{22,19,19,19,22,19,22,19,19,22,22,24,19,22,22,22},
+	{24,24,24,24,19,34,22,19,34,22,19,34,22,19,22,19},
+	{22,19,22,19,22,19,22,19,22,19,22,19,22,22,19,22},
+	{22,19,34,22,19,22,19,19,19,22,19,22,19,22,19,22},
+	{19,22,19,22,22,22,22,22,22,22,19,19,22,19,19,22},
+	{22,19,22,19,19,19,19,22,19,22,19,22,19,22,19,22},
+	{22,22,22,22,24,22,22,22,22,22,22,22,22,22,22,22},
+	{35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35},
+	{35,35,20,20,20,20,35,35,35,35,35,35,35,35,35,35},
+	{35,35,20,20,20,20,20,20,20,20,20,20,20,20,20,20},
+	{35,35,35,35,35,20,20,20,20,20,20,20,35,20,35,20},
+	{20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36},
+	{19,22,19,22,35,20,19,22,37,37,35,22,22,22,3,19},
+	{37,37,37,37,20,20,19,3,19,19,19,37,19,37,19,19},
+	{22,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,37,19,19,19,19,19,19,19,19,19,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,19},
+	{22,22,19,19,19,22,22,22,19,22,19,22,19,22,19,22},
+	{22,22,22,22,19,22,7,19,22,19,19,22,22,19,19,19},
+	{19,22,23,36,36,36,36,36,38,38,19,22,19,22,19,22},
+	{19,19,22,19,22,19,22,19,22,19,22,19,22,19,22,22},
+	{37,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,37,37,35,3,3,3,3,3,3},
+	{22,22,22,22,22,22,22,22,22,3,8,37,37,23,23,4},
+	{37,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,36,8,36},
+	{3,36,36,3,36,36,3,36,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,37,37,37,37,24},
+	{24,24,24,3,3,37,37,37,37,37,37,37,37,37,37,37},
+	{26,26,26,26,26,26,7,7,7,3,3,4,3,3,23,23},
+	{36,36,36,36,36,36,36,36,36,36,36,3,26,3,3,3},
+	{35,24,24,24,24,24,24,24,24,24,24,36,36,36,36,36},
+	{9,10,11,12,13,14,15,16,17,18,3,3,3,3,24,24},
+	{36,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,3,24,36,36,36,36,36,36,36,26,23,36},
+	{36,36,36,36,36,35,35,36,36,23,36,36,36,36,24,24},
+	{9,10,11,12,13,14,15,16,17,18,24,24,24,23,23,24},
+	{3,3,3,3,3,3,3,3,3,3,3,3,3,3,37,26},
+	{24,36,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{36,36,36,36,36,36,36,36,36,36,36,37,37,24,24,24},
+	{24,24,24,24,24,24,36,36,36,36,36,36,36,36,36,36},
+	{36,24,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{9,10,11,12,13,14,15,16,17,18,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,36,36,36,36,36},
+	{36,36,36,36,35,35,23,3,3,3,35,37,37,36,4,4},
+	{24,24,24,24,24,24,36,36,36,36,35,36,36,36,36,36},
+	{36,36,36,36,35,36,36,36,35,36,36,36,36,36,37,37},
+	{3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,37},
+	{24,24,24,24,24,24,24,24,24,36,36,36,37,37,3,37},
+	{24,24,24,24,24,24,24,24,24,24,24,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,20,24,24,24,24,24,24,37},
+	{26,26,37,37,37,37,37,37,36,36,36,36,36,36,36,36},
+	{24,24,24,24,24,24,24,24,24,35,36,36,36,36,36,36},
+	{36,36,26,36,36,36,36,36,36,36,36,36,36,36,36,36},
+	{36,36,36,39,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,36,39,36,24,39,39},
+	{39,36,36,36,36,36,36,36,36,39,39,39,39,36,39,39},
+	{24,36,36,36,36,36,36,36,24,24,24,24,24,24,24,24},
+	{24,24,36,36,3,3,9,10,11,12,13,14,15,16,17,18},
+	{3,35,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,36,39,39,37,24,24,24,24,24,24,24,24,37,37,24},
+	{24,37,37,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,37,24,24,24,24,24,24},
+	{24,37,24,37,37,37,24,24,24,24,37,37,36,24,39,39},
+	{39,36,36,36,36,37,37,39,39,37,37,39,39,36,24,37},
+	{37,37,37,37,37,37,37,39,37,37,37,37,24,24,37,24},
+	{24,24,36,36,37,37,9,10,11,12,13,14,15,16,17,18},
+	{24,24,4,4,40,41,42,31,33,43,23,4,24,3,36,37},
+	{37,36,36,39,37,24,24,24,24,24,24,37,37,37,37,24},
+	{24,37,24,24,37,24,24,37,24,24,37,37,36,37,39,39},
+	{39,36,36,37,37,37,37,36,36,37,37,36,36,36,37,37},
+	{37,36,37,37,37,37,37,37,37,24,24,24,24,37,24,37},
+	{37,37,37,37,37,37,9,10,11,12,13,14,15,16,17,18},
+	{36,36,24,24,24,36,3,37,37,37,37,37,37,37,37,37},
+	{37,36,36,39,37,24,24,24,24,24,24,24,24,24,37,24},
+	{24,24,37,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,37,24,24,37,24,24,24,24,24,37,37,36,24,39,39},
+	{39,36,36,36,36,36,37,36,36,39,37,39,39,36,37,37},
+	{24,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{3,4,37,37,37,37,37,37,37,24,36,36,36,36,36,36},
+	{37,36,39,39,37,24,24,24,24,24,24,24,24,37,37,24},
+	{24,37,24,24,37,24,24,24,24,24,37,37,36,24,39,36},
+	{39,36,36,36,36,37,37,39,39,37,37,39,39,36,37,37},
+	{37,37,37,37,37,36,36,39,37,37,37,37,24,24,37,24},
+	{23,24,31,32,33,40,41,42,37,37,37,37,37,37,37,37},
+	{37,37,36,24,37,24,24,24,24,24,24,37,37,37,24,24},
+	{24,37,24,24,24,24,37,37,37,24,24,37,24,37,24,24},
+	{37,37,37,24,24,37,37,37,24,24,24,37,37,37,24,24},
+	{24,24,24,24,24,24,24,24,24,24,37,37,37,37,39,39},
+	{36,39,39,37,37,37,39,39,39,37,39,39,39,36,37,37},
+	{24,37,37,37,37,37,37,39,37,37,37,37,37,37,37,37},
+	{44,45,46,23,23,23,23,23,23,4,23,37,37,37,37,37},
+	{36,39,39,39,36,24,24,24,24,24,24,24,24,37,24,24},
+	{24,37,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,37,37,36,24,36,36},
+	{36,39,39,39,39,37,36,36,36,37,36,36,36,36,37,37},
+	{37,37,37,37,37,36,36,37,24,24,24,37,37,24,37,37},
+	{37,37,37,37,37,37,37,3,47,29,27,28,29,27,28,23},
+	{24,36,39,39,3,24,24,24,24,24,24,24,24,37,24,24},
+	{24,24,24,24,37,24,24,24,24,24,37,37,36,24,39,36},
+	{39,39,39,39,39,37,36,39,39,37,39,39,36,36,37,37},
+	{37,37,37,37,37,39,39,37,37,37,37,37,37,24,24,37},
+	{37,24,24,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{36,36,39,39,24,24,24,24,24,24,24,24,24,37,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,36,36,24,39,39},
+	{39,36,36,36,36,37,39,39,39,37,39,39,39,36,24,23},
+	{37,37,37,37,24,24,24,39,48,49,50,51,52,53,54,24},
+	{44,45,46,31,32,33,40,41,42,23,24,24,24,24,24,24},
+	{37,36,39,39,37,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,37,37,37,24,24,24,24,24,24},
+	{24,24,37,24,24,24,24,24,24,24,24,24,37,24,37,37},
+	{24,24,24,24,24,24,24,37,37,37,36,37,37,37,37,39},
+	{39,39,36,36,36,37,36,37,39,39,39,39,39,39,39,39},
+	{37,37,39,39,3,37,37,37,37,37,37,37,37,37,37,37},
+	{37,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,36,24,24,36,36,36,36,36,36,36,37,37,37,37,4},
+	{24,24,24,24,24,24,35,36,36,36,36,36,36,36,36,3},
+	{9,10,11,12,13,14,15,16,17,18,3,3,37,37,37,37},
+	{37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{37,24,24,37,24,37,24,24,24,24,24,37,24,24,24,24},
+	{24,24,24,24,37,24,37,24,24,24,24,24,24,24,24,24},
+	{24,36,24,24,36,36,36,36,36,36,36,36,36,24,37,37},
+	{24,24,24,24,24,37,35,37,36,36,36,36,36,36,37,37},
+	{9,10,11,12,13,14,15,16,17,18,37,37,24,24,24,24},
+	{24,23,23,23,3,3,3,3,3,3,3,3,3,3,3,3},
+	{3,3,3,23,3,23,23,23,36,36,23,23,23,23,23,23},
+	{9,10,11,12,13,14,15,16,17,18,32,55,56,57,58,59},
+	{60,61,62,63,23,36,23,36,23,36,5,6,5,6,39,39},
+	{24,24,24,24,24,24,24,24,37,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,37,37,37},
+	{37,36,36,36,36,36,36,36,36,36,36,36,36,36,36,39},
+	{36,36,36,36,36,3,36,36,24,24,24,24,24,36,36,36},
+	{36,36,36,36,36,36,36,36,37,36,36,36,36,36,36,36},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,37,23,23},
+	{23,23,23,23,23,23,36,23,23,23,23,23,23,37,23,23},
+	{3,3,3,3,3,23,23,23,23,3,3,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,39,39,36,36,36},
+	{36,39,36,36,36,36,36,36,39,36,36,39,39,36,36,24},
+	{9,10,11,12,13,14,15,16,17,18,3,3,3,3,3,3},
+	{24,24,24,24,24,24,39,39,36,36,24,24,24,24,36,36},
+	{36,24,39,39,39,24,24,39,39,39,39,39,39,39,24,24},
+	{24,36,36,36,36,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,36,39,39,36,36,39,39,39,39,39,39,36,24,39},
+	{9,10,11,12,13,14,15,16,17,18,39,39,39,36,23,23},
+	{19,19,19,19,19,19,37,19,37,37,37,37,37,19,37,37},
+	{22,22,22,22,22,22,22,22,22,22,22,3,35,22,22,22},
+	{24,24,24,24,24,24,24,24,24,37,24,24,24,24,37,37},
+	{24,24,24,24,24,24,24,37,24,37,24,24,24,24,37,37},
+	{24,37,24,24,24,24,37,37,24,24,24,24,24,24,24,37},
+	{24,37,24,24,24,24,37,37,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,37,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,37,37,36,36,36},
+	{3,3,3,3,3,3,3,3,3,29,27,28,64,65,66,67},
+	{68,69,44,70,71,72,73,74,75,76,77,45,78,37,37,37},
+	{23,23,23,23,23,23,23,23,23,23,37,37,37,37,37,37},
+	{19,19,19,19,19,19,37,37,22,22,22,22,22,22,37,37},
+	{8,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,23,3,24},
+	{2,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,5,6,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,3,3,3,79,80},
+	{81,24,24,24,24,24,24,24,24,37,37,37,37,37,37,37},
+	{24,24,36,36,36,39,37,37,37,37,37,37,37,37,37,24},
+	{24,24,36,36,39,3,3,37,37,37,37,37,37,37,37,37},
+	{24,24,36,36,37,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,37,24,24},
+	{24,37,36,36,37,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,36,36,39,36,36,36,36,36,36,36,39,39},
+	{39,39,39,39,39,39,36,39,39,36,36,36,36,36,36,36},
+	{36,36,36,36,3,3,3,35,3,3,3,4,24,36,37,37},
+	{9,10,11,12,13,14,15,16,17,18,37,37,37,37,37,37},
+	{47,29,27,28,64,65,66,67,68,69,37,37,37,37,37,37},
+	{3,3,3,3,3,3,8,3,3,3,3,36,36,36,26,36},
+	{24,24,24,35,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,37,37,37,37,37,37,37},
+	{24,24,24,24,24,36,36,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,36,24,37,37,37,37,37},
+	{24,24,24,24,24,24,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,37},
+	{36,36,36,39,39,39,39,36,36,39,39,39,37,37,37,37},
+	{39,39,36,39,39,39,39,39,39,36,36,36,37,37,37,37},
+	{23,37,37,37,3,3,9,10,11,12,13,14,15,16,17,18},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,37,37},
+	{24,24,24,24,24,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,37,37,37,37,37,37},
+	{9,10,11,12,13,14,15,16,17,18,29,37,37,37,23,23},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23},
+	{24,24,24,24,24,24,24,36,36,39,39,36,37,37,3,3},
+	{24,24,24,24,24,39,36,39,36,36,36,36,36,36,36,37},
+	{36,39,36,39,39,36,36,36,36,36,36,36,36,39,39,39},
+	{39,39,39,36,36,36,36,36,36,36,36,36,36,37,37,36},
+	{3,3,3,3,3,3,3,35,3,3,3,3,3,3,37,37},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,36,38,36},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,37},
+	{36,36,36,36,39,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,36,39,36,36,36,36,36,39,36,39,39,39},
+	{39,39,36,39,39,24,24,24,24,24,24,24,24,37,37,37},
+	{3,23,23,23,23,23,23,23,23,23,23,36,36,36,36,36},
+	{36,36,36,36,23,23,23,23,23,23,23,23,23,3,3,37},
+	{36,36,39,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,39,36,36,36,36,39,39,36,36,39,36,36,36,24,24},
+	{24,24,24,24,24,24,36,39,36,36,39,39,39,36,39,36},
+	{36,36,39,39,37,37,37,37,37,37,37,37,3,3,3,3},
+	{24,24,24,24,39,39,39,39,39,39,39,39,36,36,36,36},
+	{36,36,36,36,39,39,36,36,37,37,37,3,3,3,3,3},
+	{9,10,11,12,13,14,15,16,17,18,37,37,37,24,24,24},
+	{24,24,24,24,24,24,24,24,35,35,35,35,35,35,3,3},
+	{22,22,22,22,22,22,22,22,22,37,37,37,37,37,37,37},
+	{19,19,19,19,19,19,19,19,19,19,19,37,37,19,19,19},
+	{3,3,3,3,3,3,3,3,37,37,37,37,37,37,37,37},
+	{36,36,36,3,36,36,36,36,36,36,36,36,36,36,36,36},
+	{36,39,36,36,36,36,36,36,36,24,24,24,24,36,24,24},
+	{24,24,24,24,36,24,24,39,36,36,24,37,37,37,37,37},
+	{22,22,22,22,22,22,22,22,22,22,22,22,35,35,35,35},
+	{35,35,35,35,35,35,35,35,35,35,35,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,35,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,35,35,35,35,35},
+	{19,22,19,22,19,22,22,22,22,22,22,22,22,22,19,22},
+	{22,22,22,22,22,22,22,22,19,19,19,19,19,19,19,19},
+	{22,22,22,22,22,22,37,37,19,19,19,19,19,19,37,37},
+	{22,22,22,22,22,22,22,22,37,19,37,19,37,19,37,19},
+	{22,22,22,22,22,22,22,22,22,22,22,22,22,22,37,37},
+	{22,22,22,22,22,22,22,22,34,34,34,34,34,34,34,34},
+	{22,22,22,22,22,37,22,22,19,19,19,19,34,20,22,20},
+	{20,20,22,22,22,37,22,22,19,19,19,19,34,20,20,20},
+	{22,22,22,22,37,37,22,22,19,19,19,19,37,20,20,20},
+	{22,22,22,22,22,22,22,22,19,19,19,19,19,20,20,20},
+	{37,37,22,22,22,37,22,22,19,19,19,19,34,20,20,37},
+	{2,2,2,2,2,2,2,2,2,2,2,26,26,26,26,26},
+	{8,8,8,8,8,8,3,3,25,30,5,25,25,30,5,25},
+	{3,3,3,3,3,3,3,3,82,83,26,26,26,26,26,2},
+	{3,3,3,3,3,3,3,3,3,25,30,3,3,3,3,21},
+	{21,3,3,3,7,5,6,3,3,3,3,3,3,3,3,3},
+	{3,3,7,3,21,3,3,3,3,3,3,3,3,3,3,2},
+	{26,26,26,26,26,37,26,26,26,26,26,26,26,26,26,26},
+	{47,35,37,37,64,65,66,67,68,69,7,7,7,5,6,35},
+	{47,29,27,28,64,65,66,67,68,69,7,7,7,5,6,37},
+	{35,35,35,35,35,35,35,35,35,35,35,35,35,37,37,37},
+	{4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+	{4,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,38,38,38},
+	{38,36,38,38,38,36,36,36,36,36,36,36,36,36,36,36},
+	{36,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{23,23,19,23,23,23,23,19,23,23,22,19,19,19,22,22},
+	{19,19,19,22,23,19,23,23,7,19,19,19,19,19,23,23},
+	{23,23,23,23,19,23,19,23,19,23,19,19,19,19,23,22},
+	{19,19,19,19,22,24,24,24,24,22,23,23,22,22,19,19},
+	{7,7,7,7,7,19,22,22,22,22,23,7,23,23,22,23},
+	{84,85,52,86,87,54,88,89,90,91,92,41,93,94,95,29},
+	{96,97,98,99,100,101,102,103,104,105,106,107,108,109,110,111},
+	{111,112,113,19,22,101,108,114,115,47,23,23,37,37,37,37},
+	{7,7,7,7,7,23,23,23,23,23,7,7,23,23,23,23},
+	{7,23,23,7,23,23,7,23,23,23,23,23,23,23,7,23},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,23,7,7},
+	{23,23,7,23,7,23,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,7,7,7,7,7,7,7,7,7,7,7,7},
+	{7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7},
+	{23,23,23,23,23,23,23,23,5,6,5,6,23,23,23,23},
+	{7,7,23,23,23,23,23,23,23,5,6,23,23,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,23,23,7,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,23,7,7,7,7,7},
+	{7,7,7,7,23,23,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,23,23,7,7,7,7},
+	{7,7,23,23,23,23,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,23,23,23,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,23,23,23,23,23,37,37,37,37,37},
+	{29,27,28,64,65,66,67,68,69,44,116,117,118,119,120,43},
+	{121,122,123,70,29,27,28,64,65,66,67,68,69,44,116,117},
+	{118,119,120,43,121,122,123,70,29,27,28,64,65,66,67,68},
+	{69,44,116,117,118,119,120,43,121,122,123,70,23,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,47,116,117,118,119,120},
+	{43,121,122,123,70,29,27,28,64,65,66,67,68,69,44,47},
+	{23,23,23,23,23,23,23,7,23,23,23,23,23,23,23,23},
+	{23,7,23,23,23,23,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,23,23,23,23,7,7,7,7,7,7,7,7},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,7},
+	{23,23,23,23,23,23,23,23,5,6,5,6,5,6,5,6},
+	{5,6,5,6,5,6,29,27,28,64,65,66,67,68,69,44},
+	{29,27,28,64,65,66,67,68,69,44,29,27,28,64,65,66},
+	{67,68,69,44,23,23,23,23,23,23,23,23,23,23,23,23},
+	{7,7,7,7,7,5,6,7,7,7,7,7,7,7,7,7},
+	{7,7,7,7,7,7,5,6,5,6,5,6,5,6,5,6},
+	{7,7,7,5,6,5,6,5,6,5,6,5,6,5,6,5},
+	{6,5,6,5,6,5,6,5,6,7,7,7,7,7,7,7},
+	{7,7,7,7,7,7,7,7,5,6,5,6,7,7,7,7},
+	{7,7,7,7,7,7,7,7,7,7,7,7,5,6,7,7},
+	{7,7,7,7,7,23,23,7,7,7,7,7,7,23,23,23},
+	{23,23,23,23,37,37,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,23,23,37,23,23,23,23,23,23,23,23,23},
+	{19,22,19,19,19,22,22,19,22,19,22,19,22,19,19,19},
+	{19,22,19,22,22,19,22,22,22,22,22,22,35,35,19,19},
+	{19,22,19,22,22,23,23,23,23,23,23,19,22,19,22,36},
+	{36,36,19,22,37,37,37,37,37,3,3,3,3,32,3,3},
+	{22,22,22,22,22,22,37,22,37,37,37,37,37,22,37,37},
+	{24,24,24,24,24,24,24,24,37,37,37,37,37,37,37,35},
+	{3,37,37,37,37,37,37,37,37,37,37,37,37,37,37,36},
+	{24,24,24,24,24,24,24,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,37,24,24,24,24,24,24,24,37},
+	{3,3,25,30,25,30,3,3,3,25,30,3,25,30,3,3},
+	{3,3,3,3,3,3,3,8,3,3,8,3,25,30,3,3},
+	{25,30,5,6,5,6,5,6,5,6,3,3,3,3,3,35},
+	{3,3,3,3,3,3,3,3,3,3,8,8,3,3,3,3},
+	{8,3,5,3,3,3,3,3,3,3,3,3,3,3,3,3},
+	{23,23,3,3,3,5,6,5,6,5,6,5,6,8,37,37},
+	{23,23,23,23,23,23,23,23,23,23,37,23,23,23,23,23},
+	{23,23,23,23,37,37,37,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,37,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,23,23,23,23,23,23,37,37,37,37},
+	{2,3,3,3,23,35,24,124,5,6,5,6,5,6,5,6},
+	{5,6,23,23,5,6,5,6,5,6,5,6,8,5,6,6},
+	{23,96,97,98,99,100,101,102,103,104,36,36,36,36,39,39},
+	{8,35,35,35,35,35,23,23,105,125,126,35,24,3,23,23},
+	{24,24,24,24,24,24,24,37,37,36,36,20,20,35,35,24},
+	{24,24,24,24,24,24,24,24,24,24,24,3,35,35,35,24},
+	{37,37,37,37,37,24,24,24,24,24,24,24,24,24,24,24},
+	{23,23,29,27,28,64,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,37},
+	{29,27,28,64,65,66,67,68,69,44,23,23,23,23,23,23},
+	{23,23,23,23,23,23,23,23,44,70,71,72,73,74,75,76},
+	{23,127,128,129,130,131,132,133,134,135,71,136,137,138,139,140},
+	{23,141,142,143,144,72,145,146,147,148,149,150,151,152,153,73},
+	{24,24,24,24,24,154,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,155,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,154,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,156,24,24},
+	{157,24,24,156,24,24,24,158,24,159,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,160,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,155,24,24,24},
+	{24,24,24,24,154,24,161,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,162},
+	{163,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,164},
+	{24,24,24,24,24,24,24,24,159,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,154,24,24},
+	{165,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,162,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,166,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,155,24,167,24,168,24,24},
+	{24,163,24,164,169,170,24,24,24,24,24,24,171,24,24,24},
+	{24,159,159,159,159,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,161,24,24,24,24},
+	{24,157,24,24,24,24,24,24,24,157,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,157,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,160,169},
+	{24,24,24,24,24,24,24,24,24,24,24,24,157,155,159,24},
+	{155,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,163,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,167,24,24,24},
+	{24,24,156,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,156,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,160,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,165,24},
+	{24,24,24,24,24,24,161,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,158,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,155,24},
+	{24,164,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,168,24,24,24,24,24,165,24,24,24},
+	{24,24,24,24,24,24,24,24,168,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,172,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,35,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,35,3,3,3},
+	{9,10,11,12,13,14,15,16,17,18,24,24,37,37,37,37},
+	{19,22,19,22,19,22,19,22,19,22,19,22,19,22,24,36},
+	{38,38,38,3,36,36,36,36,36,36,36,36,36,36,3,35},
+	{19,22,19,22,19,22,19,22,19,22,19,22,35,35,36,36},
+	{24,24,24,24,24,24,96,97,98,99,100,101,102,103,104,124},
+	{36,36,3,3,3,3,3,3,37,37,37,37,37,37,37,37},
+	{20,20,20,20,20,20,20,35,35,35,35,35,35,35,35,35},
+	{20,20,19,22,19,22,19,22,19,22,19,22,19,22,19,22},
+	{22,22,19,22,19,22,19,22,19,22,19,22,19,22,19,22},
+	{35,22,22,22,22,22,22,22,22,19,22,19,22,19,19,22},
+	{19,22,19,22,19,22,19,22,35,20,20,19,22,19,22,24},
+	{19,22,19,22,22,22,19,22,19,22,19,22,19,22,19,22},
+	{19,22,19,22,19,22,19,22,19,22,19,19,19,19,19,22},
+	{19,19,19,19,19,22,19,22,19,22,19,22,19,22,19,22},
+	{19,22,19,22,19,19,19,19,22,19,22,37,37,37,37,37},
+	{19,22,37,22,37,22,19,22,19,22,37,37,37,37,37,37},
+	{37,37,35,35,35,19,22,24,35,35,22,24,24,24,24,24},
+	{24,24,36,24,24,24,36,24,24,24,24,36,24,24,24,24},
+	{24,24,24,39,39,36,36,39,23,23,23,23,36,37,37,37},
+	{31,32,33,40,41,42,23,23,4,23,37,37,37,37,37,37},
+	{24,24,24,24,3,3,3,3,37,37,37,37,37,37,37,37},
+	{39,39,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,39,39,39,39,39,39,39,39,39,39,39,39},
+	{39,39,39,39,36,36,37,37,37,37,37,37,37,37,3,3},
+	{36,36,24,24,24,24,24,24,3,3,3,24,3,24,24,36},
+	{24,24,24,24,24,24,36,36,36,36,36,36,36,36,3,3},
+	{24,24,24,24,24,24,24,36,36,36,36,36,36,36,36,36},
+	{36,36,39,39,37,37,37,37,37,37,37,37,37,37,37,3},
+	{24,24,24,36,39,39,36,36,36,36,39,39,36,36,39,39},
+	{39,3,3,3,3,3,3,3,3,3,3,3,3,3,37,35},
+	{9,10,11,12,13,14,15,16,17,18,37,37,37,37,3,3},
+	{24,24,24,24,24,36,35,24,24,24,24,24,24,24,24,24},
+	{9,10,11,12,13,14,15,16,17,18,24,24,24,24,24,37},
+	{24,24,24,24,24,24,24,24,24,36,36,36,36,36,36,39},
+	{39,36,36,39,39,36,36,37,37,37,37,37,37,37,37,37},
+	{24,24,24,36,24,24,24,24,24,24,24,24,36,39,37,37},
+	{9,10,11,12,13,14,15,16,17,18,37,37,3,3,3,3},
+	{35,24,24,24,24,24,24,23,23,23,24,39,36,39,24,24},
+	{36,24,36,36,36,24,24,36,36,24,24,24,24,24,36,36},
+	{24,36,24,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{37,37,37,37,37,37,37,37,37,37,37,24,24,35,3,3},
+	{24,24,24,24,24,24,24,24,24,24,24,39,36,36,39,39},
+	{3,3,24,35,35,39,36,37,37,37,37,37,37,37,37,37},
+	{37,24,24,24,24,24,24,37,37,24,24,24,24,24,24,37},
+	{37,24,24,24,24,24,24,37,37,37,37,37,37,37,37,37},
+	{22,22,22,22,22,22,22,22,22,22,22,20,35,35,35,35},
+	{22,22,22,22,22,22,22,22,22,35,20,20,37,37,37,37},
+	{24,24,24,39,39,36,39,39,36,39,39,3,39,36,37,37},
+	{24,24,24,24,37,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,37,37,37,37,24,24,24,24,24},
+	{173,173,173,173,173,173,173,173,173,173,173,173,173,173,173,173},
+	{174,174,174,174,174,174,174,174,174,174,174,174,174,174,174,174},
+	{24,24,24,24,24,24,24,24,24,24,24,159,24,24,24,24},
+	{24,24,24,163,24,24,24,24,155,24,24,24,24,24,24,24},
+	{24,24,172,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,168,24,168,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,163,24,24},
+	{22,22,22,22,22,22,22,37,37,37,37,37,37,37,37,37},
+	{37,37,37,22,22,22,22,22,37,37,37,37,37,24,36,24},
+	{24,24,24,24,24,24,24,24,24,7,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,37,24,24,24,24,24,37,24,37},
+	{24,24,37,24,24,37,24,24,24,24,24,24,24,24,24,24},
+	{24,24,20,20,20,20,20,20,20,20,20,20,20,20,20,20},
+	{20,20,20,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{37,37,37,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,6,5},
+	{37,37,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,37,37,37,37,37,37,37,23},
+	{24,24,24,24,24,24,24,24,24,24,24,24,4,23,23,23},
+	{3,3,3,3,3,3,3,5,6,3,37,37,37,37,37,37},
+	{3,8,8,21,21,5,6,5,6,5,6,5,6,5,6,5},
+	{6,5,6,5,6,3,3,5,6,3,3,3,3,21,21,21},
+	{3,3,3,37,3,3,3,3,8,5,6,5,6,5,6,3},
+	{3,3,7,8,7,7,7,37,3,4,3,3,37,37,37,37},
+	{24,24,24,24,24,37,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,37,37,26},
+	{37,3,3,3,4,3,3,3,5,6,3,7,3,8,3,3},
+	{22,22,22,22,22,22,22,22,22,22,22,5,7,6,7,5},
+	{6,3,5,6,3,3,24,24,24,24,24,24,24,24,24,24},
+	{35,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,35,35},
+	{37,37,24,24,24,24,24,24,37,37,24,24,24,24,24,24},
+	{37,37,24,24,24,24,24,24,37,37,24,24,24,37,37,37},
+	{4,4,7,20,23,4,4,37,23,7,7,7,7,23,23,37},
+	{37,37,37,37,37,37,37,37,37,26,26,26,23,23,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,37,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,37,24,24,37,24},
+	{3,3,3,37,37,37,37,29,27,28,64,65,66,67,68,69},
+	{44,70,71,72,73,74,75,76,77,45,175,176,177,178,179,180},
+	{181,182,46,183,184,185,186,187,188,189,190,78,191,192,193,194},
+	{195,196,197,198,37,37,37,23,23,23,23,23,23,23,23,23},
+	{199,200,96,100,108,110,112,114,100,105,108,109,110,111,112,100},
+	{105,108,109,110,111,113,114,105,96,96,96,97,97,97,97,100},
+	{105,105,105,105,105,126,108,108,108,108,109,201,110,110,110,110},
+	{110,111,112,100,108,32,32,87,33,23,23,23,23,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,47,31,23,23,23,37},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,37,37,37},
+	{23,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,36,37,37},
+	{36,29,27,28,64,65,66,67,68,69,44,70,71,72,73,74},
+	{75,76,77,45,175,176,177,178,179,180,181,182,37,37,37,37},
+	{29,65,44,73,37,37,37,37,37,37,37,37,37,24,24,24},
+	{24,202,24,24,24,24,24,24,24,24,203,37,37,37,37,37},
+	{24,24,24,24,24,24,36,36,36,36,36,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,37,3},
+	{24,24,24,24,37,37,37,37,24,24,24,24,24,24,24,24},
+	{3,96,97,105,125,109,37,37,37,37,37,37,37,37,37,37},
+	{19,19,19,19,19,19,19,19,22,22,22,22,22,22,22,22},
+	{19,19,19,19,37,37,37,37,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,37,37,37,37},
+	{24,24,24,24,24,24,24,24,37,37,37,37,37,37,37,37},
+	{24,24,24,24,37,37,37,37,37,37,37,37,37,37,37,3},
+	{19,19,19,19,19,19,19,19,19,19,19,37,19,19,19,19},
+	{19,19,19,37,19,19,37,22,22,22,22,22,22,22,22,22},
+	{22,22,37,22,22,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,37,22,22,22,22,22,22,22,37,22,22,37,37,37},
+	{35,35,35,35,35,35,37,35,35,35,35,35,35,35,35,35},
+	{35,37,35,35,35,35,35,35,35,35,35,37,37,37,37,37},
+	{24,24,24,24,24,24,37,37,24,37,24,24,24,24,24,24},
+	{24,24,24,24,24,24,37,24,24,37,37,37,24,37,37,24},
+	{24,24,24,24,24,24,37,3,29,27,28,44,70,45,46,78},
+	{24,24,24,24,24,24,24,23,23,29,27,28,64,65,44,70},
+	{37,37,37,37,37,37,37,29,27,28,64,64,65,44,70,45},
+	{24,24,24,37,24,24,37,37,37,37,37,29,65,44,70,45},
+	{24,24,24,24,24,24,29,44,70,45,27,28,37,37,37,3},
+	{24,24,24,24,24,24,24,24,24,24,37,37,37,37,37,3},
+	{24,24,24,24,24,24,24,24,37,37,37,37,204,32,24,24},
+	{29,27,28,64,65,66,67,68,69,44,70,71,72,73,74,75},
+	{37,37,45,175,176,177,178,179,180,181,182,46,183,184,185,186},
+	{187,188,189,190,78,191,192,193,194,195,196,197,198,205,206,207},
+	{208,209,210,211,212,213,214,91,31,86,215,32,216,87,33,92},
+	{24,36,36,36,37,36,36,37,37,37,37,37,36,36,36,36},
+	{24,24,24,24,37,24,24,24,37,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,37,37,36,36,36,37,37,37,37,36},
+	{29,27,28,64,44,70,45,46,32,37,37,37,37,37,37,37},
+	{3,3,3,3,3,3,3,3,3,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,29,73,3},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,29,44,70},
+	{24,24,24,24,24,24,24,24,23,24,24,24,24,24,24,24},
+	{24,24,24,24,24,36,36,37,37,37,37,29,65,44,70,45},
+	{3,3,3,3,3,3,3,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,37,37,37,3,3,3,3,3,3,3},
+	{24,24,24,24,24,24,37,37,29,27,28,64,44,70,45,46},
+	{24,24,24,37,37,37,37,37,29,27,28,64,44,70,45,46},
+	{24,24,37,37,37,37,37,37,37,3,3,3,3,37,37,37},
+	{37,37,37,37,37,37,37,37,37,29,27,28,64,44,70,45},
+	{19,19,19,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{22,22,22,37,37,37,37,37,37,37,29,65,44,73,45,46},
+	{24,24,24,24,36,36,36,36,37,37,37,37,37,37,37,37},
+	{76,77,45,175,176,177,178,179,180,181,182,32,31,86,87,37},
+	{24,24,24,24,24,24,24,24,24,24,37,36,36,8,37,37},
+	{24,24,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,29,27,28},
+	{64,65,44,70,71,45,32,24,37,37,37,37,37,37,37,37},
+	{36,29,44,70,45,3,3,3,3,3,37,37,37,37,37,37},
+	{24,24,36,36,36,36,3,3,3,3,37,37,37,37,37,37},
+	{24,24,24,24,24,29,27,28,64,44,70,45,37,37,37,37},
+	{39,36,39,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,36,36,36,36,36,36,36,36},
+	{36,36,36,36,36,36,36,3,3,3,3,3,3,3,37,37},
+	{37,37,29,27,28,64,65,66,67,68,69,44,70,71,72,73},
+	{74,75,76,77,45,46,9,10,11,12,13,14,15,16,17,18},
+	{36,24,24,36,36,24,37,37,37,37,37,37,37,37,37,36},
+	{39,39,39,36,36,36,36,39,39,36,36,3,3,26,3,3},
+	{3,3,36,37,37,37,37,37,37,37,37,37,37,26,37,37},
+	{36,36,36,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,36,36,36,36,36,39,36,36,36},
+	{36,36,36,36,36,37,9,10,11,12,13,14,15,16,17,18},
+	{3,3,3,3,24,39,39,24,37,37,37,37,37,37,37,37},
+	{24,24,24,36,3,3,24,37,37,37,37,37,37,37,37,37},
+	{24,24,24,39,39,39,36,36,36,36,36,36,36,36,36,39},
+	{39,24,24,24,24,3,3,3,3,36,36,36,36,3,39,36},
+	{9,10,11,12,13,14,15,16,17,18,24,3,24,3,3,3},
+	{37,29,27,28,64,65,66,67,68,69,44,70,71,72,73,74},
+	{75,76,77,45,46,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,39,39,39,36},
+	{36,36,39,39,36,39,36,36,3,3,3,3,3,3,36,37},
+	{24,24,24,24,24,24,24,37,24,37,24,24,24,24,37,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,37,24},
+	{24,24,24,24,24,24,24,24,24,3,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,36},
+	{39,39,39,36,36,36,36,36,36,36,36,37,37,37,37,37},
+	{36,36,39,39,37,24,24,24,24,24,24,24,24,37,37,24},
+	{24,37,24,24,37,24,24,24,24,24,37,36,36,24,39,39},
+	{36,39,39,39,39,37,37,39,39,37,37,39,39,39,37,37},
+	{24,37,37,37,37,37,37,39,37,37,37,37,37,24,24,24},
+	{24,24,39,39,37,37,36,36,36,36,36,36,36,37,37,37},
+	{36,36,36,36,36,37,37,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,39,39,39,36,36,36,36,36,36,36,36},
+	{39,39,36,36,36,39,36,24,24,24,24,3,3,3,3,3},
+	{9,10,11,12,13,14,15,16,17,18,3,3,37,3,36,24},
+	{39,39,39,36,36,36,36,36,36,39,36,39,39,39,39,36},
+	{36,39,36,36,24,24,3,24,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,39},
+	{39,39,36,36,36,36,37,37,39,39,39,39,36,36,39,36},
+	{36,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+	{3,3,3,3,3,3,3,3,24,24,24,24,36,36,37,37},
+	{39,39,39,36,36,36,36,36,36,36,36,39,39,36,39,36},
+	{36,3,3,3,24,37,37,37,37,37,37,37,37,37,37,37},
+	{3,3,3,3,3,3,3,3,3,3,3,3,3,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,36,39,36,39,39},
+	{36,36,36,36,36,36,39,36,24,3,37,37,37,37,37,37},
+	{39,39,36,36,36,36,39,36,36,36,36,36,37,37,37,37},
+	{9,10,11,12,13,14,15,16,17,18,44,70,3,3,3,23},
+	{36,36,36,36,36,36,36,36,39,36,36,3,37,37,37,37},
+	{9,10,11,12,13,14,15,16,17,18,44,70,71,72,73,74},
+	{75,76,77,37,37,37,37,37,37,37,37,37,37,37,37,24},
+	{24,24,24,24,24,24,24,37,37,24,37,37,24,24,24,24},
+	{24,24,24,24,37,24,24,37,24,24,24,24,24,24,24,24},
+	{39,39,39,39,39,39,37,39,39,37,37,36,36,39,36,24},
+	{39,24,39,36,3,3,3,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,37,37,24,24,24,24,24,24},
+	{24,39,39,39,36,36,36,36,37,37,36,36,39,39,39,39},
+	{36,24,3,24,39,37,37,37,37,37,37,37,37,37,37,37},
+	{24,36,36,36,36,36,36,36,36,36,36,24,24,24,24,24},
+	{24,24,24,36,36,36,36,36,36,39,24,36,36,36,36,3},
+	{3,3,3,3,3,3,3,36,37,37,37,37,37,37,37,37},
+	{24,36,36,36,36,36,36,39,39,36,36,36,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,36,36,36,36,36,36},
+	{36,36,36,36,36,36,36,39,36,36,3,3,3,24,3,3},
+	{3,3,3,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{36,36,36,36,36,36,36,37,36,36,36,36,36,36,39,36},
+	{24,3,3,3,3,3,37,37,37,37,37,37,37,37,37,37},
+	{9,10,11,12,13,14,15,16,17,18,29,27,28,64,65,66},
+	{67,68,69,44,70,71,72,73,74,75,76,77,45,37,37,37},
+	{3,3,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{37,37,36,36,36,36,36,36,36,36,36,36,36,36,36,36},
+	{36,36,36,36,36,36,36,36,37,39,36,36,36,36,36,36},
+	{36,39,36,36,39,36,36,37,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,37,24,24,37,24,24,24,24,24},
+	{24,36,36,36,36,36,36,37,37,37,36,37,36,36,37,36},
+	{36,36,36,36,36,36,24,36,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,37,24,24,37,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,39,39,39,39,39,37},
+	{36,36,37,39,39,36,39,36,24,37,37,37,37,37,37,37},
+	{24,24,24,36,36,39,39,3,3,37,37,37,37,37,37,37},
+	{217,48,218,219,49,220,50,221,51,40,40,52,41,53,42,54},
+	{31,32,32,33,217,23,23,23,23,23,23,23,23,4,4,4},
+	{4,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23},
+	{23,23,37,37,37,37,37,37,37,37,37,37,37,37,37,3},
+	{97,98,99,100,101,102,103,104,98,99,100,101,102,103,104,99},
+	{100,101,102,103,104,96,97,98,99,100,101,102,103,104,96,97},
+	{98,99,100,97,98,98,99,100,101,102,103,104,96,97,98,98},
+	{99,100,222,223,96,97,98,98,99,100,98,98,99,99,99,99},
+	{101,102,102,102,103,103,104,104,104,104,97,98,99,100,101,96},
+	{97,98,99,99,100,100,97,98,96,97,224,225,226,224,225,227},
+	{199,228,199,199,200,224,225,229,108,99,100,101,102,103,104,37},
+	{3,3,3,3,3,37,37,37,37,37,37,37,37,37,37,37},
+	{24,3,3,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{26,26,26,26,26,26,26,26,26,37,37,37,37,37,37,37},
+	{36,36,36,36,36,3,37,37,37,37,37,37,37,37,37,37},
+	{36,36,36,36,36,36,36,3,3,3,3,3,23,23,23,23},
+	{35,35,35,35,3,23,37,37,37,37,37,37,37,37,37,37},
+	{9,10,11,12,13,14,15,16,17,18,37,44,45,78,230,231},
+	{232,233,37,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,37,37,37,37,37,24,24,24},
+	{47,29,27,28,64,65,66,67,68,69,44,116,117,118,119,120},
+	{43,121,122,123,29,27,28,3,3,3,3,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,24,37,37,37,37,36},
+	{24,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39},
+	{39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39},
+	{39,39,39,39,39,39,39,39,37,37,37,37,37,37,37,36},
+	{36,36,36,35,35,35,35,35,35,35,35,35,35,35,35,35},
+	{35,35,3,35,36,37,37,37,37,37,37,37,37,37,37,37},
+	{39,39,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{35,35,35,35,37,35,35,35,35,35,35,35,37,35,35,37},
+	{24,24,24,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{37,37,37,37,24,24,24,24,37,37,37,37,37,37,37,37},
+	{24,24,24,24,24,24,24,24,24,24,37,37,23,36,36,3},
+	{26,26,26,26,37,37,37,37,37,37,37,37,37,37,37,37},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,36,37,37},
+	{36,36,36,36,36,36,36,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,23,37,37,23,23,23,23,23,23,23},
+	{23,23,23,23,23,39,39,36,36,36,23,23,23,39,39,39},
+	{39,39,39,26,26,26,26,26,26,26,26,36,36,36,36,36},
+	{36,36,36,23,23,36,36,36,36,36,36,36,23,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,36,36,36,36,23,23},
+	{23,23,36,36,36,23,37,37,37,37,37,37,37,37,37,37},
+	{43,121,122,123,37,37,37,37,37,37,37,37,37,37,37,37},
+	{76,77,29,27,28,64,65,29,65,37,37,37,37,37,37,37},
+	{19,19,19,19,19,19,19,19,19,19,22,22,22,22,22,22},
+	{22,22,22,22,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,19,19,19,19,19,19,19,22,22},
+	{22,22,22,22,22,37,22,22,22,22,22,22,22,22,22,22},
+	{19,19,22,22,22,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,19,37,19,19},
+	{37,37,19,37,37,19,19,37,37,19,19,19,19,37,19,19},
+	{19,19,19,19,19,19,22,22,22,22,37,22,37,22,22,22},
+	{22,22,22,22,37,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,19,19,37,19,19,19,19,37,37,19,19,19},
+	{19,19,19,19,19,37,19,19,19,19,19,19,19,37,22,22},
+	{22,22,22,22,22,22,22,22,19,19,37,19,19,19,19,37},
+	{19,19,19,19,19,37,19,37,37,37,19,19,19,19,19,19},
+	{19,37,22,22,22,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,19,19,19,19},
+	{19,19,19,19,19,19,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,37,37,19,19,19,19,19,19,19,19},
+	{19,7,22,22,22,22,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,7,22,22,22,22},
+	{22,22,19,19,19,19,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,19,19,19,19,7,22,22,22,22},
+	{22,22,22,22,22,7,22,22,22,22,22,22,19,19,19,19},
+	{19,19,19,19,19,7,22,22,22,22,22,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,7},
+	{22,22,22,22,22,22,19,19,19,19,19,19,19,19,19,19},
+	{19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,7},
+	{22,22,22,22,22,22,22,22,22,7,22,22,22,22,22,22},
+	{19,19,19,19,19,19,19,19,19,7,22,22,22,22,22,22},
+	{22,22,22,7,22,22,22,22,22,22,19,22,37,37,9,10},
+	{11,12,13,14,15,16,17,18,9,10,11,12,13,14,15,16},
+	{17,18,9,10,11,12,13,14,15,16,17,18,9,10,11,12},
+	{13,14,15,16,17,18,9,10,11,12,13,14,15,16,17,18},
+	{36,36,36,36,36,36,36,23,23,23,23,36,36,36,36,36},
+	{36,36,36,36,36,36,36,36,36,36,36,36,36,23,23,23},
+	{23,23,23,23,23,36,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,23,36,23,23,3,3,3,3,3,37,37,37,37},
+	{37,37,37,37,37,37,37,37,37,37,37,36,36,36,36,36},
+	{22,22,22,22,22,22,22,22,22,22,24,22,22,22,22,22},
+	{22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,37},
+	{36,36,36,36,36,36,36,37,36,36,36,36,36,36,36,36},
+	{36,36,36,36,36,36,36,36,36,37,37,36,36,36,36,36},
+	{36,36,37,36,36,37,36,36,36,36,36,37,37,37,37,37},
+	{36,36,36,36,36,36,36,35,35,35,35,35,35,35,37,37},
+	{9,10,11,12,13,14,15,16,17,18,37,37,37,37,24,23},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,24,36,37},
+	{24,24,24,24,24,24,24,24,24,24,24,24,36,36,36,36},
+	{9,10,11,12,13,14,15,16,17,18,37,37,37,37,37,4},
+	{24,24,24,24,24,24,24,37,24,24,24,24,37,24,24,37},
+	{24,24,24,24,24,37,37,29,27,28,64,65,66,67,68,69},
+	{22,22,22,22,36,36,36,36,36,36,36,35,37,37,37,37},
+	{75,76,77,45,175,176,177,178,179,180,181,182,46,183,184,185},
+	{186,187,188,189,190,78,191,192,193,194,195,196,197,198,205,206},
+	{205,234,235,29,27,28,64,65,66,67,68,69,23,31,32,33},
+	{4,29,27,78,205,37,37,37,37,37,37,37,37,37,37,37},
+	{186,187,188,189,190,78,191,192,193,194,195,196,197,198,23,27},
+	{28,64,65,66,67,68,69,44,177,179,183,78,32,91,37,37},
+	{24,24,24,24,37,24,24,24,24,24,24,24,24,24,24,24},
+	{37,24,24,37,24,37,37,24,37,24,24,24,24,24,24,24},
+	{24,24,24,37,24,24,24,24,37,24,37,24,37,37,37,37},
+	{37,37,24,37,37,37,37,24,37,24,37,24,37,24,24,24},
+	{37,24,24,37,24,37,37,24,37,24,37,24,37,24,37,24},
+	{37,24,24,37,24,37,37,24,24,24,24,37,24,24,24,24},
+	{24,24,24,37,24,24,24,24,37,24,24,24,24,37,24,37},
+	{24,24,24,24,24,24,24,24,24,24,37,24,24,24,24,24},
+	{37,24,24,24,37,24,24,24,24,24,37,24,24,24,24,24},
+	{7,7,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{37,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23},
+	{47,47,29,27,28,64,65,66,67,68,69,47,47,23,23,23},
+	{23,23,23,23,23,23,23,23,23,23,23,23,23,23,37,37},
+	{37,37,37,37,37,37,23,23,23,23,23,23,23,23,23,23},
+	{23,23,23,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,23,23,23,37,37,37,37,37,37,37},
+	{23,23,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,23,23,23,23,23,23,20,20,20,20,20},
+	{23,23,23,23,23,23,23,23,37,37,37,37,37,23,23,23},
+	{23,23,23,23,23,23,23,23,37,37,37,37,37,37,37,37},
+	{23,23,23,23,23,37,37,37,23,23,23,23,23,37,37,37},
+	{23,23,23,37,23,23,23,23,23,23,23,23,23,23,23,23},
+	{24,156,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,24,161,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,161,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,154,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{24,24,24,170,24,24,24,24,24,24,24,24,171,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,171,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,168,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,159,24,24},
+	{24,24,24,24,24,24,24,24,24,159,24,24,24,24,24,24},
+	{24,24,24,24,24,24,24,24,24,24,24,24,24,161,24,24},
+	{160,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24},
+	{37,26,37,37,37,37,37,37,37,37,37,37,37,37,37,37},
+	{26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+	{174,174,174,174,174,174,174,174,174,174,174,174,174,174,37,37},
+};
+
+constexpr auto lookup(char32_t c) -> record const& {
+	auto const cp = unsigned(c) < 0x110000u ? unsigned(c) : 0xFFFFFu; // noncharacter, unassigned
+	auto const row = stage1[cp >> stage2_shift];
+	auto const block = stage2[row][(cp >> stage3_shift) & ((1u << (stage2_shift - stage3_shift)) - 1)];
+	return records[stage3[block][cp & ((1u << stage3_shift) - 1)]];
+}
+
+} // namespace detail::properties
+
+constexpr auto category(char32_t c) -> general_category { return detail::properties::lookup(c).category; }
+
+// is_letter(c) := category(c) in [Lu, Ll, Lt, Lm, Lo]
+constexpr auto is_letter(char32_t c) -> bool { return category(c) <= general_category::other_letter; }
+
+// is_mark(c) := category(c) in [Mn, Mc, Me]
+constexpr auto is_mark(char32_t c) -> bool {
+	auto const gc = category(c);
+	return gc >= general_category::nonspacing_mark && gc <= general_category::enclosing_mark;
+}
+
+// is_number(c) := category(c) in [Nd, Nl, No]
+constexpr auto is_number(char32_t c) -> bool {
+	auto const gc = category(c);
+	return gc >= general_category::decimal_number && gc <= general_category::other_number;
+}
+
+// is_punctuation(c) := category(c) in [Pc, Pd, Ps, Pe, Pi, Pf, Po]
+constexpr auto is_punctuation(char32_t c) -> bool {
+	auto const gc = category(c);
+	return gc >= general_category::connector_punctuation && gc <= general_category::other_punctuation;
+}
+
+// is_symbol(c) := category(c) in [Sm, Sc, Sk, So]
+constexpr auto is_symbol(char32_t c) -> bool {
+	auto const gc = category(c);
+	return gc >= general_category::math_symbol && gc <= general_category::other_symbol;
+}
+
+// is_whitespace(c) := c has the White_Space property
+constexpr auto is_whitespace(char32_t c) -> bool { return detail::properties::lookup(c).white_space; }
+
+// numeric_value returns the Numeric_Value property of c (e.g. 5 for '5' and
+// U+2164, 0.5 for U+00BD, 10000 for U+4E07), or nothing for non-numeric c
+constexpr auto numeric_value(char32_t c) -> std::optional<double> {
+	auto const n = detail::properties::lookup(c).numeric;
+	if (!n)
+		return {};
+	auto const& v = detail::properties::numeric_values[n];
+	return double(v.numerator) / double(v.denominator);
+}
+
+// decimal returns 0..9 for the decimal digits (category Nd)
+// for all other values, returns a value >= 10
+constexpr auto decimal(char32_t c) -> unsigned {
+	auto const& r = detail::properties::lookup(c);
+	return r.category == general_category::decimal_number
+		? unsigned(detail::properties::numeric_values[r.numeric].numerator)
+		: unsigned(-1);
+}
+
+} // namespace strings::unicode